@@ -0,0 +1,52 @@
+#ifndef BENCHMARK_HPP
+#define BENCHMARK_HPP
+
+#include <chrono>
+#include <cstddef>
+#include <cstdio>
+#include <string>
+
+inline volatile double g_benchmark_sink = 0.0;
+
+/**
+ * Keeps a value alive so the computation producing it is not removed by the optimizer.
+ * @tparam T Arithmetic type.
+ * @param value Value.
+ */
+template <typename T>
+void keep(const T value)
+{
+    g_benchmark_sink = g_benchmark_sink + static_cast<double>(value);
+}
+
+/**
+ * Runs a function repeatedly and prints the fastest time per item out of several runs.
+ * @tparam Function Callable with no parameters.
+ * @param name Name printed with the result.
+ * @param items Number of items processed by a single call.
+ * @param function Function.
+ * @return Fastest time per item in nanoseconds.
+ */
+template <typename Function>
+double benchmark(const std::string& name, const size_t items, Function function)
+{
+    constexpr int runs = 5;
+    constexpr int iterations = 10;
+    double best = 0.0;
+    for (int run = 0; run < runs; ++run) {
+        const auto start = std::chrono::steady_clock::now();
+        for (int i = 0; i < iterations; ++i) {
+            function();
+        }
+        const auto end = std::chrono::steady_clock::now();
+        const double nanoseconds = std::chrono::duration<double, std::nano>(end - start).count()
+            / static_cast<double>(iterations) / static_cast<double>(items);
+        if (run == 0 || nanoseconds < best) {
+            best = nanoseconds;
+        }
+    }
+    std::printf("%-48s %10.3f ns/item %12.2f M items/s\n", name.c_str(), best, 1000.0 / best);
+    return best;
+}
+
+#endif
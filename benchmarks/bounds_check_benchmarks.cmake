@@ -0,0 +1,33 @@
+# Builds and runs the matrix benchmarks at -O2 without bounds checking and with each bounds check policy to show the
+# overhead of checked builds.
+# Run with the nnm_bounds_check_benchmarks target or directly with:
+#   cmake -DCXX=<compiler> -DSOURCE_DIR=<repository> -DWORK_DIR=<directory> -P bounds_check_benchmarks.cmake
+
+file(REMOVE_RECURSE ${WORK_DIR})
+file(MAKE_DIRECTORY ${WORK_DIR})
+
+# Each policy is a name followed by its flags separated by commas.
+set(POLICIES
+        "unchecked"
+        "throw,-DNNM_BOUNDS_CHECK"
+        "abort,-DNNM_BOUNDS_CHECK_ABORT,-fno-exceptions"
+        "trap,-DNNM_BOUNDS_CHECK_TRAP,-fno-exceptions"
+        "handler,-DNNM_BOUNDS_CHECK_HANDLER,-fno-exceptions")
+
+foreach (policy ${POLICIES})
+    string(REPLACE "," ";" flags "${policy}")
+    list(POP_FRONT flags name)
+    set(executable ${WORK_DIR}/matrix_${name})
+    execute_process(
+            COMMAND ${CXX} -std=c++17 -O2 ${flags} -I${SOURCE_DIR}/include
+            ${SOURCE_DIR}/benchmarks/matrix_main.cpp -o ${executable} -pthread
+            RESULT_VARIABLE result)
+    if (NOT result EQUAL 0)
+        message(FATAL_ERROR "Failed to compile the ${name} benchmarks")
+    endif ()
+    message("-O2, ${name}:")
+    execute_process(COMMAND ${executable} RESULT_VARIABLE result)
+    if (NOT result EQUAL 0)
+        message(FATAL_ERROR "Failed to run the ${name} benchmarks")
+    endif ()
+endforeach ()
@@ -0,0 +1,124 @@
+# Measures the time to compile many translation units that include nnm and the size of their object files.
+# Run with the nnm_compile_benchmarks target or directly with:
+#   cmake -DCXX=<compiler> -DSOURCE_DIR=<repository> -DWORK_DIR=<directory> [-DCOUNT=<units>]
+#   -P compile_benchmarks.cmake
+
+if (NOT DEFINED COUNT)
+    set(COUNT 16)
+endif ()
+set(OPTIMIZATIONS -O0 -O2)
+
+file(REMOVE_RECURSE ${WORK_DIR})
+file(MAKE_DIRECTORY ${WORK_DIR})
+math(EXPR last "${COUNT} - 1")
+
+# Geometry units use the common float and double classes like a typical source file of an application.
+set(geometry_code "
+nnm::Vector3f unit@INDEX@(
+    const nnm::Transform3f& a, const nnm::Transform3f& b, const nnm::Vector3f& point, const nnm::Matrix4f& matrix)
+{
+    const nnm::Transform3f composed = a.transform(b);
+    const auto rotation = nnm::QuaternionF::from_axis_angle(point.normalize(), 0.5f);
+    const nnm::Vector4f projected = matrix * nnm::Vector4f(point, 1.0f);
+    const nnm::Basis3f basis = nnm::Basis3f::from_rotation_axis_angle(nnm::Vector3f::axis_y(), 0.25f);
+    const nnm::Vector3d precise = nnm::Vector3d(point).cross(nnm::Vector3d(1.0, 2.0, 3.0)).normalize();
+    const nnm::Matrix3f inverse = basis.matrix.unchecked_inverse();
+    return point.transform(composed).rotate_quaternion(rotation) + projected.xyz() + nnm::Vector3f(precise)
+        + inverse * point;
+}
+")
+
+# Integer units only use Vector2i like grid and tile code.
+set(integer_code "
+int unit@INDEX@(const nnm::Vector2ii& cell, const nnm::Vector2ii& size)
+{
+    const nnm::Vector2ii wrapped = (cell + nnm::Vector2ii(1, 1)) % size;
+    return wrapped.x + wrapped.y * size.x + static_cast<int>(nnm::Vector2ii::Hash()(cell) & 1);
+}
+")
+
+# Writes the units with a prefix that start with an include or import followed by code.
+function(write_units prefix first_line code)
+    set(units)
+    foreach (index RANGE ${last})
+        string(REPLACE "@INDEX@" "${index}" unit_code "${code}")
+        file(WRITE ${WORK_DIR}/${prefix}${index}.cpp "${first_line}\n${unit_code}")
+        list(APPEND units ${prefix}${index})
+    endforeach ()
+    set(${prefix}units ${units} PARENT_SCOPE)
+endfunction ()
+
+write_units(geometry_ "#include <nnm/nnm.hpp>" "${geometry_code}")
+write_units(transform3_ "#include <nnm/transform3.hpp>" "${geometry_code}")
+write_units(integer_ "#include <nnm/nnm.hpp>" "${integer_code}")
+write_units(vector2i_ "#include <nnm/vector2i.hpp>" "${integer_code}")
+write_units(module_ "import nnm;" "${geometry_code}")
+
+# The module is built to nnm.pcm with Clang and to gcm.cache/nnm.gcm in the working directory with GCC.
+execute_process(COMMAND ${CXX} --version OUTPUT_VARIABLE version)
+if (version MATCHES "clang")
+    set(module_build --precompile -x c++-module ${SOURCE_DIR}/src/nnm.cppm -o ${WORK_DIR}/nnm.pcm)
+    set(module_flags -fmodule-file=nnm=${WORK_DIR}/nnm.pcm)
+else ()
+    set(module_build -fmodules-ts -x c++ -c ${SOURCE_DIR}/src/nnm.cppm -o ${WORK_DIR}/nnm_module.o)
+    set(module_flags -fmodules-ts)
+endif ()
+
+# Compiles every unit and prints the total time and object size.
+function(compile_units label units flags)
+    string(TIMESTAMP start "%s%f")
+    set(bytes 0)
+    foreach (unit ${units})
+        execute_process(
+                COMMAND ${CXX} ${flags} -I${SOURCE_DIR}/include -c ${WORK_DIR}/${unit}.cpp -o ${WORK_DIR}/${unit}.o
+                WORKING_DIRECTORY ${WORK_DIR}
+                RESULT_VARIABLE result)
+        if (NOT result EQUAL 0)
+            message(FATAL_ERROR "Failed to compile ${unit}")
+        endif ()
+        file(SIZE ${WORK_DIR}/${unit}.o size)
+        math(EXPR bytes "${bytes} + ${size}")
+    endforeach ()
+    string(TIMESTAMP end "%s%f")
+    math(EXPR total "(${end} - ${start}) / 1000")
+    math(EXPR each "${total} / ${COUNT}")
+    message("${label} ${total} ms (${each} ms/unit), ${bytes} object bytes")
+endfunction ()
+
+foreach (optimization ${OPTIMIZATIONS})
+    string(TIMESTAMP start "%s%f")
+    execute_process(
+            COMMAND ${CXX} -std=c++17 ${optimization} -DNNM_EXTERN_TEMPLATES -I${SOURCE_DIR}/include
+            -c ${SOURCE_DIR}/src/nnm_instantiations.cpp -o ${WORK_DIR}/nnm_instantiations.o
+            RESULT_VARIABLE result)
+    if (NOT result EQUAL 0)
+        message(FATAL_ERROR "Failed to compile nnm_instantiations")
+    endif ()
+    string(TIMESTAMP end "%s%f")
+    math(EXPR total "(${end} - ${start}) / 1000")
+    message("${optimization} nnm_instantiations (once) ${total} ms")
+    set(cxx17 -std=c++17 ${optimization})
+    compile_units("${optimization} ${COUNT} geometry units, nnm.hpp" "${geometry_units}" "${cxx17}")
+    compile_units("${optimization} ${COUNT} geometry units, nnm.hpp with NNM_EXTERN_TEMPLATES"
+            "${geometry_units}" "${cxx17};-DNNM_EXTERN_TEMPLATES")
+    compile_units("${optimization} ${COUNT} geometry units, transform3.hpp" "${transform3_units}" "${cxx17}")
+    compile_units("${optimization} ${COUNT} integer units, nnm.hpp" "${integer_units}" "${cxx17}")
+    compile_units("${optimization} ${COUNT} integer units, vector2i.hpp" "${vector2i_units}" "${cxx17}")
+
+    set(cxx20 -std=c++20 ${optimization})
+    string(TIMESTAMP start "%s%f")
+    execute_process(
+            COMMAND ${CXX} ${cxx20} ${module_build} -I${SOURCE_DIR}/include
+            WORKING_DIRECTORY ${WORK_DIR}
+            RESULT_VARIABLE result
+            ERROR_QUIET)
+    string(TIMESTAMP end "%s%f")
+    if (NOT result EQUAL 0)
+        message("${optimization} nnm module skipped since the compiler could not build it")
+        continue()
+    endif ()
+    math(EXPR total "(${end} - ${start}) / 1000")
+    message("${optimization} nnm module (once) ${total} ms")
+    compile_units("${optimization} ${COUNT} geometry units, nnm.hpp as C++20" "${geometry_units}" "${cxx20}")
+    compile_units("${optimization} ${COUNT} geometry units, import nnm" "${module_units}" "${cxx20};${module_flags}")
+endforeach ()
@@ -0,0 +1,32 @@
+# Builds and runs the matrix benchmarks at the optimization levels of debug and release builds, with the hot
+# accessors and operators forced inline and with NNM_FORCE_INLINE defined as inline.
+# Run with the nnm_debug_benchmarks target or directly with:
+#   cmake -DCXX=<compiler> -DSOURCE_DIR=<repository> -DWORK_DIR=<directory> -P debug_benchmarks.cmake
+
+set(OPTIMIZATIONS -O0 -Og -O2)
+
+file(REMOVE_RECURSE ${WORK_DIR})
+file(MAKE_DIRECTORY ${WORK_DIR})
+
+foreach (optimization ${OPTIMIZATIONS})
+    foreach (inlining forced not_forced)
+        if (inlining STREQUAL "forced")
+            set(defines)
+        else ()
+            set(defines -DNNM_FORCE_INLINE=inline)
+        endif ()
+        set(executable ${WORK_DIR}/matrix${optimization}_${inlining})
+        execute_process(
+                COMMAND ${CXX} -std=c++17 ${optimization} ${defines} -I${SOURCE_DIR}/include
+                ${SOURCE_DIR}/benchmarks/matrix_main.cpp -o ${executable} -pthread
+                RESULT_VARIABLE result)
+        if (NOT result EQUAL 0)
+            message(FATAL_ERROR "Failed to compile the ${optimization} ${inlining} benchmarks")
+        endif ()
+        message("${optimization}, ${inlining} inline:")
+        execute_process(COMMAND ${executable} RESULT_VARIABLE result)
+        if (NOT result EQUAL 0)
+            message(FATAL_ERROR "Failed to run the ${optimization} ${inlining} benchmarks")
+        endif ()
+    endforeach ()
+endforeach ()
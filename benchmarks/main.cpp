@@ -0,0 +1,14 @@
+#include <nnm/dispatch.hpp>
+#include <nnm/gpu.hpp>
+#include <nnm/nnm.hpp>
+#include <nnm/parallel.hpp>
+#include <nnm/point_cloud.hpp>
+#include <nnm/snapshot.hpp>
+
+#include "nnm_benchmarks.hpp"
+
+int main()
+{
+    nnm_benchmarks();
+    return 0;
+}
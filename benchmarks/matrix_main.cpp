@@ -0,0 +1,7 @@
+#include "nnm_benchmarks.hpp"
+
+int main()
+{
+    matrix_benchmarks();
+    return 0;
+}
@@ -0,0 +1,775 @@
+#ifndef NNM_BENCHMARKS_HPP
+#define NNM_BENCHMARKS_HPP
+
+#include <nnm/dispatch.hpp>
+#include <nnm/gpu.hpp>
+#include <nnm/nnm.hpp>
+#include <nnm/parallel.hpp>
+#include <nnm/point_cloud.hpp>
+#include <nnm/snapshot.hpp>
+
+#include <cstdio>
+#include <memory>
+#include <random>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "benchmark.hpp"
+
+inline std::vector<nnm::Vector3f> random_points(std::mt19937& generator, const size_t count, const float extent)
+{
+    std::uniform_real_distribution distribution(-extent, extent);
+    std::vector<nnm::Vector3f> points;
+    points.reserve(count);
+    for (size_t i = 0; i < count; ++i) {
+        points.emplace_back(distribution(generator), distribution(generator), distribution(generator));
+    }
+    return points;
+}
+
+inline void ray_benchmarks()
+{
+    std::mt19937 generator(1); // NOLINT(*-msc51-cpp)
+    constexpr size_t triangle_count = 4096;
+    constexpr size_t ray_count = 64;
+    const std::vector<nnm::Vector3f> origins = random_points(generator, triangle_count, 10.0f);
+    const std::vector<nnm::Vector3f> offsets = random_points(generator, triangle_count * 2, 1.0f);
+    std::vector<nnm::Vector3f> vertices;
+    vertices.reserve(triangle_count * 3);
+    for (size_t i = 0; i < triangle_count; ++i) {
+        vertices.push_back(origins[i]);
+        vertices.push_back(origins[i] + offsets[i * 2]);
+        vertices.push_back(origins[i] + offsets[i * 2 + 1]);
+    }
+    const std::vector<nnm::Vector3f> ray_origins = random_points(generator, ray_count, 12.0f);
+    const std::vector<nnm::Vector3f> ray_targets = random_points(generator, ray_count, 5.0f);
+    std::vector<nnm::Ray3f> rays;
+    rays.reserve(ray_count);
+    for (size_t i = 0; i < ray_count; ++i) {
+        rays.push_back(nnm::Ray3f::from_points(ray_origins[i], ray_targets[i]));
+    }
+    std::vector<nnm::Ray3Packet8f> packets;
+    for (size_t i = 0; i < ray_count; i += 8) {
+        packets.emplace_back(rays.data() + i);
+    }
+
+    const size_t tests = triangle_count * ray_count;
+    benchmark("Ray3::intersect_triangle", tests, [&] {
+        size_t hits = 0;
+        for (const nnm::Ray3f& ray : rays) {
+            for (size_t i = 0; i < triangle_count; ++i) {
+                hits += ray.intersect_triangle(vertices[i * 3], vertices[i * 3 + 1], vertices[i * 3 + 2]).has_value();
+            }
+        }
+        keep(hits);
+    });
+    benchmark("Ray3::intersect_triangle_watertight", tests, [&] {
+        size_t hits = 0;
+        for (const nnm::Ray3f& ray : rays) {
+            for (size_t i = 0; i < triangle_count; ++i) {
+                hits += ray.intersect_triangle_watertight(vertices[i * 3], vertices[i * 3 + 1], vertices[i * 3 + 2])
+                            .has_value();
+            }
+        }
+        keep(hits);
+    });
+    benchmark("Ray3Packet8f::intersect_triangle", tests, [&] {
+        size_t hits = 0;
+        for (const nnm::Ray3Packet8f& packet : packets) {
+            for (size_t i = 0; i < triangle_count; ++i) {
+                const auto result
+                    = packet.intersect_triangle(vertices[i * 3], vertices[i * 3 + 1], vertices[i * 3 + 2]);
+                for (const bool hit : result.hit) {
+                    hits += hit;
+                }
+            }
+        }
+        keep(hits);
+    });
+    benchmark("Ray3::intersect_aabb", tests, [&] {
+        size_t hits = 0;
+        for (const nnm::Ray3f& ray : rays) {
+            for (size_t i = 0; i < triangle_count; ++i) {
+                hits += ray.intersect_aabb(origins[i], origins[i] + nnm::Vector3f::one()).has_value();
+            }
+        }
+        keep(hits);
+    });
+    benchmark("Ray3Packet8f::intersect_aabb", tests, [&] {
+        size_t hits = 0;
+        for (const nnm::Ray3Packet8f& packet : packets) {
+            for (size_t i = 0; i < triangle_count; ++i) {
+                const auto result = packet.intersect_aabb(origins[i], origins[i] + nnm::Vector3f::one());
+                for (const bool hit : result.hit) {
+                    hits += hit;
+                }
+            }
+        }
+        keep(hits);
+    });
+}
+
+inline void plane_benchmarks()
+{
+    std::mt19937 generator(2); // NOLINT(*-msc51-cpp)
+    constexpr size_t point_count = 1 << 16;
+    const std::vector<nnm::Vector3f> points = random_points(generator, point_count, 10.0f);
+    const nnm::Plane3f plane = nnm::Plane3f({ 1.0f, 2.0f, 3.0f }, 1.0f).normalize();
+    std::vector<float> distances(point_count);
+
+    benchmark("signed_distance_batch", point_count, [&] {
+        nnm::signed_distance_batch(plane, points.data(), point_count, distances.data());
+        keep(distances[point_count / 2]);
+    });
+}
+
+inline void parallel_benchmarks()
+{
+    std::mt19937 generator(3); // NOLINT(*-msc51-cpp)
+    constexpr size_t point_count = 1 << 22;
+    const std::vector<nnm::Vector3f> points = random_points(generator, point_count, 10.0f);
+    std::vector<nnm::Vector3f> results(point_count);
+    const auto transform = nnm::Transform3f::from_rotation_axis_angle(nnm::Vector3f::axis_y(), 0.5f)
+                               .scale({ 1.0f, 2.0f, 3.0f })
+                               .translate({ 4.0f, 5.0f, 6.0f });
+
+    benchmark("transform_point_batch", point_count, [&] {
+        nnm::transform_point_batch(transform, points.data(), point_count, results.data());
+        keep(results[point_count / 2].x);
+    });
+    for (size_t thread_count = 1; thread_count <= nnm::parallel::default_thread_count(); thread_count *= 2) {
+        nnm::parallel::ThreadPool pool(thread_count);
+        benchmark(
+            "parallel::transform_point_batch (" + std::to_string(thread_count) + " threads)", point_count, [&] {
+                nnm::parallel::transform_point_batch(pool, transform, points.data(), point_count, results.data());
+                keep(results[point_count / 2].x);
+            });
+    }
+}
+
+inline void reduction_benchmarks()
+{
+    std::mt19937 generator(4); // NOLINT(*-msc51-cpp)
+    constexpr size_t point_count = 1 << 22;
+    const std::vector<nnm::Vector3f> points = random_points(generator, point_count, 10.0f);
+    nnm::parallel::ThreadPool pool;
+
+    benchmark("AABB3::from_points", point_count, [&] {
+        keep(nnm::AABB3f::from_points(points.data(), point_count).max.x);
+    });
+    benchmark("parallel::aabb_from_points", point_count, [&] {
+        keep(nnm::parallel::aabb_from_points(pool, points.data(), point_count).max.x);
+    });
+    benchmark("centroid", point_count, [&] { keep(nnm::centroid(points.data(), point_count).x); });
+    benchmark("parallel::centroid", point_count, [&] {
+        keep(nnm::parallel::centroid(pool, points.data(), point_count).x);
+    });
+    benchmark("covariance", point_count, [&] { keep(nnm::covariance(points.data(), point_count).at(0, 0)); });
+    benchmark("parallel::covariance", point_count, [&] {
+        keep(nnm::parallel::covariance(pool, points.data(), point_count).at(0, 0));
+    });
+    nnm::parallel::ThreadPool pool1(1);
+    benchmark("parallel::covariance (1 thread)", point_count, [&] {
+        keep(nnm::parallel::covariance(pool1, points.data(), point_count).at(0, 0));
+    });
+    benchmark("Sphere3::from_points_ritter", point_count, [&] {
+        keep(nnm::Sphere3f::from_points_ritter(points.data(), point_count).radius);
+    });
+    benchmark("Sphere3::from_points", point_count, [&] {
+        keep(nnm::Sphere3f::from_points(points.data(), point_count).radius);
+    });
+}
+
+inline std::vector<nnm::Basis3f> random_rotations(std::mt19937& generator, const size_t count)
+{
+    std::uniform_real_distribution angle_distribution(-nnm::pi<float>(), nnm::pi<float>());
+    const std::vector<nnm::Vector3f> axes = random_points(generator, count, 1.0f);
+    std::vector<nnm::Basis3f> rotations;
+    rotations.reserve(count);
+    for (const nnm::Vector3f& axis : axes) {
+        rotations.push_back(nnm::Basis3f::from_rotation_axis_angle(
+            (axis + nnm::Vector3f(0.0f, 0.0f, 2.0f)).normalize(), angle_distribution(generator)));
+    }
+    return rotations;
+}
+
+inline void decomposition_benchmarks()
+{
+    std::mt19937 generator(11); // NOLINT(*-msc51-cpp)
+    constexpr size_t count = 1 << 14;
+    const std::vector<nnm::Vector3f> columns = random_points(generator, count * 3, 1.0f);
+    const std::vector<nnm::Basis3f> rotations = random_rotations(generator, count);
+    std::vector<nnm::Matrix3f> matrices(count);
+    for (size_t i = 0; i < count; ++i) {
+        matrices[i] = { columns[i * 3], columns[i * 3 + 1], columns[i * 3 + 2] };
+    }
+    std::vector<nnm::Matrix3f> covariances(count);
+    for (size_t i = 0; i < count; ++i) {
+        covariances[i] = matrices[i] * matrices[i].transpose();
+    }
+    // Repeated eigenvalues and rank-deficient matrices which are common for covariances of flat, linear, or
+    // symmetric point sets. Each of the four kinds is a rotated diagonal matrix.
+    const nnm::Vector3f degenerate_scales[4] {
+        { 0.0f, 0.0f, 0.0f }, { 2.0f, 2.0f, 2.0f }, { 3.0f, 0.0f, 0.0f }, { 1.0f, 1.0f, 4.0f }
+    };
+    std::vector<nnm::Matrix3f> degenerate_covariances(count);
+    for (size_t i = 0; i < count; ++i) {
+        const nnm::Matrix3f rotation = rotations[i].matrix;
+        degenerate_covariances[i]
+            = rotation * nnm::Basis3f::from_scale(degenerate_scales[i % 4]).matrix * rotation.transpose();
+    }
+    std::vector<nnm::Matrix3f::SymmetricEigen> eigens(count);
+    std::vector<nnm::Matrix3f::SingularValueDecomposition> decompositions(count);
+    std::vector<nnm::Basis3f> bases(count);
+
+    benchmark("symmetric_eigen_batch (random)", count, [&] {
+        nnm::symmetric_eigen_batch(covariances.data(), count, eigens.data());
+        keep(eigens[count / 2].values.x);
+    });
+    benchmark("symmetric_eigen_batch (degenerate)", count, [&] {
+        nnm::symmetric_eigen_batch(degenerate_covariances.data(), count, eigens.data());
+        keep(eigens[count / 2].values.x);
+    });
+    benchmark("singular_value_decomposition_batch", count, [&] {
+        nnm::singular_value_decomposition_batch(matrices.data(), count, decompositions.data());
+        keep(decompositions[count / 2].singular_values.x);
+    });
+    benchmark("orthonormalize_batch", count, [&] {
+        for (size_t i = 0; i < count; ++i) {
+            bases[i] = nnm::Basis3f(rotations[i].matrix + matrices[i] * 0.01f);
+        }
+        nnm::orthonormalize_batch(bases.data(), count);
+        keep(bases[count / 2].matrix.at(0, 0));
+    });
+}
+
+inline void obb_benchmarks()
+{
+    std::mt19937 generator(12); // NOLINT(*-msc51-cpp)
+    constexpr size_t box_count = 1 << 12;
+    constexpr size_t pair_count = 1 << 16;
+    const std::vector<nnm::Vector3f> centers = random_points(generator, box_count, 10.0f);
+    const std::vector<nnm::Vector3f> extents = random_points(generator, box_count, 2.0f);
+    const std::vector<nnm::Basis3f> rotations = random_rotations(generator, box_count);
+    std::vector<nnm::OBB3f> boxes;
+    boxes.reserve(box_count);
+    for (size_t i = 0; i < box_count; ++i) {
+        boxes.emplace_back(centers[i], rotations[i], extents[i].abs() + nnm::Vector3f::one());
+    }
+    std::uniform_int_distribution<uint32_t> index_distribution(0, box_count - 1);
+    std::vector<nnm::Vector2u32> pairs(pair_count);
+    for (nnm::Vector2u32& pair : pairs) {
+        pair = { index_distribution(generator), index_distribution(generator) };
+    }
+    const std::unique_ptr<bool[]> results = std::make_unique<bool[]>(pair_count);
+
+    benchmark("intersects_batch (OBB3f)", pair_count, [&] {
+        nnm::intersects_batch(boxes.data(), pairs.data(), pair_count, results.get());
+        keep(results[pair_count / 2]);
+    });
+}
+
+inline void dispatch_benchmarks()
+{
+    std::mt19937 generator(5); // NOLINT(*-msc51-cpp)
+    // Small enough to stay in cache so the instruction set, not memory bandwidth, decides the time.
+    constexpr size_t point_count = 1 << 14;
+    const std::vector<nnm::Vector3f> points = random_points(generator, point_count, 10.0f);
+    std::vector<nnm::Vector3f> results(point_count);
+    std::vector<float> distances(point_count);
+    const auto transform = nnm::Transform3f::from_rotation_axis_angle(nnm::Vector3f::axis_y(), 0.5f)
+                               .translate({ 4.0f, 5.0f, 6.0f });
+    const nnm::Plane3f plane = nnm::Plane3f({ 1.0f, 2.0f, 3.0f }, 1.0f).normalize();
+    const std::pair<nnm::dispatch::Isa, std::string> isas[4] { { nnm::dispatch::Isa::baseline, "baseline" },
+                                                               { nnm::dispatch::Isa::avx2, "avx2" },
+                                                               { nnm::dispatch::Isa::avx512, "avx512" },
+                                                               { nnm::dispatch::Isa::avx512fp16, "avx512fp16" } };
+
+    for (const auto& [isa, name] : isas) {
+        if (!nnm::dispatch::supported(isa)) {
+            continue;
+        }
+        benchmark("dispatch::transform_point_batch (" + name + ")", point_count, [&] {
+            nnm::dispatch::transform_point_batch(isa, transform, points.data(), point_count, results.data());
+            keep(results[point_count / 2].x);
+        });
+        benchmark("dispatch::normalize_batch (" + name + ")", point_count, [&] {
+            nnm::dispatch::normalize_batch(isa, points.data(), point_count, results.data());
+            keep(results[point_count / 2].x);
+        });
+        benchmark("dispatch::signed_distance_batch (" + name + ")", point_count, [&] {
+            nnm::dispatch::signed_distance_batch(isa, plane, points.data(), point_count, distances.data());
+            keep(distances[point_count / 2]);
+        });
+    }
+}
+
+inline void wide_benchmarks()
+{
+    std::mt19937 generator(6); // NOLINT(*-msc51-cpp)
+    constexpr size_t point_count = 1 << 16;
+    const std::vector<nnm::Vector3f> points = random_points(generator, point_count, 100.0f);
+    const std::vector<nnm::Vector3f> targets = random_points(generator, point_count, 100.0f);
+    const auto transform = nnm::Transform3f::from_rotation_axis_angle({ 0.0f, 0.0f, 1.0f }, 0.5f)
+                               .translate({ 1.0f, 2.0f, 3.0f });
+    std::vector<nnm::Vector3f> results(point_count);
+
+    benchmark("Vector3f transform/lerp", point_count, [&] {
+        for (size_t i = 0; i < point_count; ++i) {
+            results[i] = points[i].transform(transform).lerp(targets[i], 0.25f);
+        }
+        keep(results[point_count / 2].x);
+    });
+    benchmark("Vector3x8f transform/lerp", point_count, [&] {
+        for (size_t i = 0; i < point_count; i += 8) {
+            const auto vectors = nnm::Vector3x8f::load(points.data() + i);
+            const auto to = nnm::Vector3x8f::load(targets.data() + i);
+            vectors.transform(transform).lerp(to, 0.25f).store(results.data() + i);
+        }
+        keep(results[point_count / 2].x);
+    });
+    benchmark("Vector3f transform/normalize/lerp", point_count, [&] {
+        for (size_t i = 0; i < point_count; ++i) {
+            results[i] = points[i].transform(transform).normalize().lerp(targets[i], 0.25f);
+        }
+        keep(results[point_count / 2].x);
+    });
+    benchmark("Vector3x8f transform/normalize/lerp", point_count, [&] {
+        for (size_t i = 0; i < point_count; i += 8) {
+            const auto vectors = nnm::Vector3x8f::load(points.data() + i);
+            const auto to = nnm::Vector3x8f::load(targets.data() + i);
+            vectors.transform(transform).normalize().lerp(to, 0.25f).store(results.data() + i);
+        }
+        keep(results[point_count / 2].x);
+    });
+}
+
+inline void aligned_benchmarks()
+{
+    std::mt19937 generator(7); // NOLINT(*-msc51-cpp)
+    constexpr size_t point_count = 1 << 16;
+    const std::vector<nnm::Vector3f> points = random_points(generator, point_count, 100.0f);
+    std::vector<nnm::Vector3Af> aligned_points(point_count);
+    for (size_t i = 0; i < point_count; ++i) {
+        aligned_points[i] = nnm::Vector3Af(points[i]);
+    }
+    const auto transform = nnm::Transform3f::from_rotation_axis_angle({ 0.0f, 1.0f, 0.0f }, 0.5f)
+                               .translate({ 1.0f, 2.0f, 3.0f });
+    std::vector<nnm::Vector3f> results(point_count);
+    std::vector<nnm::Vector3Af> aligned_results(point_count);
+
+    benchmark("transform_point_batch (Vector3f, 12 bytes)", point_count, [&] {
+        nnm::transform_point_batch(transform, points.data(), point_count, results.data());
+        keep(results[point_count / 2].x);
+    });
+    benchmark("transform_point_batch (Vector3Af, 16 bytes)", point_count, [&] {
+        nnm::transform_point_batch(transform, aligned_points.data(), point_count, aligned_results.data());
+        keep(aligned_results[point_count / 2].x);
+    });
+}
+
+inline void quantized_benchmarks()
+{
+    std::mt19937 generator(8); // NOLINT(*-msc51-cpp)
+    constexpr size_t count = 1 << 16;
+    const std::vector<nnm::Vector3f> vectors = random_points(generator, count, 1.0f);
+    std::vector<nnm::QuaternionF> quaternions;
+    quaternions.reserve(count);
+    for (const nnm::Vector3f& vector : vectors) {
+        quaternions.push_back(nnm::QuaternionF::from_axis_angle(vector.normalize(), vector.x * 3.0f));
+    }
+    std::vector<nnm::Vector3f> decoded(count);
+    std::vector<nnm::QuaternionF> decoded_quaternions(count);
+    std::vector<nnm::Vector3h> halves(count);
+    std::vector<nnm::Vector3snorm16> snorms(count);
+    std::vector<nnm::QuaternionPacked48> packed(count);
+    std::vector<nnm::Vector3f> normals(count);
+    nnm::normalize_batch(vectors.data(), count, normals.data());
+    std::vector<nnm::Vector3oct16> octahedrals(count);
+
+    for (const nnm::dispatch::Isa isa : { nnm::dispatch::Isa::baseline, nnm::dispatch::Isa::avx2 }) {
+        if (!nnm::dispatch::supported(isa)) {
+            continue;
+        }
+        const std::string name = isa == nnm::dispatch::Isa::baseline ? "baseline" : "avx2";
+        benchmark("dispatch::encode_batch (Vector3h, " + name + ")", count, [&] {
+            nnm::dispatch::encode_batch(isa, vectors.data(), count, halves.data());
+            keep(halves[count / 2].x);
+        });
+        benchmark("dispatch::decode_batch (Vector3h, " + name + ")", count, [&] {
+            nnm::dispatch::decode_batch(isa, halves.data(), count, decoded.data());
+            keep(decoded[count / 2].x);
+        });
+    }
+    benchmark("encode_batch (Vector3snorm16)", count, [&] {
+        nnm::encode_batch(vectors.data(), count, snorms.data());
+        keep(snorms[count / 2].x);
+    });
+    benchmark("decode_batch (Vector3snorm16)", count, [&] {
+        nnm::decode_batch(snorms.data(), count, decoded.data());
+        keep(decoded[count / 2].x);
+    });
+    benchmark("encode_batch (Vector3oct16)", count, [&] {
+        nnm::encode_batch(normals.data(), count, octahedrals.data());
+        keep(octahedrals[count / 2].x);
+    });
+    benchmark("encode_precise_batch (Vector3oct16)", count, [&] {
+        nnm::encode_precise_batch(normals.data(), count, octahedrals.data());
+        keep(octahedrals[count / 2].x);
+    });
+    benchmark("decode_batch (Vector3oct16)", count, [&] {
+        nnm::decode_batch(octahedrals.data(), count, decoded.data());
+        keep(decoded[count / 2].x);
+    });
+    benchmark("encode_batch (QuaternionPacked48)", count, [&] {
+        nnm::encode_batch(quaternions.data(), count, packed.data());
+        keep(packed[count / 2].data[0]);
+    });
+    benchmark("decode_batch (QuaternionPacked48)", count, [&] {
+        nnm::decode_batch(packed.data(), count, decoded_quaternions.data());
+        keep(decoded_quaternions[count / 2].w);
+    });
+}
+
+inline void snapshot_benchmarks()
+{
+    std::mt19937 generator(9); // NOLINT(*-msc51-cpp)
+    constexpr size_t count = 1 << 15;
+    const std::vector<nnm::Vector3f> translations = random_points(generator, count, 1000.0f);
+    const std::vector<nnm::Vector3f> motions = random_points(generator, count, 0.01f);
+    std::vector<nnm::QuaternionF> rotations;
+    rotations.reserve(count);
+    for (const nnm::Vector3f& translation : translations) {
+        rotations.push_back(nnm::QuaternionF::from_axis_angle(translation.normalize(), translation.x));
+    }
+    const nnm::snapshot::Codec codec(0.001f);
+    std::vector<nnm::snapshot::State> baseline(count);
+    codec.quantize_batch(translations.data(), rotations.data(), count, baseline.data());
+    // Objects move a few centimeters between snapshots and a quarter of them also turn.
+    std::vector<nnm::Vector3f> moved(count);
+    std::vector<nnm::QuaternionF> turned = rotations;
+    for (size_t i = 0; i < count; ++i) {
+        moved[i] = translations[i] + motions[i];
+        if (i % 4 == 0) {
+            turned[i] = turned[i] * nnm::QuaternionF::from_axis_angle(motions[i].normalize(), 0.01f);
+        }
+    }
+    std::vector<nnm::snapshot::State> states(count);
+    codec.quantize_batch(moved.data(), turned.data(), count, states.data());
+    std::vector<uint8_t> bytes;
+
+    benchmark("snapshot::Codec::quantize_batch", count, [&] {
+        codec.quantize_batch(moved.data(), turned.data(), count, states.data());
+        keep(states[count / 2].x);
+    });
+    benchmark("snapshot::encode_delta", count, [&] {
+        nnm::snapshot::encode_delta(states.data(), count, baseline.data(), count, bytes);
+        keep(bytes.size());
+    });
+    benchmark("snapshot::decode_delta", count, [&] {
+        const auto decoded = nnm::snapshot::decode_delta(bytes.data(), bytes.size(), baseline.data(), count);
+        keep((*decoded)[count / 2].x);
+    });
+    std::printf(
+        "snapshot delta %zu bytes for %zu states of %zu bytes\n", bytes.size(), count, sizeof(nnm::snapshot::State));
+}
+
+inline void fixed_benchmarks()
+{
+    using nnm::Fixed16;
+    std::mt19937 generator(17); // NOLINT(*-msc51-cpp)
+    constexpr size_t count = 1 << 14;
+    const std::vector<nnm::Vector3f> points = random_points(generator, count, 100.0f);
+    std::vector<nnm::Vector3<Fixed16>> fixed_points;
+    fixed_points.reserve(count);
+    for (const nnm::Vector3f& point : points) {
+        fixed_points.emplace_back(Fixed16(point.x), Fixed16(point.y), Fixed16(point.z));
+    }
+    const auto transform = nnm::Transform3f::from_rotation_axis_angle({ 0.0f, 1.0f, 0.0f }, 0.5f)
+                               .translate({ 1.0f, 2.0f, 3.0f });
+    const auto fixed_transform
+        = nnm::Transform3<Fixed16>::from_rotation_axis_angle({ Fixed16(0), Fixed16(1), Fixed16(0) }, Fixed16(0.5))
+              .translate({ Fixed16(1), Fixed16(2), Fixed16(3) });
+    std::vector<nnm::Vector3f> results(count);
+    std::vector<nnm::Vector3<Fixed16>> fixed_results(count);
+
+    benchmark("transform_point_batch (float)", count, [&] {
+        nnm::transform_point_batch(transform, points.data(), count, results.data());
+        keep(results[count / 2].x);
+    });
+    benchmark("transform_point_batch (Fixed16)", count, [&] {
+        nnm::transform_point_batch(fixed_transform, fixed_points.data(), count, fixed_results.data());
+        keep(fixed_results[count / 2].x.raw);
+    });
+    benchmark("normalize_batch (float)", count, [&] {
+        nnm::normalize_batch(points.data(), count, results.data());
+        keep(results[count / 2].x);
+    });
+    benchmark("normalize_batch (Fixed16)", count, [&] {
+        nnm::normalize_batch(fixed_points.data(), count, fixed_results.data());
+        keep(fixed_results[count / 2].x.raw);
+    });
+    benchmark("sin + cos (float)", count, [&] {
+        float sum = 0.0f;
+        for (size_t i = 0; i < count; ++i) {
+            sum += nnm::sin(points[i].x) + nnm::cos(points[i].y);
+        }
+        keep(sum);
+    });
+    benchmark("sin + cos (Fixed16)", count, [&] {
+        Fixed16 sum;
+        for (size_t i = 0; i < count; ++i) {
+            sum += nnm::sin(fixed_points[i].x) + nnm::cos(fixed_points[i].y);
+        }
+        keep(sum.raw);
+    });
+    benchmark("atan2 (float)", count, [&] {
+        float sum = 0.0f;
+        for (size_t i = 0; i < count; ++i) {
+            sum += nnm::atan2(points[i].x, points[i].y);
+        }
+        keep(sum);
+    });
+    benchmark("atan2 (Fixed16)", count, [&] {
+        Fixed16 sum;
+        for (size_t i = 0; i < count; ++i) {
+            sum += nnm::atan2(fixed_points[i].x, fixed_points[i].y);
+        }
+        keep(sum.raw);
+    });
+}
+
+inline void rebase_benchmarks()
+{
+    constexpr size_t count = 1 << 16;
+    const nnm::Vector3d camera(1.0e8, -2.0e7, 4.0e6);
+    std::vector<nnm::Vector3d> positions(count);
+    std::vector<nnm::Transform3d> transforms(count);
+    for (size_t i = 0; i < count; ++i) {
+        positions[i] = camera + nnm::Vector3d(static_cast<double>(i), 0.5, -static_cast<double>(i) * 0.25);
+        transforms[i] = nnm::Transform3d::from_translation(positions[i]);
+    }
+    std::vector<nnm::Vector3f> results(count);
+    std::vector<nnm::Transform3f> transform_results(count);
+    std::vector<nnm::Vector3Split> splits(count);
+
+    benchmark("rebase_batch (Vector3d)", count, [&] {
+        nnm::rebase_batch(positions.data(), count, camera, results.data());
+        keep(results[count / 2].x);
+    });
+    benchmark("rebase_batch (Transform3d)", count, [&] {
+        nnm::rebase_batch(transforms.data(), count, camera, transform_results.data());
+        keep(transform_results[count / 2].matrix.columns[3].x);
+    });
+    benchmark("encode_batch (Vector3Split)", count, [&] {
+        nnm::encode_batch(positions.data(), count, splits.data());
+        keep(splits[count / 2].low.x);
+    });
+}
+
+inline void gpu_benchmarks()
+{
+    std::mt19937 generator(11); // NOLINT(*-msc51-cpp)
+    constexpr size_t count = 1 << 16;
+    const std::vector<nnm::Vector3f> points = random_points(generator, count, 100.0f);
+    std::vector<nnm::Transform3f> transforms;
+    std::vector<nnm::Basis3f> bases;
+    transforms.reserve(count);
+    bases.reserve(count);
+    for (size_t i = 0; i < count; ++i) {
+        const auto basis = nnm::Basis3f::from_rotation_axis_angle(points[(i + 1) % count].normalize(), points[i].x);
+        bases.push_back(basis);
+        transforms.push_back(nnm::Transform3f::from_basis_translation(basis, points[i]));
+    }
+    std::vector<std::byte> buffer(count * 64);
+
+    benchmark("gpu::write_array (Transform3f, std140)", count, [&] {
+        nnm::gpu::write_array(transforms.data(), count, nnm::gpu::Layout::std140, buffer.data());
+        keep(std::to_integer<int>(buffer[count * 32]));
+    });
+    benchmark("gpu::write_array (Transform3f, std140, row_major)", count, [&] {
+        nnm::gpu::write_array(
+            transforms.data(), count, nnm::gpu::Layout::std140, buffer.data(), nnm::gpu::MatrixOrder::row_major);
+        keep(std::to_integer<int>(buffer[count * 32]));
+    });
+    benchmark("gpu::write_array (Basis3f, std140)", count, [&] {
+        nnm::gpu::write_array(bases.data(), count, nnm::gpu::Layout::std140, buffer.data());
+        keep(std::to_integer<int>(buffer[count * 24]));
+    });
+    benchmark("gpu::write_array (Vector3f, std430)", count, [&] {
+        nnm::gpu::write_array(points.data(), count, nnm::gpu::Layout::std430, buffer.data());
+        keep(std::to_integer<int>(buffer[count * 8]));
+    });
+}
+
+inline void point_cloud_benchmarks()
+{
+    const char* input_path = "nnm_benchmark_points.bin";
+    const char* output_path = "nnm_benchmark_points_transformed.bin";
+    std::mt19937 generator(13); // NOLINT(*-msc51-cpp)
+    constexpr size_t point_count = 1 << 22;
+    {
+        const std::vector<nnm::Vector3f> points = random_points(generator, point_count, 1000.0f);
+        std::FILE* file = std::fopen(input_path, "wb");
+        if (file == nullptr) {
+            return;
+        }
+        std::fwrite(points.data(), sizeof(nnm::Vector3f), point_count, file);
+        std::fclose(file);
+    }
+    const auto transform = nnm::Transform3f::from_rotation_axis_angle({ 0.0f, 1.0f, 0.0f }, 0.5f)
+                               .translate({ 1.0f, 2.0f, 3.0f });
+    for (size_t thread_count = 1; thread_count <= nnm::parallel::default_thread_count(); thread_count *= 2) {
+        nnm::parallel::ThreadPool pool(thread_count);
+        const double nanoseconds = benchmark(
+            "point_cloud::transform_file (" + std::to_string(thread_count) + " threads)", point_count, [&] {
+                const auto bounds = nnm::point_cloud::transform_file(pool, transform, input_path, output_path);
+                keep(bounds.has_value() ? bounds->max.x : 0.0f);
+            });
+        // Each point is read once and written once.
+        std::printf("point_cloud::transform_file %.2f GB/s\n", 2.0 * sizeof(nnm::Vector3f) / nanoseconds);
+    }
+    std::remove(input_path);
+    std::remove(output_path);
+}
+
+inline void half_benchmarks()
+{
+#if defined(__FLT16_MAX__)
+    std::mt19937 generator(11); // NOLINT(*-msc51-cpp)
+    constexpr size_t point_count = 1 << 18;
+    const std::vector<nnm::Vector3f> points = random_points(generator, point_count, 10.0f);
+    std::vector<nnm::Vector3f16> half_points(point_count);
+    for (size_t i = 0; i < point_count; ++i) {
+        half_points[i] = nnm::Vector3f16(points[i]);
+    }
+    std::vector<nnm::Vector3f16> results(point_count);
+    const auto transform = nnm::Transform3f::from_rotation_axis_angle(nnm::Vector3f::axis_y(), 0.5f)
+                               .translate({ 4.0f, 5.0f, 6.0f });
+    const nnm::Transform3f16 half_transform(transform);
+    const std::pair<nnm::dispatch::Isa, std::string> isas[4] { { nnm::dispatch::Isa::baseline, "baseline" },
+                                                               { nnm::dispatch::Isa::avx2, "avx2" },
+                                                               { nnm::dispatch::Isa::avx512, "avx512" },
+                                                               { nnm::dispatch::Isa::avx512fp16, "avx512fp16" } };
+
+    for (const auto& [isa, name] : isas) {
+        if (!nnm::dispatch::supported(isa)) {
+            continue;
+        }
+        benchmark("dispatch::transform_point_batch (f16, " + name + ")", point_count, [&] {
+            nnm::dispatch::transform_point_batch(
+                isa, half_transform, half_points.data(), point_count, results.data());
+            keep(static_cast<float>(results[point_count / 2].x));
+        });
+    }
+#endif
+}
+
+inline void matrix_benchmarks()
+{
+    std::mt19937 generator(12); // NOLINT(*-msc51-cpp)
+    constexpr size_t count = 4096;
+    const std::vector<nnm::Vector3f> points = random_points(generator, count * 5, 1.0f);
+    std::vector<nnm::Matrix3f> matrices3;
+    std::vector<nnm::Matrix4f> matrices4;
+    std::vector<nnm::Vector4f> vectors4;
+    std::vector<nnm::Transform3f> transforms;
+    matrices3.reserve(count);
+    matrices4.reserve(count);
+    vectors4.reserve(count);
+    transforms.reserve(count);
+    for (size_t i = 0; i < count; ++i) {
+        const nnm::Vector3f* p = points.data() + i * 5;
+        matrices3.emplace_back(p[0], p[1], p[2]);
+        matrices4.emplace_back(
+            nnm::Vector4f(p[0], p[3].x),
+            nnm::Vector4f(p[1], p[3].y),
+            nnm::Vector4f(p[2], p[3].z),
+            nnm::Vector4f(p[4], 1.0f));
+        vectors4.emplace_back(p[4], 1.0f);
+        transforms.push_back(nnm::Transform3f::from_rotation_axis_angle(p[0].normalize(), p[1].x).translate(p[2]));
+    }
+    std::vector<nnm::Matrix3f> results3(count);
+    std::vector<nnm::Matrix4f> results4(count);
+    std::vector<nnm::Vector3f> results_vectors3(count);
+    std::vector<nnm::Vector4f> results_vectors4(count);
+
+    benchmark("Matrix3f * Matrix3f", count, [&] {
+        for (size_t i = 0; i < count; ++i) {
+            results3[i] = matrices3[i] * matrices3[count - 1 - i];
+        }
+        keep(results3[count / 2].at(1, 1));
+    });
+    benchmark("Matrix3f * Vector3f", count, [&] {
+        for (size_t i = 0; i < count; ++i) {
+            results_vectors3[i] = matrices3[i] * points[i];
+        }
+        keep(results_vectors3[count / 2].y);
+    });
+    benchmark("Matrix3f::transpose", count, [&] {
+        for (size_t i = 0; i < count; ++i) {
+            results3[i] = matrices3[i].transpose();
+        }
+        keep(results3[count / 2].at(1, 0));
+    });
+    benchmark("Matrix4f * Matrix4f", count, [&] {
+        for (size_t i = 0; i < count; ++i) {
+            results4[i] = matrices4[i] * matrices4[count - 1 - i];
+        }
+        keep(results4[count / 2].at(1, 1));
+    });
+    benchmark("Matrix4f * Vector4f", count, [&] {
+        for (size_t i = 0; i < count; ++i) {
+            results_vectors4[i] = matrices4[i] * vectors4[i];
+        }
+        keep(results_vectors4[count / 2].y);
+    });
+    benchmark("Matrix4f::transpose", count, [&] {
+        for (size_t i = 0; i < count; ++i) {
+            results4[i] = matrices4[i].transpose();
+        }
+        keep(results4[count / 2].at(1, 0));
+    });
+    benchmark("Matrix3f::unchecked_inverse", count, [&] {
+        for (size_t i = 0; i < count; ++i) {
+            results3[i] = matrices3[i].unchecked_inverse();
+        }
+        keep(results3[count / 2].at(1, 1));
+    });
+    benchmark("Matrix4f::unchecked_inverse", count, [&] {
+        for (size_t i = 0; i < count; ++i) {
+            results4[i] = matrices4[i].unchecked_inverse();
+        }
+        keep(results4[count / 2].at(1, 1));
+    });
+    benchmark("Vector3f::transform (Transform3f)", count, [&] {
+        for (size_t i = 0; i < count; ++i) {
+            results_vectors3[i] = points[i].transform(transforms[i]);
+        }
+        keep(results_vectors3[count / 2].y);
+    });
+}
+
+inline void nnm_benchmarks()
+{
+    ray_benchmarks();
+    plane_benchmarks();
+    parallel_benchmarks();
+    reduction_benchmarks();
+    decomposition_benchmarks();
+    obb_benchmarks();
+    dispatch_benchmarks();
+    wide_benchmarks();
+    aligned_benchmarks();
+    quantized_benchmarks();
+    snapshot_benchmarks();
+    fixed_benchmarks();
+    rebase_benchmarks();
+    gpu_benchmarks();
+    point_cloud_benchmarks();
+    half_benchmarks();
+    matrix_benchmarks();
+}
+
+#endif
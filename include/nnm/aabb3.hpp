@@ -0,0 +1,172 @@
+/* NNM - "No Nonsense Math"
+ * v0.5.0
+ * Copyright (c) 2025-present Matthew Oros
+ * Licensed under MIT
+ */
+
+#ifndef NNM_AABB3_HPP
+#define NNM_AABB3_HPP
+
+#include <nnm/vector3.hpp>
+
+#include <cstddef>
+
+namespace nnm {
+
+/**
+ * Three-dimensional axis-aligned bounding box.
+ * @tparam Real Floating-point type.
+ */
+template <typename Real>
+class AABB3 {
+public:
+    /**
+     * Minimum corner.
+     */
+    Vector3<Real> min;
+
+    /**
+     * Maximum corner.
+     */
+    Vector3<Real> max;
+
+    /**
+     * Initialize with zero size at the origin.
+     */
+    constexpr AABB3()
+        : min(Vector3<Real>::zero())
+        , max(Vector3<Real>::zero())
+    {
+    }
+
+    /**
+     * Cast from other box.
+     * @tparam Other Other type.
+     * @param box Other box.
+     */
+    template <typename Other>
+    explicit constexpr AABB3(const AABB3<Other>& box)
+        : min(Vector3<Real>(box.min))
+        , max(Vector3<Real>(box.max))
+    {
+    }
+
+    /**
+     * Initialize with corners.
+     * @param min Minimum corner.
+     * @param max Maximum corner.
+     */
+    constexpr AABB3(const Vector3<Real>& min, const Vector3<Real>& max)
+        : min(min)
+        , max(max)
+    {
+    }
+
+    /**
+     * Smallest box that contains a set of points.
+     * @param points Points.
+     * @param count Number of points.
+     * @return Result which has zero size at the origin if there are no points.
+     */
+    static constexpr AABB3 from_points(const Vector3<Real>* points, const size_t count)
+    {
+        if (count == 0) {
+            return AABB3();
+        }
+        AABB3 result { points[0], points[0] };
+        for (size_t i = 1; i < count; ++i) {
+            result.min.x = nnm::min(result.min.x, points[i].x);
+            result.min.y = nnm::min(result.min.y, points[i].y);
+            result.min.z = nnm::min(result.min.z, points[i].z);
+            result.max.x = nnm::max(result.max.x, points[i].x);
+            result.max.y = nnm::max(result.max.y, points[i].y);
+            result.max.z = nnm::max(result.max.z, points[i].z);
+        }
+        return result;
+    }
+
+    /**
+     * Center position.
+     * @return Result.
+     */
+    [[nodiscard]] constexpr Vector3<Real> center() const
+    {
+        return (min + max) / static_cast<Real>(2);
+    }
+
+    /**
+     * Size along each axis.
+     * @return Result.
+     */
+    [[nodiscard]] constexpr Vector3<Real> size() const
+    {
+        return max - min;
+    }
+
+    /**
+     * Determines if a point is inside or on the surface of the box.
+     * @param point Point.
+     * @return True if contained, false otherwise.
+     */
+    [[nodiscard]] constexpr bool contains(const Vector3<Real>& point) const
+    {
+        return point.x >= min.x && point.y >= min.y && point.z >= min.z && point.x <= max.x && point.y <= max.y
+            && point.z <= max.z;
+    }
+
+    /**
+     * Determines if the box overlaps another box.
+     * @param other Other box.
+     * @return True if overlapping, false otherwise.
+     */
+    [[nodiscard]] constexpr bool intersects(const AABB3& other) const
+    {
+        return min.x <= other.max.x && min.y <= other.max.y && min.z <= other.max.z && max.x >= other.min.x
+            && max.y >= other.min.y && max.z >= other.min.z;
+    }
+
+    /**
+     * Smallest box that contains both the box and another box.
+     * @param other Other box.
+     * @return Result.
+     */
+    [[nodiscard]] constexpr AABB3 merge(const AABB3& other) const
+    {
+        return { { nnm::min(min.x, other.min.x), nnm::min(min.y, other.min.y), nnm::min(min.z, other.min.z) },
+                 { nnm::max(max.x, other.max.x), nnm::max(max.y, other.max.y), nnm::max(max.z, other.max.z) } };
+    }
+
+    /**
+     * Determines if approximately equal to another box.
+     * @param other Other box.
+     * @return True if approximately equal, false otherwise.
+     */
+    [[nodiscard]] constexpr bool approx_equal(const AABB3& other) const
+    {
+        return min.approx_equal(other.min) && max.approx_equal(other.max);
+    }
+
+    /**
+     * Equality.
+     * @param other Other box.
+     * @return True if equal, false otherwise.
+     */
+    [[nodiscard]] constexpr bool operator==(const AABB3& other) const
+    {
+        return min == other.min && max == other.max;
+    }
+
+    /**
+     * Inequality.
+     * @param other Other box.
+     * @return True if not equal, false otherwise.
+     */
+    [[nodiscard]] constexpr bool operator!=(const AABB3& other) const
+    {
+        return min != other.min || max != other.max;
+    }
+};
+
+}
+
+#endif
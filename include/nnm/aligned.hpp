@@ -0,0 +1,159 @@
+/* NNM - "No Nonsense Math"
+ * v0.5.0
+ * Copyright (c) 2025-present Matthew Oros
+ * Licensed under MIT
+ */
+
+#ifndef NNM_ALIGNED_HPP
+#define NNM_ALIGNED_HPP
+
+#include <nnm/matrix4.hpp>
+#include <nnm/transform3.hpp>
+#include <nnm/vector3.hpp>
+#include <nnm/vector4.hpp>
+
+namespace nnm {
+
+/**
+ * Three-dimensional vector padded to four components and aligned to their size so that arrays of it can be read and
+ * written with aligned vector loads and stores. Used for storage and batch functions with Vector3 used for math.
+ * @tparam Real Floating-point type.
+ */
+template <typename Real>
+class alignas(sizeof(Real) * 4) Vector3A {
+public:
+    Real x;
+    Real y;
+    Real z;
+    Real padding;
+
+    /**
+     * Initializes all components to zero.
+     */
+    constexpr Vector3A()
+        : x { static_cast<Real>(0) }
+        , y { static_cast<Real>(0) }
+        , z { static_cast<Real>(0) }
+        , padding { static_cast<Real>(0) }
+    {
+    }
+
+    /**
+     * Converts from an unaligned vector.
+     * @param vector Vector.
+     */
+    explicit constexpr Vector3A(const Vector3<Real>& vector)
+        : x { vector.x }
+        , y { vector.y }
+        , z { vector.z }
+        , padding { static_cast<Real>(0) }
+    {
+    }
+
+    /**
+     * Initialize with components.
+     * @param x X component.
+     * @param y Y component.
+     * @param z Z component.
+     */
+    constexpr Vector3A(const Real x, const Real y, const Real z)
+        : x { x }
+        , y { y }
+        , z { z }
+        , padding { static_cast<Real>(0) }
+    {
+    }
+
+    /**
+     * Determines if all components are approximately equal to another vector's components.
+     * @param other Other vector.
+     * @return True if approximately equal, false otherwise.
+     */
+    [[nodiscard]] constexpr bool approx_equal(const Vector3A& other) const
+    {
+        return nnm::approx_equal(x, other.x) && nnm::approx_equal(y, other.y) && nnm::approx_equal(z, other.z);
+    }
+
+    /**
+     * Equality of components, ignoring padding.
+     * @param other Other vector.
+     * @return True if equal, false otherwise.
+     */
+    [[nodiscard]] constexpr bool operator==(const Vector3A& other) const
+    {
+        return x == other.x && y == other.y && z == other.z;
+    }
+
+    /**
+     * Inequality of components, ignoring padding.
+     * @param other Other vector.
+     * @return True if not equal, false otherwise.
+     */
+    [[nodiscard]] constexpr bool operator!=(const Vector3A& other) const
+    {
+        return !(*this == other);
+    }
+};
+
+/**
+ * Four-dimensional vector aligned to its size. It has the same size as Vector4 and converts to and from it implicitly.
+ * @tparam Real Floating-point type.
+ */
+template <typename Real>
+class alignas(sizeof(Real) * 4) Vector4A : public Vector4<Real> {
+public:
+    using Vector4<Real>::Vector4;
+
+    /**
+     * Converts from an unaligned vector.
+     * @param vector Vector.
+     */
+    constexpr Vector4A(const Vector4<Real>& vector) // NOLINT(*-explicit-constructor)
+        : Vector4<Real>(vector)
+    {
+    }
+};
+
+/**
+ * 4x4 matrix with columns aligned to their size. It has the same size as Matrix4 and converts to and from it
+ * implicitly.
+ * @tparam Real Floating-point type.
+ */
+template <typename Real>
+class alignas(sizeof(Real) * 4) Matrix4A : public Matrix4<Real> {
+public:
+    using Matrix4<Real>::Matrix4;
+
+    /**
+     * Converts from an unaligned matrix.
+     * @param matrix Matrix.
+     */
+    constexpr Matrix4A(const Matrix4<Real>& matrix) // NOLINT(*-explicit-constructor)
+        : Matrix4<Real>(matrix)
+    {
+    }
+};
+
+/**
+ * Three-dimensional transform with columns aligned to their size. It has the same size as Transform3 and converts to
+ * and from it implicitly.
+ * @tparam Real Floating-point type.
+ */
+template <typename Real>
+class alignas(sizeof(Real) * 4) Transform3A : public Transform3<Real> {
+public:
+    using Transform3<Real>::Transform3;
+
+    /**
+     * Converts from an unaligned transform.
+     * @param transform Transform.
+     */
+    constexpr Transform3A(const Transform3<Real>& transform) // NOLINT(*-explicit-constructor)
+        : Transform3<Real>(transform)
+    {
+    }
+};
+
+}
+
+#endif
@@ -0,0 +1,583 @@
+/* NNM - "No Nonsense Math"
+ * v0.5.0
+ * Copyright (c) 2025-present Matthew Oros
+ * Licensed under MIT
+ */
+
+#ifndef NNM_BATCH_HPP
+#define NNM_BATCH_HPP
+
+#include <nnm/aligned.hpp>
+#include <nnm/basis3.hpp>
+#include <nnm/compressed.hpp>
+#include <nnm/matrix3.hpp>
+#include <nnm/obb3.hpp>
+#include <nnm/plane3.hpp>
+#include <nnm/quaternion.hpp>
+#include <nnm/strided_span.hpp>
+#include <nnm/transform3.hpp>
+#include <nnm/vector2i.hpp>
+#include <nnm/vector3.hpp>
+
+#include <cstddef>
+#include <cstdint>
+
+namespace nnm {
+
+/**
+ * Normalize many vectors.
+ * @tparam Real Floating-point type.
+ * @param vectors Vectors.
+ * @param count Number of vectors.
+ * @param results Output of each normalized vector which must hold count elements.
+ */
+template <typename Real>
+void normalize_batch(const Vector3<Real>* vectors, const size_t count, Vector3<Real>* results)
+{
+    for (size_t i = 0; i < count; ++i) {
+        results[i] = vectors[i].normalize();
+    }
+}
+
+/**
+ * Normalize many vectors in strided views.
+ * @tparam Real Floating-point type.
+ * @param vectors Vectors.
+ * @param results Output of each normalized vector which must hold as many elements as vectors.
+ */
+template <typename Real>
+void normalize_batch(const StridedSpan<const Vector3<Real>> vectors, const StridedSpan<Vector3<Real>> results)
+{
+    for (size_t i = 0; i < vectors.count; ++i) {
+        results.store(i, vectors.load(i).normalize());
+    }
+}
+
+/**
+ * Normalize many padded vectors.
+ * @tparam Real Floating-point type.
+ * @param vectors Vectors.
+ * @param count Number of vectors.
+ * @param results Output of each normalized vector which must hold count elements.
+ */
+template <typename Real>
+void normalize_batch(const Vector3A<Real>* vectors, const size_t count, Vector3A<Real>* results)
+{
+    for (size_t i = 0; i < count; ++i) {
+        results[i] = Vector3A<Real>(Vector3<Real>(vectors[i]).normalize());
+    }
+}
+
+/**
+ * Transform many points.
+ * @tparam Real Floating-point type.
+ * @param by Transform.
+ * @param points Points.
+ * @param count Number of points.
+ * @param results Output of each transformed point which must hold count elements.
+ */
+template <typename Real>
+constexpr void transform_point_batch(
+    const Transform3<Real>& by, const Vector3<Real>* points, const size_t count, Vector3<Real>* results)
+{
+    const Vector4<Real>* columns = by.matrix.columns;
+    for (size_t i = 0; i < count; ++i) {
+        const Vector3<Real>& point = points[i];
+        results[i] = (columns[0] * point.x + columns[1] * point.y + columns[2] * point.z + columns[3]).xyz();
+    }
+}
+
+/**
+ * Transform many points in strided views.
+ * @tparam Real Floating-point type.
+ * @param by Transform.
+ * @param points Points.
+ * @param results Output of each transformed point which must hold as many elements as points.
+ */
+template <typename Real>
+void transform_point_batch(
+    const Transform3<Real>& by, const StridedSpan<const Vector3<Real>> points, const StridedSpan<Vector3<Real>> results)
+{
+    const Vector4<Real>* columns = by.matrix.columns;
+    for (size_t i = 0; i < points.count; ++i) {
+        const Vector3<Real> point = points.load(i);
+        results.store(i, (columns[0] * point.x + columns[1] * point.y + columns[2] * point.z + columns[3]).xyz());
+    }
+}
+
+/**
+ * Transform many padded points. Each point is computed as a whole four-component vector matching the padded layout so
+ * that loads and stores are single aligned vector moves. The fourth lane of the transform is zeroed so padding stays
+ * zero.
+ * @tparam Real Floating-point type.
+ * @param by Transform.
+ * @param points Points.
+ * @param count Number of points.
+ * @param results Output of each transformed point which must hold count elements.
+ */
+template <typename Real>
+constexpr void transform_point_batch(
+    const Transform3<Real>& by, const Vector3A<Real>* points, const size_t count, Vector3A<Real>* results)
+{
+    Vector4<Real> columns[4];
+    for (uint8_t c = 0; c < 4; ++c) {
+        columns[c] = { by.matrix.columns[c].xyz(), static_cast<Real>(0) };
+    }
+    for (size_t i = 0; i < count; ++i) {
+        const Vector3A<Real>& point = points[i];
+        const Vector4<Real> result = columns[0] * point.x + columns[1] * point.y + columns[2] * point.z + columns[3];
+        Vector3A<Real>& output = results[i];
+        output.x = result.x;
+        output.y = result.y;
+        output.z = result.z;
+        output.padding = result.w;
+    }
+}
+
+/**
+ * Compose many pairs of transforms such as local transforms with the world transforms of their parents.
+ * @tparam Real Floating-point type.
+ * @param transforms Transforms.
+ * @param by Transforms to apply after each of the transforms.
+ * @param count Number of transforms.
+ * @param results Output of each composed transform which must hold count elements.
+ */
+template <typename Real>
+constexpr void transform_batch(
+    const Transform3<Real>* transforms, const Transform3<Real>* by, const size_t count, Transform3<Real>* results)
+{
+    for (size_t i = 0; i < count; ++i) {
+        results[i] = transforms[i].transform(by[i]);
+    }
+}
+
+/**
+ * Eigen-decomposition of many symmetric 3x3 matrices.
+ * @tparam Real Floating-point type.
+ * @param matrices Symmetric matrices of which only the lower triangles are read.
+ * @param count Number of matrices.
+ * @param results Output for each decomposition which must hold count elements.
+ */
+template <typename Real>
+void symmetric_eigen_batch(
+    const Matrix3<Real>* matrices, const size_t count, typename Matrix3<Real>::SymmetricEigen* results)
+{
+    for (size_t i = 0; i < count; ++i) {
+        results[i] = matrices[i].symmetric_eigen();
+    }
+}
+
+/**
+ * Singular value decomposition of many 3x3 matrices.
+ * @tparam Real Floating-point type.
+ * @param matrices Matrices.
+ * @param count Number of matrices.
+ * @param results Output for each decomposition which must hold count elements.
+ */
+template <typename Real>
+void singular_value_decomposition_batch(
+    const Matrix3<Real>* matrices, const size_t count, typename Matrix3<Real>::SingularValueDecomposition* results)
+{
+    for (size_t i = 0; i < count; ++i) {
+        results[i] = matrices[i].singular_value_decomposition();
+    }
+}
+
+/**
+ * Orthonormalize many bases to their closest rotations.
+ * @tparam Real Floating-point type.
+ * @param bases Bases to orthonormalize in place.
+ * @param count Number of bases.
+ */
+template <typename Real>
+void orthonormalize_batch(Basis3<Real>* bases, const size_t count)
+{
+    for (size_t i = 0; i < count; ++i) {
+        bases[i] = bases[i].orthonormalize();
+    }
+}
+
+/**
+ * Overlap tests between many pairs of oriented bounding boxes.
+ * @tparam Real Floating-point type.
+ * @param boxes Boxes.
+ * @param pairs Indices into boxes of each candidate pair.
+ * @param count Number of pairs.
+ * @param results Output of whether each pair overlaps which must hold count elements.
+ */
+template <typename Real>
+void intersects_batch(const OBB3<Real>* boxes, const Vector2u32* pairs, const size_t count, bool* results)
+{
+    for (size_t i = 0; i < count; ++i) {
+        results[i] = boxes[pairs[i].x].intersects(boxes[pairs[i].y]);
+    }
+}
+
+/**
+ * Signed distances of many points to a plane.
+ * @tparam Real Floating-point type.
+ * @param plane Plane with a normalized normal.
+ * @param points Points.
+ * @param count Number of points.
+ * @param results Output of each signed distance which must hold count elements.
+ */
+template <typename Real>
+void signed_distance_batch(const Plane3<Real>& plane, const Vector3<Real>* points, const size_t count, Real* results)
+{
+    for (size_t i = 0; i < count; ++i) {
+        results[i] = plane.signed_distance(points[i]);
+    }
+}
+
+/**
+ * Signed distances of many points in a strided view to a plane.
+ * @tparam Real Floating-point type.
+ * @param plane Plane with a normalized normal.
+ * @param points Points.
+ * @param results Output of each signed distance which must hold as many elements as points.
+ */
+template <typename Real>
+void signed_distance_batch(
+    const Plane3<Real>& plane, const StridedSpan<const Vector3<Real>> points, const StridedSpan<Real> results)
+{
+    for (size_t i = 0; i < points.count; ++i) {
+        results.store(i, plane.signed_distance(points.load(i)));
+    }
+}
+
+/**
+ * Encode many vectors to half precision.
+ * @param vectors Vectors.
+ * @param count Number of vectors.
+ * @param results Output of each encoded vector which must hold count elements.
+ */
+inline void encode_batch(const Vector3f* vectors, const size_t count, Vector3h* results)
+{
+    for (size_t i = 0; i < count; ++i) {
+        results[i] = Vector3h(vectors[i]);
+    }
+}
+
+/**
+ * Decode many half-precision vectors.
+ * @param vectors Encoded vectors.
+ * @param count Number of vectors.
+ * @param results Output of each decoded vector which must hold count elements.
+ */
+inline void decode_batch(const Vector3h* vectors, const size_t count, Vector3f* results)
+{
+    for (size_t i = 0; i < count; ++i) {
+        results[i] = vectors[i].decode();
+    }
+}
+
+/**
+ * Encode many vectors in strided views to half precision.
+ * @param vectors Vectors.
+ * @param results Output of each encoded vector which must hold as many elements as vectors.
+ */
+inline void encode_batch(const StridedSpan<const Vector3f> vectors, const StridedSpan<Vector3h> results)
+{
+    for (size_t i = 0; i < vectors.count; ++i) {
+        results.store(i, Vector3h(vectors.load(i)));
+    }
+}
+
+/**
+ * Decode many half-precision vectors in strided views.
+ * @param vectors Encoded vectors.
+ * @param results Output of each decoded vector which must hold as many elements as vectors.
+ */
+inline void decode_batch(const StridedSpan<const Vector3h> vectors, const StridedSpan<Vector3f> results)
+{
+    for (size_t i = 0; i < vectors.count; ++i) {
+        results.store(i, vectors.load(i).decode());
+    }
+}
+
+/**
+ * Encode many vectors to signed normalized 16-bit integers.
+ * @param vectors Vectors.
+ * @param count Number of vectors.
+ * @param results Output of each encoded vector which must hold count elements.
+ */
+inline void encode_batch(const Vector3f* vectors, const size_t count, Vector3snorm16* results)
+{
+    for (size_t i = 0; i < count; ++i) {
+        results[i] = Vector3snorm16(vectors[i]);
+    }
+}
+
+/**
+ * Decode many signed normalized 16-bit vectors.
+ * @param vectors Encoded vectors.
+ * @param count Number of vectors.
+ * @param results Output of each decoded vector which must hold count elements.
+ */
+inline void decode_batch(const Vector3snorm16* vectors, const size_t count, Vector3f* results)
+{
+    for (size_t i = 0; i < count; ++i) {
+        results[i] = vectors[i].decode();
+    }
+}
+
+/**
+ * Encode many vectors in strided views to signed normalized 16-bit integers.
+ * @param vectors Vectors.
+ * @param results Output of each encoded vector which must hold as many elements as vectors.
+ */
+inline void encode_batch(const StridedSpan<const Vector3f> vectors, const StridedSpan<Vector3snorm16> results)
+{
+    for (size_t i = 0; i < vectors.count; ++i) {
+        results.store(i, Vector3snorm16(vectors.load(i)));
+    }
+}
+
+/**
+ * Decode many signed normalized 16-bit vectors in strided views.
+ * @param vectors Encoded vectors.
+ * @param results Output of each decoded vector which must hold as many elements as vectors.
+ */
+inline void decode_batch(const StridedSpan<const Vector3snorm16> vectors, const StridedSpan<Vector3f> results)
+{
+    for (size_t i = 0; i < vectors.count; ++i) {
+        results.store(i, vectors.load(i).decode());
+    }
+}
+
+/**
+ * Encode many vectors to unsigned normalized 8-bit integers.
+ * @param vectors Vectors.
+ * @param count Number of vectors.
+ * @param results Output of each encoded vector which must hold count elements.
+ */
+inline void encode_batch(const Vector4f* vectors, const size_t count, Vector4unorm8* results)
+{
+    for (size_t i = 0; i < count; ++i) {
+        results[i] = Vector4unorm8(vectors[i]);
+    }
+}
+
+/**
+ * Decode many unsigned normalized 8-bit vectors.
+ * @param vectors Encoded vectors.
+ * @param count Number of vectors.
+ * @param results Output of each decoded vector which must hold count elements.
+ */
+inline void decode_batch(const Vector4unorm8* vectors, const size_t count, Vector4f* results)
+{
+    for (size_t i = 0; i < count; ++i) {
+        results[i] = vectors[i].decode();
+    }
+}
+
+/**
+ * Encode many vectors in strided views to unsigned normalized 8-bit integers.
+ * @param vectors Vectors.
+ * @param results Output of each encoded vector which must hold as many elements as vectors.
+ */
+inline void encode_batch(const StridedSpan<const Vector4f> vectors, const StridedSpan<Vector4unorm8> results)
+{
+    for (size_t i = 0; i < vectors.count; ++i) {
+        results.store(i, Vector4unorm8(vectors.load(i)));
+    }
+}
+
+/**
+ * Decode many unsigned normalized 8-bit vectors in strided views.
+ * @param vectors Encoded vectors.
+ * @param results Output of each decoded vector which must hold as many elements as vectors.
+ */
+inline void decode_batch(const StridedSpan<const Vector4unorm8> vectors, const StridedSpan<Vector4f> results)
+{
+    for (size_t i = 0; i < vectors.count; ++i) {
+        results.store(i, vectors.load(i).decode());
+    }
+}
+
+/**
+ * Encode many unit vectors to octahedral signed normalized 16-bit integers rounding each component to the nearest step.
+ * @param normals Unit vectors.
+ * @param count Number of vectors.
+ * @param results Output of each encoded vector which must hold count elements.
+ */
+inline void encode_batch(const Vector3f* normals, const size_t count, Vector3oct16* results)
+{
+    for (size_t i = 0; i < count; ++i) {
+        results[i] = Vector3oct16(normals[i]);
+    }
+}
+
+/**
+ * Encode many unit vectors to octahedral signed normalized 16-bit integers with Vector3oct16::precise.
+ * @param normals Unit vectors.
+ * @param count Number of vectors.
+ * @param results Output of each encoded vector which must hold count elements.
+ */
+inline void encode_precise_batch(const Vector3f* normals, const size_t count, Vector3oct16* results)
+{
+    for (size_t i = 0; i < count; ++i) {
+        results[i] = Vector3oct16::precise(normals[i]);
+    }
+}
+
+/**
+ * Decode many octahedral unit vectors.
+ * @param normals Encoded unit vectors.
+ * @param count Number of vectors.
+ * @param results Output of each decoded unit vector which must hold count elements.
+ */
+inline void decode_batch(const Vector3oct16* normals, const size_t count, Vector3f* results)
+{
+    for (size_t i = 0; i < count; ++i) {
+        results[i] = normals[i].decode();
+    }
+}
+
+/**
+ * Encode many unit vectors in strided views to octahedral signed normalized 16-bit integers rounding each component to
+ * the nearest step.
+ * @param normals Unit vectors.
+ * @param results Output of each encoded vector which must hold as many elements as normals.
+ */
+inline void encode_batch(const StridedSpan<const Vector3f> normals, const StridedSpan<Vector3oct16> results)
+{
+    for (size_t i = 0; i < normals.count; ++i) {
+        results.store(i, Vector3oct16(normals.load(i)));
+    }
+}
+
+/**
+ * Encode many unit vectors in strided views to octahedral signed normalized 16-bit integers with Vector3oct16::precise.
+ * @param normals Unit vectors.
+ * @param results Output of each encoded vector which must hold as many elements as normals.
+ */
+inline void encode_precise_batch(const StridedSpan<const Vector3f> normals, const StridedSpan<Vector3oct16> results)
+{
+    for (size_t i = 0; i < normals.count; ++i) {
+        results.store(i, Vector3oct16::precise(normals.load(i)));
+    }
+}
+
+/**
+ * Decode many octahedral unit vectors in strided views.
+ * @param normals Encoded unit vectors.
+ * @param results Output of each decoded unit vector which must hold as many elements as normals.
+ */
+inline void decode_batch(const StridedSpan<const Vector3oct16> normals, const StridedSpan<Vector3f> results)
+{
+    for (size_t i = 0; i < normals.count; ++i) {
+        results.store(i, normals.load(i).decode());
+    }
+}
+
+/**
+ * Pack many unit quaternions.
+ * @tparam Bits Total number of bits of each packed quaternion.
+ * @param quaternions Unit quaternions.
+ * @param count Number of quaternions.
+ * @param results Output of each packed quaternion which must hold count elements.
+ */
+template <uint8_t Bits>
+void encode_batch(const QuaternionF* quaternions, const size_t count, QuaternionPacked<Bits>* results)
+{
+    for (size_t i = 0; i < count; ++i) {
+        results[i] = QuaternionPacked<Bits>(quaternions[i]);
+    }
+}
+
+/**
+ * Unpack many quaternions.
+ * @tparam Bits Total number of bits of each packed quaternion.
+ * @param quaternions Packed quaternions.
+ * @param count Number of quaternions.
+ * @param results Output of each unit quaternion which must hold count elements.
+ */
+template <uint8_t Bits>
+void decode_batch(const QuaternionPacked<Bits>* quaternions, const size_t count, QuaternionF* results)
+{
+    for (size_t i = 0; i < count; ++i) {
+        results[i] = quaternions[i].decode();
+    }
+}
+
+/**
+ * Converts many positions to single precision relative to an origin such as a camera position. Each difference is
+ * computed in the precision of the positions before it is rounded so positions near the origin keep full single
+ * precision regardless of how far the origin is from zero.
+ * @tparam Real Floating-point type of the results.
+ * @tparam Wide Floating-point type of the positions.
+ * @param positions Positions.
+ * @param count Number of positions.
+ * @param origin Origin.
+ * @param results Output of each relative position which must hold count elements.
+ */
+template <typename Real, typename Wide>
+void rebase_batch(
+    const Vector3<Wide>* positions, const size_t count, const Vector3<Wide>& origin, Vector3<Real>* results)
+{
+    for (size_t i = 0; i < count; ++i) {
+        results[i].x = static_cast<Real>(positions[i].x - origin.x);
+        results[i].y = static_cast<Real>(positions[i].y - origin.y);
+        results[i].z = static_cast<Real>(positions[i].z - origin.z);
+    }
+}
+
+/**
+ * Converts many transforms to single precision relative to an origin such as a camera position. The translation is
+ * subtracted in the precision of the transforms before it is rounded and the rest of the matrix is rounded as is.
+ * @tparam Real Floating-point type of the results.
+ * @tparam Wide Floating-point type of the transforms.
+ * @param transforms Transforms.
+ * @param count Number of transforms.
+ * @param origin Origin.
+ * @param results Output of each relative transform which must hold count elements.
+ */
+template <typename Real, typename Wide>
+void rebase_batch(
+    const Transform3<Wide>* transforms, const size_t count, const Vector3<Wide>& origin, Transform3<Real>* results)
+{
+    for (size_t i = 0; i < count; ++i) {
+        const Matrix4<Wide>& matrix = transforms[i].matrix;
+        Matrix4<Real>& result = results[i].matrix;
+        for (uint8_t c = 0; c < 3; ++c) {
+            for (uint8_t r = 0; r < 4; ++r) {
+                result.columns[c][r] = static_cast<Real>(matrix.columns[c][r]);
+            }
+        }
+        result.columns[3].x = static_cast<Real>(matrix.columns[3].x - origin.x);
+        result.columns[3].y = static_cast<Real>(matrix.columns[3].y - origin.y);
+        result.columns[3].z = static_cast<Real>(matrix.columns[3].z - origin.z);
+        result.columns[3].w = static_cast<Real>(matrix.columns[3].w);
+    }
+}
+
+/**
+ * Split many positions into high and low single-precision parts.
+ * @param positions Positions.
+ * @param count Number of positions.
+ * @param results Output of each split position which must hold count elements.
+ */
+inline void encode_batch(const Vector3d* positions, const size_t count, Vector3Split* results)
+{
+    for (size_t i = 0; i < count; ++i) {
+        results[i] = Vector3Split(positions[i]);
+    }
+}
+
+/**
+ * Join many split positions.
+ * @param positions Split positions.
+ * @param count Number of positions.
+ * @param results Output of each position which must hold count elements.
+ */
+inline void decode_batch(const Vector3Split* positions, const size_t count, Vector3d* results)
+{
+    for (size_t i = 0; i < count; ++i) {
+        results[i] = positions[i].decode();
+    }
+}
+
+}
+
+#endif
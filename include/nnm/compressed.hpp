@@ -0,0 +1,616 @@
+/* NNM - "No Nonsense Math"
+ * v0.5.0
+ * Copyright (c) 2025-present Matthew Oros
+ * Licensed under MIT
+ */
+
+#ifndef NNM_COMPRESSED_HPP
+#define NNM_COMPRESSED_HPP
+
+#include <nnm/quaternion.hpp>
+#include <nnm/vector2.hpp>
+#include <nnm/vector3.hpp>
+#include <nnm/vector4.hpp>
+
+#include <cstdint>
+
+namespace nnm {
+
+/**
+ * Maps a unit vector onto an octahedron which is unfolded to a square from negative one to one on both axes. Nearby
+ * vectors stay nearby in the square so it quantizes well and needs two values instead of three.
+ * @tparam Real Floating-point type.
+ * @param normal Unit vector.
+ * @return Result.
+ */
+template <typename Real>
+constexpr Vector2<Real> encode_octahedral(const Vector3<Real>& normal)
+{
+    const Real inverse_sum = static_cast<Real>(1) / (abs(normal.x) + abs(normal.y) + abs(normal.z));
+    const Real x = normal.x * inverse_sum;
+    const Real y = normal.y * inverse_sum;
+    // The lower half of the octahedron is folded out over the corners of the square.
+    if (normal.z < static_cast<Real>(0)) {
+        return { (static_cast<Real>(1) - abs(y)) * sign(x), (static_cast<Real>(1) - abs(x)) * sign(y) };
+    }
+    return { x, y };
+}
+
+/**
+ * Maps a point on the unfolded octahedron from encode_octahedral back to a unit vector.
+ * @tparam Real Floating-point type.
+ * @param octahedral Point from negative one to one on both axes.
+ * @return Result.
+ */
+template <typename Real>
+Vector3<Real> decode_octahedral(const Vector2<Real>& octahedral)
+{
+    Vector3<Real> normal { octahedral.x, octahedral.y, static_cast<Real>(1) - abs(octahedral.x) - abs(octahedral.y) };
+    const Real fold = max(-normal.z, static_cast<Real>(0));
+    normal.x -= fold * sign(normal.x);
+    normal.y -= fold * sign(normal.y);
+    // The length is at least one over the square root of three so it is never zero.
+    return normal / normal.length();
+}
+
+/**
+ * Three-dimensional vector stored as IEEE 754 half-precision bits. It is only for storage and is converted to and from
+ * Vector3f for math which keeps about three significant decimal digits.
+ */
+class Vector3h {
+public:
+    uint16_t x;
+    uint16_t y;
+    uint16_t z;
+
+    /**
+     * Initializes all components to zero.
+     */
+    constexpr Vector3h()
+        : x { 0 }
+        , y { 0 }
+        , z { 0 }
+    {
+    }
+
+    /**
+     * Encodes a vector rounding each component to the nearest half-precision value.
+     * @param vector Vector.
+     */
+    explicit Vector3h(const Vector3f& vector)
+        : x { float_to_half(vector.x) }
+        , y { float_to_half(vector.y) }
+        , z { float_to_half(vector.z) }
+    {
+    }
+
+    /**
+     * Decodes to a vector which is exact.
+     * @return Result.
+     */
+    [[nodiscard]] Vector3f decode() const
+    {
+        return { half_to_float(x), half_to_float(y), half_to_float(z) };
+    }
+
+    /**
+     * Equality of the stored bits.
+     * @param other Other vector.
+     * @return True if equal, false otherwise.
+     */
+    [[nodiscard]] constexpr bool operator==(const Vector3h& other) const
+    {
+        return x == other.x && y == other.y && z == other.z;
+    }
+
+    /**
+     * Inequality of the stored bits.
+     * @param other Other vector.
+     * @return True if not equal, false otherwise.
+     */
+    [[nodiscard]] constexpr bool operator!=(const Vector3h& other) const
+    {
+        return !(*this == other);
+    }
+};
+
+/**
+ * Three-dimensional vector with components from negative one to one stored as signed normalized 16-bit integers such
+ * as normals and tangents. The largest error is half of 1/32767.
+ */
+class Vector3snorm16 {
+public:
+    int16_t x;
+    int16_t y;
+    int16_t z;
+
+    /**
+     * Initializes all components to zero.
+     */
+    constexpr Vector3snorm16()
+        : x { 0 }
+        , y { 0 }
+        , z { 0 }
+    {
+    }
+
+    /**
+     * Encodes a vector clamping each component from negative one to one and rounding to the nearest step.
+     * @param vector Vector.
+     */
+    explicit constexpr Vector3snorm16(const Vector3f& vector)
+        : x { encode(vector.x) }
+        , y { encode(vector.y) }
+        , z { encode(vector.z) }
+    {
+    }
+
+    /**
+     * Encodes one component.
+     * @param value Value.
+     * @return Result.
+     */
+    static constexpr int16_t encode(const float value)
+    {
+        // Offset to be positive so that truncation rounds to nearest without branching on the sign.
+        const float offset = clamp(value, -1.0f, 1.0f) * 32767.0f + 32768.5f;
+        return static_cast<int16_t>(static_cast<int32_t>(offset) - 32768);
+    }
+
+    /**
+     * Decodes one component.
+     * @param value Value.
+     * @return Result.
+     */
+    static constexpr float decode(const int16_t value)
+    {
+        return max(static_cast<float>(value) / 32767.0f, -1.0f);
+    }
+
+    /**
+     * Decodes to a vector.
+     * @return Result.
+     */
+    [[nodiscard]] constexpr Vector3f decode() const
+    {
+        return { decode(x), decode(y), decode(z) };
+    }
+
+    /**
+     * Equality of the stored values.
+     * @param other Other vector.
+     * @return True if equal, false otherwise.
+     */
+    [[nodiscard]] constexpr bool operator==(const Vector3snorm16& other) const
+    {
+        return x == other.x && y == other.y && z == other.z;
+    }
+
+    /**
+     * Inequality of the stored values.
+     * @param other Other vector.
+     * @return True if not equal, false otherwise.
+     */
+    [[nodiscard]] constexpr bool operator!=(const Vector3snorm16& other) const
+    {
+        return !(*this == other);
+    }
+};
+
+/**
+ * Four-dimensional vector with components from zero to one stored as unsigned normalized 8-bit integers such as colors
+ * and blend weights. The largest error is half of 1/255.
+ */
+class Vector4unorm8 {
+public:
+    uint8_t x;
+    uint8_t y;
+    uint8_t z;
+    uint8_t w;
+
+    /**
+     * Initializes all components to zero.
+     */
+    constexpr Vector4unorm8()
+        : x { 0 }
+        , y { 0 }
+        , z { 0 }
+        , w { 0 }
+    {
+    }
+
+    /**
+     * Encodes a vector clamping each component from zero to one and rounding to the nearest step.
+     * @param vector Vector.
+     */
+    explicit constexpr Vector4unorm8(const Vector4f& vector)
+        : x { encode(vector.x) }
+        , y { encode(vector.y) }
+        , z { encode(vector.z) }
+        , w { encode(vector.w) }
+    {
+    }
+
+    /**
+     * Encodes one component.
+     * @param value Value.
+     * @return Result.
+     */
+    static constexpr uint8_t encode(const float value)
+    {
+        return static_cast<uint8_t>(clamp(value, 0.0f, 1.0f) * 255.0f + 0.5f);
+    }
+
+    /**
+     * Decodes one component.
+     * @param value Value.
+     * @return Result.
+     */
+    static constexpr float decode(const uint8_t value)
+    {
+        return static_cast<float>(value) / 255.0f;
+    }
+
+    /**
+     * Decodes to a vector.
+     * @return Result.
+     */
+    [[nodiscard]] constexpr Vector4f decode() const
+    {
+        return { decode(x), decode(y), decode(z), decode(w) };
+    }
+
+    /**
+     * Equality of the stored values.
+     * @param other Other vector.
+     * @return True if equal, false otherwise.
+     */
+    [[nodiscard]] constexpr bool operator==(const Vector4unorm8& other) const
+    {
+        return x == other.x && y == other.y && z == other.z && w == other.w;
+    }
+
+    /**
+     * Inequality of the stored values.
+     * @param other Other vector.
+     * @return True if not equal, false otherwise.
+     */
+    [[nodiscard]] constexpr bool operator!=(const Vector4unorm8& other) const
+    {
+        return !(*this == other);
+    }
+};
+
+/**
+ * Unit vector such as a normal or tangent stored as two signed normalized 16-bit integers of its octahedral encoding
+ * which is a third of the size of Vector3f. The largest angular error is below 0.00005 radians when encoded with
+ * precise and below 0.00007 radians when encoded with the constructor.
+ */
+class Vector3oct16 {
+public:
+    int16_t x;
+    int16_t y;
+
+    /**
+     * Initializes to the unit vector along positive z which is encoded as zero.
+     */
+    constexpr Vector3oct16()
+        : x { 0 }
+        , y { 0 }
+    {
+    }
+
+    /**
+     * Encodes a unit vector rounding each component to the nearest step.
+     * @param normal Unit vector.
+     */
+    explicit constexpr Vector3oct16(const Vector3f& normal)
+        : Vector3oct16(encode_octahedral(normal))
+    {
+    }
+
+    /**
+     * Encodes a point on the unfolded octahedron rounding each component to the nearest step.
+     * @param octahedral Point from negative one to one on both axes.
+     */
+    explicit constexpr Vector3oct16(const Vector2f& octahedral)
+        : x { Vector3snorm16::encode(octahedral.x) }
+        , y { Vector3snorm16::encode(octahedral.y) }
+    {
+    }
+
+    /**
+     * Encodes a unit vector choosing whichever of the four neighboring steps decodes closest to it. Rounding each
+     * component to the nearest step is not always closest on the sphere since the octahedral mapping is not uniform.
+     * @param normal Unit vector.
+     * @return Result.
+     */
+    static Vector3oct16 precise(const Vector3f& normal)
+    {
+        const Vector2f octahedral = encode_octahedral(normal);
+        const float floor_x = floor(octahedral.x * 32767.0f);
+        const float floor_y = floor(octahedral.y * 32767.0f);
+        Vector3oct16 result;
+        // Compared by distance since the dot products of such close vectors are all within rounding of one.
+        float best_distance_sqrd = 5.0f;
+        for (uint8_t i = 0; i < 4; ++i) {
+            Vector3oct16 candidate;
+            candidate.x = static_cast<int16_t>(clamp(floor_x + static_cast<float>(i & 1), -32767.0f, 32767.0f));
+            candidate.y = static_cast<int16_t>(clamp(floor_y + static_cast<float>(i >> 1), -32767.0f, 32767.0f));
+            const float distance_sqrd = candidate.decode().distance_sqrd(normal);
+            if (distance_sqrd < best_distance_sqrd) {
+                best_distance_sqrd = distance_sqrd;
+                result = candidate;
+            }
+        }
+        return result;
+    }
+
+    /**
+     * Decodes to a unit vector.
+     * @return Result.
+     */
+    [[nodiscard]] Vector3f decode() const
+    {
+        return decode_octahedral(Vector2f(Vector3snorm16::decode(x), Vector3snorm16::decode(y)));
+    }
+
+    /**
+     * Equality of the stored values.
+     * @param other Other vector.
+     * @return True if equal, false otherwise.
+     */
+    [[nodiscard]] constexpr bool operator==(const Vector3oct16& other) const
+    {
+        return x == other.x && y == other.y;
+    }
+
+    /**
+     * Inequality of the stored values.
+     * @param other Other vector.
+     * @return True if not equal, false otherwise.
+     */
+    [[nodiscard]] constexpr bool operator!=(const Vector3oct16& other) const
+    {
+        return !(*this == other);
+    }
+};
+
+/**
+ * Unit quaternion packed with the "smallest three" method. The component with the largest magnitude is dropped and
+ * recomputed from the others since the quaternion has unit length, and the sign is chosen so that it is positive
+ * which does not change the rotation. The remaining three components lie within plus or minus one over the square root
+ * of two and are quantized with (Bits - 2) / 3 bits each after two bits for the index of the dropped component.
+ * @tparam Bits Total number of bits which is 32, 48, or 64.
+ */
+template <uint8_t Bits>
+class QuaternionPacked {
+public:
+    static_assert(Bits == 32 || Bits == 48 || Bits == 64, "QuaternionPacked supports 32, 48, or 64 bits");
+
+    uint16_t data[Bits / 16];
+
+    /**
+     * Initializes to the identity quaternion.
+     */
+    QuaternionPacked()
+        : QuaternionPacked(QuaternionF())
+    {
+    }
+
+    /**
+     * Encodes a unit quaternion.
+     * @param quaternion Unit quaternion.
+     */
+    explicit QuaternionPacked(const QuaternionF& quaternion)
+        : data {}
+    {
+        constexpr uint8_t component_bits = (Bits - 2) / 3;
+        // An even number of steps so that zero is exact.
+        constexpr auto max_step = static_cast<int32_t>((1u << component_bits) - 2);
+        constexpr auto steps = static_cast<float>(max_step);
+        const float components[4] { quaternion.x, quaternion.y, quaternion.z, quaternion.w };
+        // Which component is largest is unpredictable across many quaternions so all four are quantized and the
+        // largest is skipped with integer masks rather than with branches or by indexing memory.
+        uint32_t largest = 0;
+        float largest_sqrd = components[0] * components[0];
+        for (uint32_t i = 1; i < 4; ++i) {
+            const float value_sqrd = components[i] * components[i];
+            const uint32_t larger = 0u - static_cast<uint32_t>(value_sqrd > largest_sqrd);
+            largest = (i & larger) | (largest & ~larger);
+            largest_sqrd = max(value_sqrd, largest_sqrd);
+        }
+        uint32_t negative = 0;
+        for (uint32_t i = 0; i < 4; ++i) {
+            negative |= static_cast<uint32_t>(components[i] < 0.0f) & static_cast<uint32_t>(i == largest);
+        }
+        const float scale = (1.0f - 2.0f * static_cast<float>(negative)) * sqrt(2.0f) * 0.5f;
+        // Clamped as integers since only the largest component, which is discarded, can fall out of range.
+        uint32_t quantized[4];
+        for (uint8_t i = 0; i < 4; ++i) {
+            const auto value = static_cast<int32_t>((components[i] * scale + 0.5f) * steps + 0.5f);
+            const int32_t clamped = value < 0 ? 0 : value;
+            quantized[i] = static_cast<uint32_t>(clamped > max_step ? max_step : clamped);
+        }
+        uint64_t packed = largest;
+        for (uint32_t i = 0; i < 3; ++i) {
+            const uint32_t after = 0u - static_cast<uint32_t>(i >= largest);
+            packed = (packed << component_bits) | ((quantized[i + 1] & after) | (quantized[i] & ~after));
+        }
+        *this = QuaternionPacked(packed);
+    }
+
+    /**
+     * Initializes from the bits of a previously packed quaternion such as from bits().
+     * @param bits Bits where only the lowest Bits are used.
+     */
+    explicit constexpr QuaternionPacked(const uint64_t bits)
+        : data {}
+    {
+        for (uint8_t i = 0; i < Bits / 16; ++i) {
+            data[i] = static_cast<uint16_t>(bits >> (i * 16));
+        }
+    }
+
+    /**
+     * Packed bits as one integer.
+     * @return Result.
+     */
+    [[nodiscard]] constexpr uint64_t bits() const
+    {
+        uint64_t result = 0;
+        for (uint8_t i = 0; i < Bits / 16; ++i) {
+            result |= static_cast<uint64_t>(data[i]) << (i * 16);
+        }
+        return result;
+    }
+
+    /**
+     * Decodes to a unit quaternion.
+     * @return Result.
+     */
+    [[nodiscard]] QuaternionF decode() const
+    {
+        constexpr uint8_t component_bits = (Bits - 2) / 3;
+        constexpr uint64_t mask = (1u << component_bits) - 1;
+        const uint64_t packed = bits();
+        const auto largest = static_cast<uint8_t>((packed >> (component_bits * 3)) & 3u);
+        const float scale = sqrt(2.0f) / static_cast<float>(mask - 1);
+        const float offset = sqrt(2.0f) * 0.5f;
+        float components[4] {};
+        float length_sqrd = 0.0f;
+        for (uint8_t i = 0; i < 3; ++i) {
+            const float component
+                = static_cast<float>((packed >> ((2 - i) * component_bits)) & mask) * scale - offset;
+            components[i + static_cast<uint8_t>(i >= largest)] = component;
+            length_sqrd += component * component;
+        }
+        components[largest] = sqrt(max(1.0f - length_sqrd, 0.0f));
+        return { components[0], components[1], components[2], components[3] };
+    }
+
+    /**
+     * Equality of the stored bits.
+     * @param other Other quaternion.
+     * @return True if equal, false otherwise.
+     */
+    [[nodiscard]] constexpr bool operator==(const QuaternionPacked& other) const
+    {
+        for (uint8_t i = 0; i < Bits / 16; ++i) {
+            if (data[i] != other.data[i]) {
+                return false;
+            }
+        }
+        return true;
+    }
+
+    /**
+     * Inequality of the stored bits.
+     * @param other Other quaternion.
+     * @return True if not equal, false otherwise.
+     */
+    [[nodiscard]] constexpr bool operator!=(const QuaternionPacked& other) const
+    {
+        return !(*this == other);
+    }
+};
+
+/**
+ * Three-dimensional double-precision position stored as the sum of a high and a low single-precision vector so that a
+ * GPU without double precision can subtract two positions with about 48 bits of precision. The high part is the
+ * position rounded to float and the low part is the rounded remainder.
+ */
+class Vector3Split {
+public:
+    /**
+     * Position rounded to float.
+     */
+    Vector3f high;
+
+    /**
+     * Remainder of the position after subtracting the high part rounded to float.
+     */
+    Vector3f low;
+
+    /**
+     * Initializes to zero.
+     */
+    constexpr Vector3Split()
+        : high { Vector3f::zero() }
+        , low { Vector3f::zero() }
+    {
+    }
+
+    /**
+     * Splits a position.
+     * @param position Position.
+     */
+    explicit constexpr Vector3Split(const Vector3d& position)
+        : high { Vector3f(position) }
+        , low { low_part(position.x), low_part(position.y), low_part(position.z) }
+    {
+    }
+
+    /**
+     * Initialize with high and low parts.
+     * @param high High part.
+     * @param low Low part.
+     */
+    constexpr Vector3Split(const Vector3f& high, const Vector3f& low)
+        : high { high }
+        , low { low }
+    {
+    }
+
+    /**
+     * Joins the parts into a position which is within 2^-48 of the magnitude of the original position.
+     * @return Result.
+     */
+    [[nodiscard]] constexpr Vector3d decode() const
+    {
+        return Vector3d(high) + Vector3d(low);
+    }
+
+    /**
+     * Position relative to an origin computed only in single precision the same way as in a shader. Subtracting the
+     * high parts is exact when the positions are close, so the result keeps the precision of the low parts.
+     * @param origin Origin.
+     * @return Result.
+     */
+    [[nodiscard]] constexpr Vector3f relative_to(const Vector3Split& origin) const
+    {
+        return (high - origin.high) + (low - origin.low);
+    }
+
+    /**
+     * Equality of the parts.
+     * @param other Other vector.
+     * @return True if equal, false otherwise.
+     */
+    [[nodiscard]] constexpr bool operator==(const Vector3Split& other) const
+    {
+        return high == other.high && low == other.low;
+    }
+
+    /**
+     * Inequality of the parts.
+     * @param other Other vector.
+     * @return True if not equal, false otherwise.
+     */
+    [[nodiscard]] constexpr bool operator!=(const Vector3Split& other) const
+    {
+        return !(*this == other);
+    }
+
+private:
+    // Each component is split by a separate call since GCC 12 vectorizes the whole-vector expression into a round trip
+    // through float that it folds to zero for the second and third components.
+    NNM_NOINLINE static constexpr float low_part(const double value)
+    {
+        return static_cast<float>(value - static_cast<double>(static_cast<float>(value)));
+    }
+};
+
+}
+
+#endif
@@ -0,0 +1,678 @@
+/* NNM - "No Nonsense Math"
+ * v0.5.0
+ * Copyright (c) 2025-present Matthew Oros
+ * Licensed under MIT
+ */
+
+#ifndef NNM_DISPATCH_HPP
+#define NNM_DISPATCH_HPP
+
+#include <nnm/nnm.hpp>
+
+#include <cstddef>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <optional>
+
+// Variants are the same portable batch functions compiled for a wider instruction set rather than hand-written
+// intrinsics. Other compilers and architectures only have the baseline variant. F16C is enabled with AVX2 so that
+// half-precision values are converted with vector instructions, and the AVX-512 FP16 variant needs a compiler that
+// has _Float16. At -O2 GCC either does not vectorize loops (before version 12) or only with its very cheap cost model,
+// which leaves the variants without any ymm or zmm instructions, so they enable the vectorizer themselves. Clang
+// vectorizes at -O2 and does not have the optimize attribute.
+#if (defined(__x86_64__) || defined(__i386__)) && (defined(__GNUC__) || defined(__clang__))
+#define NNM_DISPATCH_X86
+#if defined(__clang__)
+#define NNM_DISPATCH_VECTORIZE
+#else
+#define NNM_DISPATCH_VECTORIZE optimize("tree-vectorize"),
+#endif
+#define NNM_DISPATCH_AVX2 __attribute__((target("avx2,fma,f16c"), NNM_DISPATCH_VECTORIZE flatten))
+#define NNM_DISPATCH_AVX512 \
+    __attribute__((target("avx512f,avx512vl,avx2,fma,f16c"), NNM_DISPATCH_VECTORIZE flatten))
+#if defined(__FLT16_MAX__)
+#define NNM_DISPATCH_AVX512FP16 \
+    __attribute__((target("avx512fp16,avx512bw,avx512vl,avx512f,avx2,fma,f16c"), NNM_DISPATCH_VECTORIZE flatten))
+#endif
+#endif
+
+namespace nnm::dispatch {
+
+/**
+ * Instruction set that batch functions are compiled for.
+ */
+enum class Isa : uint8_t {
+    /**
+     * Instruction set the program was compiled for which is SSE2 for x86-64.
+     */
+    baseline,
+
+    /**
+     * AVX2 with FMA and F16C.
+     */
+    avx2,
+
+    /**
+     * AVX-512 foundation and vector length extensions.
+     */
+    avx512,
+
+    /**
+     * AVX-512 with native half-precision arithmetic.
+     */
+    avx512fp16
+};
+
+/**
+ * Determines if the processor supports an instruction set and a variant exists for it.
+ * @param isa Instruction set.
+ * @return True if supported, false otherwise.
+ */
+inline bool supported(const Isa isa)
+{
+    switch (isa) {
+    case Isa::baseline:
+        return true;
+#if defined(NNM_DISPATCH_X86)
+    case Isa::avx2:
+        return __builtin_cpu_supports("avx2") && __builtin_cpu_supports("fma") && __builtin_cpu_supports("f16c");
+    case Isa::avx512:
+        return supported(Isa::avx2) && __builtin_cpu_supports("avx512f") && __builtin_cpu_supports("avx512vl");
+#endif
+#if defined(NNM_DISPATCH_AVX512FP16)
+    case Isa::avx512fp16:
+        return supported(Isa::avx512) && __builtin_cpu_supports("avx512bw") && __builtin_cpu_supports("avx512fp16");
+#endif
+    default:
+        return false;
+    }
+}
+
+/**
+ * Widest instruction set supported by the processor.
+ * @return Result.
+ */
+inline Isa detect()
+{
+    if (supported(Isa::avx512fp16)) {
+        return Isa::avx512fp16;
+    }
+    if (supported(Isa::avx512)) {
+        return Isa::avx512;
+    }
+    if (supported(Isa::avx2)) {
+        return Isa::avx2;
+    }
+    return Isa::baseline;
+}
+
+/**
+ * Instruction set with a name.
+ * @param name One of baseline, avx2, avx512, or avx512fp16.
+ * @return Result or null if the name is unknown.
+ */
+inline std::optional<Isa> isa_from_name(const char* name)
+{
+    constexpr const char* names[4] { "baseline", "avx2", "avx512", "avx512fp16" };
+    for (uint8_t i = 0; i < 4; ++i) {
+        if (std::strcmp(name, names[i]) == 0) {
+            return static_cast<Isa>(i);
+        }
+    }
+    return std::nullopt;
+}
+
+/**
+ * Instruction set to use given the value of the NNM_FORCE_ISA environment variable. An unknown or unsupported forced
+ * instruction set is reported on stderr and the widest supported one is used instead.
+ * @param forced Name of the instruction set to use or null to use the widest supported one.
+ * @return Result.
+ */
+inline Isa select(const char* forced)
+{
+    if (forced == nullptr) {
+        return detect();
+    }
+    const std::optional<Isa> isa = isa_from_name(forced);
+    if (!isa.has_value()) {
+        std::fprintf(stderr, "nnm: NNM_FORCE_ISA=%s is not an instruction set\n", forced);
+        return detect();
+    }
+    if (!supported(*isa)) {
+        std::fprintf(stderr, "nnm: NNM_FORCE_ISA=%s is not supported by this processor or compiler\n", forced);
+        return detect();
+    }
+    return *isa;
+}
+
+/**
+ * Instruction set used by batch functions without an explicit instruction set. It is selected once on first use from
+ * the NNM_FORCE_ISA environment variable if it is set to baseline, avx2, avx512, or avx512fp16, and is otherwise the
+ * widest supported one.
+ * @return Result.
+ */
+inline Isa active()
+{
+#if defined(_MSC_VER)
+#pragma warning(suppress : 4996)
+#endif
+    static const Isa result = select(std::getenv("NNM_FORCE_ISA"));
+    return result;
+}
+
+/**
+ * Transform many points computing in RealTraits<Real>::Promoted. Half-precision values are then converted to float
+ * once per point instead of once per operation, which is faster when there is no native half-precision arithmetic.
+ * @tparam Real Floating-point type.
+ * @param by Transform.
+ * @param points Points.
+ * @param count Number of points.
+ * @param results Output of each transformed point which must hold count elements.
+ */
+template <typename Real>
+void transform_point_batch_promoted(
+    const Transform3<Real>& by, const Vector3<Real>* points, const size_t count, Vector3<Real>* results)
+{
+    using Promoted = typename RealTraits<Real>::Promoted;
+    if constexpr (std::is_same_v<Promoted, Real>) {
+        nnm::transform_point_batch(by, points, count, results);
+    }
+    else {
+        const Transform3<Promoted> promoted_by(by);
+        for (size_t i = 0; i < count; ++i) {
+            results[i] = Vector3<Real>(Vector3<Promoted>(points[i]).transform(promoted_by));
+        }
+    }
+}
+
+/**
+ * Compose many pairs of transforms computing in RealTraits<Real>::Promoted.
+ * @tparam Real Floating-point type.
+ * @param transforms Transforms.
+ * @param by Transforms to apply after each of the transforms.
+ * @param count Number of transforms.
+ * @param results Output of each composed transform which must hold count elements.
+ */
+template <typename Real>
+void transform_batch_promoted(
+    const Transform3<Real>* transforms, const Transform3<Real>* by, const size_t count, Transform3<Real>* results)
+{
+    using Promoted = typename RealTraits<Real>::Promoted;
+    if constexpr (std::is_same_v<Promoted, Real>) {
+        nnm::transform_batch(transforms, by, count, results);
+    }
+    else {
+        for (size_t i = 0; i < count; ++i) {
+            results[i]
+                = Transform3<Real>(Transform3<Promoted>(transforms[i]).transform(Transform3<Promoted>(by[i])));
+        }
+    }
+}
+
+/**
+ * Normalize many vectors computing in RealTraits<Real>::Promoted.
+ * @tparam Real Floating-point type.
+ * @param vectors Vectors.
+ * @param count Number of vectors.
+ * @param results Output of each normalized vector which must hold count elements.
+ */
+template <typename Real>
+void normalize_batch_promoted(const Vector3<Real>* vectors, const size_t count, Vector3<Real>* results)
+{
+    using Promoted = typename RealTraits<Real>::Promoted;
+    if constexpr (std::is_same_v<Promoted, Real>) {
+        nnm::normalize_batch(vectors, count, results);
+    }
+    else {
+        for (size_t i = 0; i < count; ++i) {
+            results[i] = Vector3<Real>(Vector3<Promoted>(vectors[i]).normalize());
+        }
+    }
+}
+
+/**
+ * Signed distances of many points to a plane computing in RealTraits<Real>::Promoted.
+ * @tparam Real Floating-point type.
+ * @param plane Plane with a normalized normal.
+ * @param points Points.
+ * @param count Number of points.
+ * @param results Output of each signed distance which must hold count elements.
+ */
+template <typename Real>
+void signed_distance_batch_promoted(
+    const Plane3<Real>& plane, const Vector3<Real>* points, const size_t count, Real* results)
+{
+    using Promoted = typename RealTraits<Real>::Promoted;
+    if constexpr (std::is_same_v<Promoted, Real>) {
+        nnm::signed_distance_batch(plane, points, count, results);
+    }
+    else {
+        const Plane3<Promoted> promoted_plane(plane);
+        for (size_t i = 0; i < count; ++i) {
+            results[i] = static_cast<Real>(promoted_plane.signed_distance(Vector3<Promoted>(points[i])));
+        }
+    }
+}
+
+#if defined(NNM_DISPATCH_X86)
+
+template <typename Real>
+NNM_DISPATCH_AVX2 void transform_point_batch_avx2(
+    const Transform3<Real>& by,
+    const Vector3<Real>* __restrict points,
+    const size_t count,
+    Vector3<Real>* __restrict results)
+{
+    transform_point_batch_promoted(by, points, count, results);
+}
+
+template <typename Real>
+NNM_DISPATCH_AVX512 void transform_point_batch_avx512(
+    const Transform3<Real>& by,
+    const Vector3<Real>* __restrict points,
+    const size_t count,
+    Vector3<Real>* __restrict results)
+{
+    transform_point_batch_promoted(by, points, count, results);
+}
+
+template <typename Real>
+NNM_DISPATCH_AVX2 void transform_batch_avx2(
+    const Transform3<Real>* __restrict transforms,
+    const Transform3<Real>* __restrict by,
+    const size_t count,
+    Transform3<Real>* __restrict results)
+{
+    transform_batch_promoted(transforms, by, count, results);
+}
+
+template <typename Real>
+NNM_DISPATCH_AVX512 void transform_batch_avx512(
+    const Transform3<Real>* __restrict transforms,
+    const Transform3<Real>* __restrict by,
+    const size_t count,
+    Transform3<Real>* __restrict results)
+{
+    transform_batch_promoted(transforms, by, count, results);
+}
+
+template <typename Real>
+NNM_DISPATCH_AVX2 void normalize_batch_avx2(
+    const Vector3<Real>* __restrict vectors, const size_t count, Vector3<Real>* __restrict results)
+{
+    normalize_batch_promoted(vectors, count, results);
+}
+
+template <typename Real>
+NNM_DISPATCH_AVX512 void normalize_batch_avx512(
+    const Vector3<Real>* __restrict vectors, const size_t count, Vector3<Real>* __restrict results)
+{
+    normalize_batch_promoted(vectors, count, results);
+}
+
+template <typename Real>
+NNM_DISPATCH_AVX2 void signed_distance_batch_avx2(
+    const Plane3<Real>& plane, const Vector3<Real>* __restrict points, const size_t count, Real* __restrict results)
+{
+    signed_distance_batch_promoted(plane, points, count, results);
+}
+
+template <typename Real>
+NNM_DISPATCH_AVX512 void signed_distance_batch_avx512(
+    const Plane3<Real>& plane, const Vector3<Real>* __restrict points, const size_t count, Real* __restrict results)
+{
+    signed_distance_batch_promoted(plane, points, count, results);
+}
+
+NNM_DISPATCH_AVX2 inline void encode_batch_avx2(
+    const Vector3f* __restrict vectors, const size_t count, Vector3h* __restrict results)
+{
+    nnm::encode_batch(vectors, count, results);
+}
+
+NNM_DISPATCH_AVX512 inline void encode_batch_avx512(
+    const Vector3f* __restrict vectors, const size_t count, Vector3h* __restrict results)
+{
+    nnm::encode_batch(vectors, count, results);
+}
+
+NNM_DISPATCH_AVX2 inline void decode_batch_avx2(
+    const Vector3h* __restrict vectors, const size_t count, Vector3f* __restrict results)
+{
+    nnm::decode_batch(vectors, count, results);
+}
+
+NNM_DISPATCH_AVX512 inline void decode_batch_avx512(
+    const Vector3h* __restrict vectors, const size_t count, Vector3f* __restrict results)
+{
+    nnm::decode_batch(vectors, count, results);
+}
+
+#endif
+
+#if defined(NNM_DISPATCH_AVX512FP16)
+
+template <typename Real>
+NNM_DISPATCH_AVX512FP16 void transform_point_batch_avx512fp16(
+    const Transform3<Real>& by,
+    const Vector3<Real>* __restrict points,
+    const size_t count,
+    Vector3<Real>* __restrict results)
+{
+    nnm::transform_point_batch(by, points, count, results);
+}
+
+template <typename Real>
+NNM_DISPATCH_AVX512FP16 void transform_batch_avx512fp16(
+    const Transform3<Real>* __restrict transforms,
+    const Transform3<Real>* __restrict by,
+    const size_t count,
+    Transform3<Real>* __restrict results)
+{
+    nnm::transform_batch(transforms, by, count, results);
+}
+
+template <typename Real>
+NNM_DISPATCH_AVX512FP16 void normalize_batch_avx512fp16(
+    const Vector3<Real>* __restrict vectors, const size_t count, Vector3<Real>* __restrict results)
+{
+    nnm::normalize_batch(vectors, count, results);
+}
+
+template <typename Real>
+NNM_DISPATCH_AVX512FP16 void signed_distance_batch_avx512fp16(
+    const Plane3<Real>& plane, const Vector3<Real>* __restrict points, const size_t count, Real* __restrict results)
+{
+    nnm::signed_distance_batch(plane, points, count, results);
+}
+
+NNM_DISPATCH_AVX512FP16 inline void encode_batch_avx512fp16(
+    const Vector3f* __restrict vectors, const size_t count, Vector3h* __restrict results)
+{
+    nnm::encode_batch(vectors, count, results);
+}
+
+NNM_DISPATCH_AVX512FP16 inline void decode_batch_avx512fp16(
+    const Vector3h* __restrict vectors, const size_t count, Vector3f* __restrict results)
+{
+    nnm::decode_batch(vectors, count, results);
+}
+
+#endif
+
+/**
+ * Transform many points with a specific instruction set which must be supported.
+ * @tparam Real Floating-point type.
+ * @param isa Instruction set.
+ * @param by Transform.
+ * @param points Points.
+ * @param count Number of points.
+ * @param results Output of each transformed point which must hold count elements and not overlap the inputs.
+ */
+template <typename Real>
+void transform_point_batch(
+    const Isa isa, const Transform3<Real>& by, const Vector3<Real>* points, const size_t count, Vector3<Real>* results)
+{
+    switch (isa) {
+#if defined(NNM_DISPATCH_X86)
+    case Isa::avx2:
+        transform_point_batch_avx2(by, points, count, results);
+        return;
+    case Isa::avx512:
+        transform_point_batch_avx512(by, points, count, results);
+        return;
+#endif
+#if defined(NNM_DISPATCH_AVX512FP16)
+    case Isa::avx512fp16:
+        transform_point_batch_avx512fp16(by, points, count, results);
+        return;
+#endif
+    default:
+        transform_point_batch_promoted(by, points, count, results);
+    }
+}
+
+/**
+ * Transform many points with the active instruction set.
+ * @tparam Real Floating-point type.
+ * @param by Transform.
+ * @param points Points.
+ * @param count Number of points.
+ * @param results Output of each transformed point which must hold count elements and not overlap the inputs.
+ */
+template <typename Real>
+void transform_point_batch(
+    const Transform3<Real>& by, const Vector3<Real>* points, const size_t count, Vector3<Real>* results)
+{
+    transform_point_batch(active(), by, points, count, results);
+}
+
+/**
+ * Compose many pairs of transforms with a specific instruction set which must be supported.
+ * @tparam Real Floating-point type.
+ * @param isa Instruction set.
+ * @param transforms Transforms.
+ * @param by Transforms to apply after each of the transforms.
+ * @param count Number of transforms.
+ * @param results Output of each composed transform which must hold count elements and not overlap the inputs.
+ */
+template <typename Real>
+void transform_batch(
+    const Isa isa,
+    const Transform3<Real>* transforms,
+    const Transform3<Real>* by,
+    const size_t count,
+    Transform3<Real>* results)
+{
+    switch (isa) {
+#if defined(NNM_DISPATCH_X86)
+    case Isa::avx2:
+        transform_batch_avx2(transforms, by, count, results);
+        return;
+    case Isa::avx512:
+        transform_batch_avx512(transforms, by, count, results);
+        return;
+#endif
+#if defined(NNM_DISPATCH_AVX512FP16)
+    case Isa::avx512fp16:
+        transform_batch_avx512fp16(transforms, by, count, results);
+        return;
+#endif
+    default:
+        transform_batch_promoted(transforms, by, count, results);
+    }
+}
+
+/**
+ * Compose many pairs of transforms with the active instruction set.
+ * @tparam Real Floating-point type.
+ * @param transforms Transforms.
+ * @param by Transforms to apply after each of the transforms.
+ * @param count Number of transforms.
+ * @param results Output of each composed transform which must hold count elements and not overlap the inputs.
+ */
+template <typename Real>
+void transform_batch(
+    const Transform3<Real>* transforms, const Transform3<Real>* by, const size_t count, Transform3<Real>* results)
+{
+    transform_batch(active(), transforms, by, count, results);
+}
+
+/**
+ * Normalize many vectors with a specific instruction set which must be supported.
+ * @tparam Real Floating-point type.
+ * @param isa Instruction set.
+ * @param vectors Vectors.
+ * @param count Number of vectors.
+ * @param results Output of each normalized vector which must hold count elements and not overlap the inputs.
+ */
+template <typename Real>
+void normalize_batch(const Isa isa, const Vector3<Real>* vectors, const size_t count, Vector3<Real>* results)
+{
+    switch (isa) {
+#if defined(NNM_DISPATCH_X86)
+    case Isa::avx2:
+        normalize_batch_avx2(vectors, count, results);
+        return;
+    case Isa::avx512:
+        normalize_batch_avx512(vectors, count, results);
+        return;
+#endif
+#if defined(NNM_DISPATCH_AVX512FP16)
+    case Isa::avx512fp16:
+        normalize_batch_avx512fp16(vectors, count, results);
+        return;
+#endif
+    default:
+        normalize_batch_promoted(vectors, count, results);
+    }
+}
+
+/**
+ * Normalize many vectors with the active instruction set.
+ * @tparam Real Floating-point type.
+ * @param vectors Vectors.
+ * @param count Number of vectors.
+ * @param results Output of each normalized vector which must hold count elements and not overlap the inputs.
+ */
+template <typename Real>
+void normalize_batch(const Vector3<Real>* vectors, const size_t count, Vector3<Real>* results)
+{
+    normalize_batch(active(), vectors, count, results);
+}
+
+/**
+ * Signed distances of many points to a plane with a specific instruction set which must be supported.
+ * @tparam Real Floating-point type.
+ * @param isa Instruction set.
+ * @param plane Plane with a normalized normal.
+ * @param points Points.
+ * @param count Number of points.
+ * @param results Output of each signed distance which must hold count elements and not overlap the inputs.
+ */
+template <typename Real>
+void signed_distance_batch(
+    const Isa isa, const Plane3<Real>& plane, const Vector3<Real>* points, const size_t count, Real* results)
+{
+    switch (isa) {
+#if defined(NNM_DISPATCH_X86)
+    case Isa::avx2:
+        signed_distance_batch_avx2(plane, points, count, results);
+        return;
+    case Isa::avx512:
+        signed_distance_batch_avx512(plane, points, count, results);
+        return;
+#endif
+#if defined(NNM_DISPATCH_AVX512FP16)
+    case Isa::avx512fp16:
+        signed_distance_batch_avx512fp16(plane, points, count, results);
+        return;
+#endif
+    default:
+        signed_distance_batch_promoted(plane, points, count, results);
+    }
+}
+
+/**
+ * Signed distances of many points to a plane with the active instruction set.
+ * @tparam Real Floating-point type.
+ * @param plane Plane with a normalized normal.
+ * @param points Points.
+ * @param count Number of points.
+ * @param results Output of each signed distance which must hold count elements and not overlap the inputs.
+ */
+template <typename Real>
+void signed_distance_batch(const Plane3<Real>& plane, const Vector3<Real>* points, const size_t count, Real* results)
+{
+    signed_distance_batch(active(), plane, points, count, results);
+}
+
+/**
+ * Encode many vectors to half precision with a specific instruction set which must be supported.
+ * @param isa Instruction set.
+ * @param vectors Vectors.
+ * @param count Number of vectors.
+ * @param results Output of each encoded vector which must hold count elements and not overlap the inputs.
+ */
+inline void encode_batch(const Isa isa, const Vector3f* vectors, const size_t count, Vector3h* results)
+{
+    switch (isa) {
+#if defined(NNM_DISPATCH_X86)
+    case Isa::avx2:
+        encode_batch_avx2(vectors, count, results);
+        return;
+    case Isa::avx512:
+        encode_batch_avx512(vectors, count, results);
+        return;
+#endif
+#if defined(NNM_DISPATCH_AVX512FP16)
+    case Isa::avx512fp16:
+        encode_batch_avx512fp16(vectors, count, results);
+        return;
+#endif
+    default:
+        nnm::encode_batch(vectors, count, results);
+    }
+}
+
+/**
+ * Encode many vectors to half precision with the active instruction set.
+ * @param vectors Vectors.
+ * @param count Number of vectors.
+ * @param results Output of each encoded vector which must hold count elements and not overlap the inputs.
+ */
+inline void encode_batch(const Vector3f* vectors, const size_t count, Vector3h* results)
+{
+    encode_batch(active(), vectors, count, results);
+}
+
+/**
+ * Decode many half-precision vectors with a specific instruction set which must be supported.
+ * @param isa Instruction set.
+ * @param vectors Encoded vectors.
+ * @param count Number of vectors.
+ * @param results Output of each decoded vector which must hold count elements and not overlap the inputs.
+ */
+inline void decode_batch(const Isa isa, const Vector3h* vectors, const size_t count, Vector3f* results)
+{
+    switch (isa) {
+#if defined(NNM_DISPATCH_X86)
+    case Isa::avx2:
+        decode_batch_avx2(vectors, count, results);
+        return;
+    case Isa::avx512:
+        decode_batch_avx512(vectors, count, results);
+        return;
+#endif
+#if defined(NNM_DISPATCH_AVX512FP16)
+    case Isa::avx512fp16:
+        decode_batch_avx512fp16(vectors, count, results);
+        return;
+#endif
+    default:
+        nnm::decode_batch(vectors, count, results);
+    }
+}
+
+/**
+ * Decode many half-precision vectors with the active instruction set.
+ * @param vectors Encoded vectors.
+ * @param count Number of vectors.
+ * @param results Output of each decoded vector which must hold count elements and not overlap the inputs.
+ */
+inline void decode_batch(const Vector3h* vectors, const size_t count, Vector3f* results)
+{
+    decode_batch(active(), vectors, count, results);
+}
+
+}
+
+#undef NNM_DISPATCH_X86
+#undef NNM_DISPATCH_AVX2
+#undef NNM_DISPATCH_AVX512
+#undef NNM_DISPATCH_AVX512FP16
+#undef NNM_DISPATCH_VECTORIZE
+
+#endif
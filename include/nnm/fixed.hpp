@@ -0,0 +1,702 @@
+/* NNM - "No Nonsense Math"
+ * v0.5.0
+ * Copyright (c) 2025-present Matthew Oros
+ * Licensed under MIT
+ */
+
+#ifndef NNM_FIXED_HPP
+#define NNM_FIXED_HPP
+
+#include <nnm/scalar.hpp>
+
+#include <cmath>
+#include <cstdint>
+#include <type_traits>
+
+namespace nnm {
+
+/**
+ * Signed fixed-point number that can be used as the Real type of vectors, quaternions, bases, and transforms when
+ * results must be bit-identical across compilers and platforms such as in lockstep simulations. All operations
+ * including sqrt, sin, cos, and atan2 are done with integer arithmetic. Overflow wraps around and division by zero
+ * saturates.
+ * @tparam IntBits Number of integer bits including the sign bit which must be at least three to hold pi.
+ * @tparam FracBits Number of fractional bits.
+ */
+template <uint8_t IntBits, uint8_t FracBits>
+class Fixed {
+    static_assert(IntBits >= 3 && FracBits >= 1 && IntBits + FracBits <= 32, "Fixed must fit in 32 bits");
+
+public:
+    /**
+     * Integer that stores the value multiplied by 2^FracBits.
+     */
+    int32_t raw;
+
+    /**
+     * Initialize with zero.
+     */
+    constexpr Fixed()
+        : raw { 0 }
+    {
+    }
+
+    /**
+     * Converts from an arithmetic value. Floating-point values are rounded to the nearest step.
+     * @tparam Number Arithmetic type.
+     * @param value Value.
+     */
+    template <typename Number, std::enable_if_t<std::is_arithmetic_v<Number>, int> = 0>
+    explicit constexpr Fixed(const Number value)
+        : raw { from_number(value) }
+    {
+    }
+
+    /**
+     * Converts from another fixed-point format rounding to the nearest step.
+     * @tparam OtherIntBits Number of integer bits of the other format.
+     * @tparam OtherFracBits Number of fractional bits of the other format.
+     * @param value Value.
+     */
+    template <uint8_t OtherIntBits, uint8_t OtherFracBits>
+    explicit constexpr Fixed(const Fixed<OtherIntBits, OtherFracBits>& value)
+        : raw { 0 }
+    {
+        if constexpr (OtherFracBits > FracBits) {
+            raw = static_cast<int32_t>(
+                (static_cast<int64_t>(value.raw) + (int64_t { 1 } << (OtherFracBits - FracBits - 1)))
+                >> (OtherFracBits - FracBits));
+        }
+        else {
+            raw = static_cast<int32_t>(static_cast<int64_t>(value.raw) * (int64_t { 1 } << (FracBits - OtherFracBits)));
+        }
+    }
+
+    /**
+     * Initialize from the stored integer.
+     * @param raw Value multiplied by 2^FracBits.
+     * @return Result.
+     */
+    static constexpr Fixed from_raw(const int32_t raw)
+    {
+        Fixed result;
+        result.raw = raw;
+        return result;
+    }
+
+    /**
+     * Largest value.
+     * @return Result.
+     */
+    static constexpr Fixed max_value()
+    {
+        return from_raw(static_cast<int32_t>((int64_t { 1 } << (IntBits + FracBits - 1)) - 1));
+    }
+
+    /**
+     * Smallest value.
+     * @return Result.
+     */
+    static constexpr Fixed min_value()
+    {
+        return from_raw(static_cast<int32_t>(-(int64_t { 1 } << (IntBits + FracBits - 1))));
+    }
+
+    /**
+     * Converts to an arithmetic value. Conversions to integers round towards zero.
+     * @tparam Number Arithmetic type.
+     * @return Result.
+     */
+    template <typename Number, std::enable_if_t<std::is_arithmetic_v<Number>, int> = 0>
+    explicit constexpr operator Number() const
+    {
+        if constexpr (std::is_integral_v<Number>) {
+            return static_cast<Number>(raw / (int32_t { 1 } << FracBits));
+        }
+        else {
+            return static_cast<Number>(raw) / static_cast<Number>(int64_t { 1 } << FracBits);
+        }
+    }
+
+    /**
+     * Addition.
+     * @param other Other value.
+     * @return Result.
+     */
+    [[nodiscard]] constexpr Fixed operator+(const Fixed& other) const
+    {
+        return from_raw(wrap(static_cast<int64_t>(raw) + other.raw));
+    }
+
+    /**
+     * Addition assignment.
+     * @param other Other value.
+     * @return Reference to this modified value.
+     */
+    constexpr Fixed& operator+=(const Fixed& other)
+    {
+        *this = *this + other;
+        return *this;
+    }
+
+    /**
+     * Subtraction.
+     * @param other Other value.
+     * @return Result.
+     */
+    [[nodiscard]] constexpr Fixed operator-(const Fixed& other) const
+    {
+        return from_raw(wrap(static_cast<int64_t>(raw) - other.raw));
+    }
+
+    /**
+     * Subtraction assignment.
+     * @param other Other value.
+     * @return Reference to this modified value.
+     */
+    constexpr Fixed& operator-=(const Fixed& other)
+    {
+        *this = *this - other;
+        return *this;
+    }
+
+    /**
+     * Multiplication rounded to the nearest step with halves rounded up.
+     * @param other Other value.
+     * @return Result.
+     */
+    [[nodiscard]] constexpr Fixed operator*(const Fixed& other) const
+    {
+        const int64_t product = static_cast<int64_t>(raw) * other.raw;
+        return from_raw(wrap((product + (int64_t { 1 } << (FracBits - 1))) >> FracBits));
+    }
+
+    /**
+     * Multiplication assignment.
+     * @param other Other value.
+     * @return Reference to this modified value.
+     */
+    constexpr Fixed& operator*=(const Fixed& other)
+    {
+        *this = *this * other;
+        return *this;
+    }
+
+    /**
+     * Division rounded towards zero. Division by zero results in the largest or smallest value with the sign of the
+     * dividend.
+     * @param other Other value.
+     * @return Result.
+     */
+    [[nodiscard]] constexpr Fixed operator/(const Fixed& other) const
+    {
+        if (other.raw == 0) {
+            return raw < 0 ? min_value() : max_value();
+        }
+        return from_raw(wrap(static_cast<int64_t>(raw) * (int64_t { 1 } << FracBits) / other.raw));
+    }
+
+    /**
+     * Division assignment.
+     * @param other Other value.
+     * @return Reference to this modified value.
+     */
+    constexpr Fixed& operator/=(const Fixed& other)
+    {
+        *this = *this / other;
+        return *this;
+    }
+
+    /**
+     * Unary plus.
+     * @return Copy of this value.
+     */
+    [[nodiscard]] constexpr Fixed operator+() const
+    {
+        return *this;
+    }
+
+    /**
+     * Negation.
+     * @return Result.
+     */
+    [[nodiscard]] constexpr Fixed operator-() const
+    {
+        return from_raw(wrap(-static_cast<int64_t>(raw)));
+    }
+
+    /**
+     * Equality.
+     * @param other Other value.
+     * @return True if equal, false otherwise.
+     */
+    [[nodiscard]] constexpr bool operator==(const Fixed& other) const
+    {
+        return raw == other.raw;
+    }
+
+    /**
+     * Inequality.
+     * @param other Other value.
+     * @return True if not equal, false otherwise.
+     */
+    [[nodiscard]] constexpr bool operator!=(const Fixed& other) const
+    {
+        return raw != other.raw;
+    }
+
+    /**
+     * Less than.
+     * @param other Other value.
+     * @return True if less than, false otherwise.
+     */
+    [[nodiscard]] constexpr bool operator<(const Fixed& other) const
+    {
+        return raw < other.raw;
+    }
+
+    /**
+     * Less than or equal.
+     * @param other Other value.
+     * @return True if less than or equal, false otherwise.
+     */
+    [[nodiscard]] constexpr bool operator<=(const Fixed& other) const
+    {
+        return raw <= other.raw;
+    }
+
+    /**
+     * Greater than.
+     * @param other Other value.
+     * @return True if greater than, false otherwise.
+     */
+    [[nodiscard]] constexpr bool operator>(const Fixed& other) const
+    {
+        return raw > other.raw;
+    }
+
+    /**
+     * Greater than or equal.
+     * @param other Other value.
+     * @return True if greater than or equal, false otherwise.
+     */
+    [[nodiscard]] constexpr bool operator>=(const Fixed& other) const
+    {
+        return raw >= other.raw;
+    }
+
+private:
+    template <typename Number>
+    static constexpr int32_t from_number(const Number value)
+    {
+        if constexpr (std::is_integral_v<Number>) {
+            return wrap(static_cast<int64_t>(value) * (int64_t { 1 } << FracBits));
+        }
+        else {
+            const double scaled = static_cast<double>(value) * static_cast<double>(int64_t { 1 } << FracBits);
+            return wrap(static_cast<int64_t>(scaled < 0.0 ? scaled - 0.5 : scaled + 0.5));
+        }
+    }
+
+    // Keeps the lowest IntBits + FracBits bits as a two's complement value.
+    static constexpr int32_t wrap(const int64_t value)
+    {
+        if constexpr (IntBits + FracBits == 32) {
+            return static_cast<int32_t>(value);
+        }
+        constexpr uint8_t unused_bits = 64 - IntBits - FracBits;
+        return static_cast<int32_t>(
+            static_cast<int64_t>(static_cast<uint64_t>(value) << unused_bits) / (int64_t { 1 } << unused_bits));
+    }
+};
+
+/**
+ * Fixed-point number with 16 integer bits and 16 fractional bits.
+ */
+using Fixed16 = Fixed<16, 16>;
+
+/**
+ * Properties of Fixed as a Real type. The epsilon value is the larger of the floating-point epsilon value and sixteen
+ * steps so that approximate comparisons allow for the rounding of a few chained operations.
+ * @tparam IntBits Number of integer bits including the sign bit.
+ * @tparam FracBits Number of fractional bits.
+ */
+template <uint8_t IntBits, uint8_t FracBits>
+class RealTraits<Fixed<IntBits, FracBits>> {
+public:
+    static constexpr Fixed<IntBits, FracBits> epsilon()
+    {
+        return max(Fixed<IntBits, FracBits>(0.00001), Fixed<IntBits, FracBits>::from_raw(16));
+    }
+
+    using Promoted = Fixed<IntBits, FracBits>;
+};
+
+/**
+ * Fixed-point helpers that work with 30 fractional bits in 64-bit integers.
+ */
+namespace fixed {
+
+/**
+ * Pi multiplied by 2^30.
+ */
+inline constexpr int64_t pi = 3373259426;
+
+/**
+ * Half of pi multiplied by 2^30.
+ */
+inline constexpr int64_t half_pi = 1686629713;
+
+/**
+ * One multiplied by 2^30.
+ */
+inline constexpr int64_t one = int64_t { 1 } << 30;
+
+/**
+ * Converts to 30 fractional bits.
+ * @tparam FracBits Number of fractional bits of the value.
+ * @param raw Value multiplied by 2^FracBits.
+ * @return Result.
+ */
+template <uint8_t FracBits>
+constexpr int64_t to_q30(const int32_t raw)
+{
+    return static_cast<int64_t>(raw) * (int64_t { 1 } << (30 - FracBits));
+}
+
+/**
+ * Converts from 30 fractional bits rounding to the nearest step.
+ * @tparam IntBits Number of integer bits including the sign bit.
+ * @tparam FracBits Number of fractional bits of the result.
+ * @param value Value multiplied by 2^30.
+ * @return Result.
+ */
+template <uint8_t IntBits, uint8_t FracBits>
+constexpr Fixed<IntBits, FracBits> from_q30(const int64_t value)
+{
+    return Fixed<IntBits, FracBits>::from_raw(
+        static_cast<int32_t>((value + (int64_t { 1 } << (29 - FracBits))) >> (30 - FracBits)));
+}
+
+/**
+ * Multiplies two values with 30 fractional bits.
+ * @param a First value.
+ * @param b Second value.
+ * @return Result.
+ */
+constexpr int64_t multiply(const int64_t a, const int64_t b)
+{
+    return a * b >> 30;
+}
+
+/**
+ * Sine and cosine of an angle with polynomials on the first quadrant. The error is below 2^-24.
+ * @param angle Angle in radians multiplied by 2^30.
+ * @param sine Output sine multiplied by 2^30.
+ * @param cosine Output cosine multiplied by 2^30.
+ */
+constexpr void sin_cos(const int64_t angle, int64_t& sine, int64_t& cosine)
+{
+    int64_t reduced = angle % (4 * half_pi);
+    if (reduced < 0) {
+        reduced += 4 * half_pi;
+    }
+    const int64_t quadrant = reduced / half_pi;
+    const int64_t x = reduced - quadrant * half_pi;
+    const int64_t x_sqrd = multiply(x, x);
+    // Taylor series to x^11 and x^12 in Horner form.
+    int64_t s = one - x_sqrd / 110;
+    s = one - multiply(x_sqrd, s) / 72;
+    s = one - multiply(x_sqrd, s) / 42;
+    s = one - multiply(x_sqrd, s) / 20;
+    s = one - multiply(x_sqrd, s) / 6;
+    s = multiply(x, s);
+    int64_t c = one - x_sqrd / 132;
+    c = one - multiply(x_sqrd, c) / 90;
+    c = one - multiply(x_sqrd, c) / 56;
+    c = one - multiply(x_sqrd, c) / 30;
+    c = one - multiply(x_sqrd, c) / 12;
+    c = one - multiply(x_sqrd, c) / 2;
+    switch (quadrant) {
+    case 0:
+        sine = s;
+        cosine = c;
+        break;
+    case 1:
+        sine = c;
+        cosine = -s;
+        break;
+    case 2:
+        sine = -s;
+        cosine = -c;
+        break;
+    default:
+        sine = -c;
+        cosine = s;
+        break;
+    }
+}
+
+/**
+ * Angle of a vector from the x-axis with CORDIC iterations. The error is below 2^-27.
+ * @param y Y value.
+ * @param x X value.
+ * @return Angle from -pi to pi multiplied by 2^30.
+ */
+constexpr int64_t atan2(int64_t y, int64_t x)
+{
+    // Angles of atan(2^-i) multiplied by 2^30.
+    constexpr int64_t angles[30] { 843314857, 497837829, 263043837, 133525159, 67021687, 33543516, 16775851, 8388437,
+                                   4194283,   2097149,   1048576,   524288,    262144,   131072,   65536,    32768,
+                                   16384,     8192,      4096,      2048,      1024,     512,      256,      128,
+                                   64,        32,        16,        8,         4,        2 };
+    if (x == 0 && y == 0) {
+        return 0;
+    }
+    // Scale up so that the larger component is from 2^29 to 2^30 and small vectors keep all the iterations.
+    int64_t magnitude = max(abs(x), abs(y));
+    int64_t scale = 1;
+    for (uint8_t step = 16; step != 0; step /= 2) {
+        if (magnitude << step < one) {
+            magnitude <<= step;
+            scale <<= step;
+        }
+    }
+    x *= scale;
+    y *= scale;
+    int64_t angle = 0;
+    if (x < 0) {
+        angle = y >= 0 ? pi : -pi;
+        x = -x;
+        y = -y;
+    }
+    // Rotates towards the x-axis with masks instead of branches since the direction of each step is unpredictable.
+    for (uint8_t i = 0; i < 30; ++i) {
+        const int64_t mask = -static_cast<int64_t>(y <= 0);
+        const int64_t x_shifted = x >> i;
+        const int64_t y_shifted = y >> i;
+        x += (y_shifted ^ mask) - mask;
+        y -= (x_shifted ^ mask) - mask;
+        angle += (angles[i] ^ mask) - mask;
+    }
+    return angle;
+}
+
+}
+
+/**
+ * Square-root of a fixed-point value rounded to the nearest step.
+ * @tparam IntBits Number of integer bits including the sign bit.
+ * @tparam FracBits Number of fractional bits.
+ * @param value Value to square-root where negative values result in zero.
+ * @return Result.
+ */
+template <uint8_t IntBits, uint8_t FracBits>
+Fixed<IntBits, FracBits> sqrt(const Fixed<IntBits, FracBits> value)
+{
+    if (value.raw <= 0) {
+        return Fixed<IntBits, FracBits>();
+    }
+    const uint64_t squared = static_cast<uint64_t>(value.raw) << FracBits;
+    // The floating-point square-root is only an estimate which is corrected with integers so the result is exact.
+    auto result = static_cast<uint64_t>(std::sqrt(static_cast<double>(squared)));
+    while (result * result > squared) {
+        --result;
+    }
+    while ((result + 1) * (result + 1) <= squared) {
+        ++result;
+    }
+    if (squared - result * result > result) {
+        ++result;
+    }
+    return Fixed<IntBits, FracBits>::from_raw(static_cast<int32_t>(result));
+}
+
+/**
+ * Sine of a fixed-point value.
+ * @tparam IntBits Number of integer bits including the sign bit.
+ * @tparam FracBits Number of fractional bits.
+ * @param value Value to take the sine of in radians.
+ * @return Result.
+ */
+template <uint8_t IntBits, uint8_t FracBits>
+constexpr Fixed<IntBits, FracBits> sin(const Fixed<IntBits, FracBits> value)
+{
+    int64_t sine = 0;
+    int64_t cosine = 0;
+    fixed::sin_cos(fixed::to_q30<FracBits>(value.raw), sine, cosine);
+    return fixed::from_q30<IntBits, FracBits>(sine);
+}
+
+/**
+ * Cosine of a fixed-point value.
+ * @tparam IntBits Number of integer bits including the sign bit.
+ * @tparam FracBits Number of fractional bits.
+ * @param value Value to take the cosine of in radians.
+ * @return Result.
+ */
+template <uint8_t IntBits, uint8_t FracBits>
+constexpr Fixed<IntBits, FracBits> cos(const Fixed<IntBits, FracBits> value)
+{
+    int64_t sine = 0;
+    int64_t cosine = 0;
+    fixed::sin_cos(fixed::to_q30<FracBits>(value.raw), sine, cosine);
+    return fixed::from_q30<IntBits, FracBits>(cosine);
+}
+
+/**
+ * Tangent of a fixed-point value.
+ * @tparam IntBits Number of integer bits including the sign bit.
+ * @tparam FracBits Number of fractional bits.
+ * @param value Value to take the tangent of in radians.
+ * @return Result.
+ */
+template <uint8_t IntBits, uint8_t FracBits>
+constexpr Fixed<IntBits, FracBits> tan(const Fixed<IntBits, FracBits> value)
+{
+    int64_t sine = 0;
+    int64_t cosine = 0;
+    fixed::sin_cos(fixed::to_q30<FracBits>(value.raw), sine, cosine);
+    return fixed::from_q30<IntBits, FracBits>(sine) / fixed::from_q30<IntBits, FracBits>(cosine);
+}
+
+/**
+ * Inverse tangent of a fixed-point value that takes into account all four-quadrants.
+ * @tparam IntBits Number of integer bits including the sign bit.
+ * @tparam FracBits Number of fractional bits.
+ * @param y Y value.
+ * @param x X value.
+ * @return Result in radians which is zero if both values are zero.
+ */
+template <uint8_t IntBits, uint8_t FracBits>
+constexpr Fixed<IntBits, FracBits> atan2(const Fixed<IntBits, FracBits> y, const Fixed<IntBits, FracBits> x)
+{
+    return fixed::from_q30<IntBits, FracBits>(fixed::atan2(y.raw, x.raw));
+}
+
+/**
+ * Inverse tangent of a fixed-point value.
+ * @tparam IntBits Number of integer bits including the sign bit.
+ * @tparam FracBits Number of fractional bits.
+ * @param value Value to take the inverse tangent of.
+ * @return Result in radians.
+ */
+template <uint8_t IntBits, uint8_t FracBits>
+constexpr Fixed<IntBits, FracBits> atan(const Fixed<IntBits, FracBits> value)
+{
+    return atan2(value, Fixed<IntBits, FracBits>(1));
+}
+
+/**
+ * Inverse sine of a fixed-point value.
+ * @tparam IntBits Number of integer bits including the sign bit.
+ * @tparam FracBits Number of fractional bits.
+ * @param value Value to take the inverse sine of which is clamped from -1 to 1.
+ * @return Result in radians.
+ */
+template <uint8_t IntBits, uint8_t FracBits>
+constexpr Fixed<IntBits, FracBits> asin(const Fixed<IntBits, FracBits> value)
+{
+    const auto one = Fixed<IntBits, FracBits>(1);
+    const Fixed<IntBits, FracBits> clamped = clamp(value, -one, one);
+    return atan2(clamped, sqrt(one - clamped * clamped));
+}
+
+/**
+ * Inverse cosine of a fixed-point value.
+ * @tparam IntBits Number of integer bits including the sign bit.
+ * @tparam FracBits Number of fractional bits.
+ * @param value Value to take the inverse cosine of which is clamped from -1 to 1.
+ * @return Result in radians.
+ */
+template <uint8_t IntBits, uint8_t FracBits>
+constexpr Fixed<IntBits, FracBits> acos(const Fixed<IntBits, FracBits> value)
+{
+    const auto one = Fixed<IntBits, FracBits>(1);
+    const Fixed<IntBits, FracBits> clamped = clamp(value, -one, one);
+    return atan2(sqrt(one - clamped * clamped), clamped);
+}
+
+/**
+ * The greatest integer value less or equal to a fixed-point value.
+ * @tparam IntBits Number of integer bits including the sign bit.
+ * @tparam FracBits Number of fractional bits.
+ * @param value Value to take the floor of.
+ * @return Result.
+ */
+template <uint8_t IntBits, uint8_t FracBits>
+constexpr Fixed<IntBits, FracBits> floor(const Fixed<IntBits, FracBits> value)
+{
+    constexpr int32_t step = int32_t { 1 } << FracBits;
+    const int32_t fraction = value.raw % step;
+    return Fixed<IntBits, FracBits>::from_raw(value.raw - fraction - (fraction < 0 ? step : 0));
+}
+
+/**
+ * The least integer value greater or equal to a fixed-point value.
+ * @tparam IntBits Number of integer bits including the sign bit.
+ * @tparam FracBits Number of fractional bits.
+ * @param value Value to take the ceiling of.
+ * @return Result.
+ */
+template <uint8_t IntBits, uint8_t FracBits>
+constexpr Fixed<IntBits, FracBits> ceil(const Fixed<IntBits, FracBits> value)
+{
+    return -floor(-value);
+}
+
+/**
+ * Rounds a fixed-point value to the nearest integer value with halves rounded away from zero.
+ * @tparam IntBits Number of integer bits including the sign bit.
+ * @tparam FracBits Number of fractional bits.
+ * @param value Value to round.
+ * @return Result.
+ */
+template <uint8_t IntBits, uint8_t FracBits>
+constexpr Fixed<IntBits, FracBits> round(const Fixed<IntBits, FracBits> value)
+{
+    const auto half = Fixed<IntBits, FracBits>::from_raw(int32_t { 1 } << (FracBits - 1));
+    if (value.raw < 0) {
+        return -floor(half - value);
+    }
+    return floor(value + half);
+}
+
+/**
+ * Remainder of the division between two fixed-point values with the sign of the dividend.
+ * @tparam IntBits Number of integer bits including the sign bit.
+ * @tparam FracBits Number of fractional bits.
+ * @param dividend Dividend.
+ * @param divisor Divisor where zero results in zero.
+ * @return Result.
+ */
+template <uint8_t IntBits, uint8_t FracBits>
+constexpr Fixed<IntBits, FracBits> remf(const Fixed<IntBits, FracBits> dividend, const Fixed<IntBits, FracBits> divisor)
+{
+    if (divisor.raw == 0) {
+        return Fixed<IntBits, FracBits>();
+    }
+    return Fixed<IntBits, FracBits>::from_raw(dividend.raw % divisor.raw);
+}
+
+/**
+ * Fixed-point mathematical modulus where the result has the sign of the divisor.
+ * @tparam IntBits Number of integer bits including the sign bit.
+ * @tparam FracBits Number of fractional bits.
+ * @param dividend Dividend.
+ * @param divisor Divisor where zero results in zero.
+ * @return Result.
+ */
+template <uint8_t IntBits, uint8_t FracBits>
+constexpr Fixed<IntBits, FracBits> modf(const Fixed<IntBits, FracBits> dividend, const Fixed<IntBits, FracBits> divisor)
+{
+    const Fixed<IntBits, FracBits> result = remf(dividend, divisor);
+    if ((result.raw < 0 && divisor.raw > 0) || (result.raw > 0 && divisor.raw < 0)) {
+        return result + divisor;
+    }
+    return result;
+}
+
+}
+
+#endif
@@ -0,0 +1,196 @@
+/* NNM - "No Nonsense Math"
+ * v0.5.0
+ * Copyright (c) 2025-present Matthew Oros
+ * Licensed under MIT
+ */
+
+#ifndef NNM_FWD_HPP
+#define NNM_FWD_HPP
+
+#include <cstdint>
+
+namespace nnm {
+
+template <typename Real>
+class Vector2;
+using Vector2f = Vector2<float>;
+using Vector2d = Vector2<double>;
+template <typename Int>
+class Vector2i;
+using Vector2ii = Vector2i<int>;
+using Vector2i8 = Vector2i<int8_t>;
+using Vector2i16 = Vector2i<int16_t>;
+using Vector2i32 = Vector2i<int32_t>;
+using Vector2i64 = Vector2i<int64_t>;
+using Vector2iu = Vector2i<unsigned int>;
+using Vector2u8 = Vector2i<uint8_t>;
+using Vector2u16 = Vector2i<uint16_t>;
+using Vector2u32 = Vector2i<uint32_t>;
+using Vector2u64 = Vector2i<uint64_t>;
+template <typename Real>
+class Vector3;
+using Vector3f = Vector3<float>;
+using Vector3d = Vector3<double>;
+template <typename Int>
+class Vector3i;
+using Vector3ii = Vector3i<int>;
+using Vector3i8 = Vector3i<int8_t>;
+using Vector3i16 = Vector3i<int16_t>;
+using Vector3i32 = Vector3i<int32_t>;
+using Vector3i64 = Vector3i<int64_t>;
+using Vector3iu = Vector3i<unsigned int>;
+using Vector3u8 = Vector3i<uint8_t>;
+using Vector3u16 = Vector3i<uint16_t>;
+using Vector3u32 = Vector3i<uint32_t>;
+using Vector3u64 = Vector3i<uint64_t>;
+template <typename Real>
+class Vector4;
+using Vector4f = Vector4<float>;
+using Vector4d = Vector4<double>;
+template <typename Real>
+class Quaternion;
+using QuaternionF = Quaternion<float>;
+using QuaternionD = Quaternion<double>;
+template <typename Real>
+class Matrix2;
+using Matrix2f = Matrix2<float>;
+using Matrix2d = Matrix2<double>;
+template <typename Real>
+class Basis2;
+using Basis2f = Basis2<float>;
+using Basis2d = Basis2<double>;
+template <typename Real>
+class Matrix3;
+using Matrix3f = Matrix3<float>;
+using Matrix3d = Matrix3<double>;
+template <typename Real>
+class Transform2;
+using Transform2f = Transform2<float>;
+using Transform2d = Transform2<double>;
+template <typename Real>
+class Basis3;
+using Basis3f = Basis3<float>;
+using Basis3d = Basis3<double>;
+template <typename Real>
+class Matrix4;
+using Matrix4f = Matrix4<float>;
+using Matrix4d = Matrix4<double>;
+template <typename Real>
+class Transform3;
+using Transform3f = Transform3<float>;
+using Transform3d = Transform3<double>;
+template <typename Real>
+class TransformTRS3;
+using TransformTRS3f = TransformTRS3<float>;
+using TransformTRS3d = TransformTRS3<double>;
+template <typename Real>
+class AABB3;
+using AABB3f = AABB3<float>;
+using AABB3d = AABB3<double>;
+template <typename Real>
+class OBB3;
+using OBB3f = OBB3<float>;
+using OBB3d = OBB3<double>;
+template <typename Real>
+class Ray3;
+using Ray3f = Ray3<float>;
+using Ray3d = Ray3<double>;
+template <typename Real, uint8_t Size>
+class Ray3Packet;
+using Ray3Packet4f = Ray3Packet<float, 4>;
+using Ray3Packet8f = Ray3Packet<float, 8>;
+using Ray3Packet4d = Ray3Packet<double, 4>;
+template <typename Real>
+class Plane3;
+using Plane3f = Plane3<float>;
+using Plane3d = Plane3<double>;
+template <typename Real>
+class Sphere3;
+using Sphere3f = Sphere3<float>;
+using Sphere3d = Sphere3<double>;
+template <uint8_t Size>
+class Maskx;
+using Maskx4 = Maskx<4>;
+using Maskx8 = Maskx<8>;
+using Maskx16 = Maskx<16>;
+template <typename Real, uint8_t Size>
+class Scalarx;
+using Scalarx4f = Scalarx<float, 4>;
+using Scalarx8f = Scalarx<float, 8>;
+using Scalarx16f = Scalarx<float, 16>;
+using Scalarx4d = Scalarx<double, 4>;
+template <typename Real, uint8_t Size>
+class Vector3x;
+using Vector3x4f = Vector3x<float, 4>;
+using Vector3x8f = Vector3x<float, 8>;
+using Vector3x16f = Vector3x<float, 16>;
+using Vector3x4d = Vector3x<double, 4>;
+template <typename Real, uint8_t Size>
+class Vector4x;
+using Vector4x4f = Vector4x<float, 4>;
+using Vector4x8f = Vector4x<float, 8>;
+using Vector4x16f = Vector4x<float, 16>;
+using Vector4x4d = Vector4x<double, 4>;
+template <typename Real, uint8_t Size>
+class Quaternionx;
+using Quaternionx4f = Quaternionx<float, 4>;
+using Quaternionx8f = Quaternionx<float, 8>;
+using Quaternionx16f = Quaternionx<float, 16>;
+using Quaternionx4d = Quaternionx<double, 4>;
+template <typename Real, uint8_t Size>
+class Matrix4x;
+using Matrix4x4f = Matrix4x<float, 4>;
+using Matrix4x8f = Matrix4x<float, 8>;
+using Matrix4x16f = Matrix4x<float, 16>;
+using Matrix4x4d = Matrix4x<double, 4>;
+template <typename Real>
+class Vector3A;
+using Vector3Af = Vector3A<float>;
+using Vector3Ad = Vector3A<double>;
+template <typename Real>
+class Vector4A;
+using Vector4Af = Vector4A<float>;
+using Vector4Ad = Vector4A<double>;
+template <typename Real>
+class Matrix4A;
+using Matrix4Af = Matrix4A<float>;
+using Matrix4Ad = Matrix4A<double>;
+template <typename Real>
+class Transform3A;
+using Transform3Af = Transform3A<float>;
+using Transform3Ad = Transform3A<double>;
+class Vector3h;
+class Vector3snorm16;
+class Vector4unorm8;
+class Vector3oct16;
+template <uint8_t Bits>
+class QuaternionPacked;
+using QuaternionPacked32 = QuaternionPacked<32>;
+using QuaternionPacked48 = QuaternionPacked<48>;
+class Vector3Split;
+template <typename Value>
+class StridedSpan;
+#if defined(__FLT16_MAX__)
+using Vector2f16 = Vector2<_Float16>;
+using Vector3f16 = Vector3<_Float16>;
+using Vector4f16 = Vector4<_Float16>;
+using QuaternionF16 = Quaternion<_Float16>;
+using Matrix2f16 = Matrix2<_Float16>;
+using Matrix3f16 = Matrix3<_Float16>;
+using Matrix4f16 = Matrix4<_Float16>;
+using Transform3f16 = Transform3<_Float16>;
+#endif
+#if defined(__BFLT16_MAX__)
+using Vector2bf16 = Vector2<__bf16>;
+using Vector3bf16 = Vector3<__bf16>;
+using Vector4bf16 = Vector4<__bf16>;
+using QuaternionBF16 = Quaternion<__bf16>;
+using Matrix2bf16 = Matrix2<__bf16>;
+using Matrix3bf16 = Matrix3<__bf16>;
+using Matrix4bf16 = Matrix4<__bf16>;
+using Transform3bf16 = Transform3<__bf16>;
+#endif
+
+}
+
+#endif
@@ -0,0 +1,415 @@
+/* NNM - "No Nonsense Math"
+ * v0.5.0
+ * Copyright (c) 2025-present Matthew Oros
+ * Licensed under MIT
+ */
+
+#ifndef NNM_GPU_HPP
+#define NNM_GPU_HPP
+
+#include <nnm/nnm.hpp>
+
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+
+namespace nnm::gpu {
+
+/**
+ * Memory layout of a uniform or shader storage block.
+ */
+enum class Layout : uint8_t {
+    /**
+     * Arrays, array strides, and matrix columns are aligned to 16 bytes.
+     */
+    std140,
+    /**
+     * Same as std140 except arrays and matrix columns are aligned to their elements.
+     */
+    std430
+};
+
+/**
+ * Order that matrices are stored in a buffer.
+ */
+enum class MatrixOrder : uint8_t {
+    /**
+     * Matrix is stored as an array of columns which is the default of GLSL and the order of NNM matrices.
+     */
+    column_major,
+    /**
+     * Matrix is stored as an array of rows which is declared with row_major in GLSL.
+     */
+    row_major
+};
+
+/**
+ * Shape of a type that can be written to a buffer. Specialized for scalars, vectors, and matrices.
+ * @tparam Value Type.
+ */
+template <typename Value>
+class Shape;
+
+/**
+ * Shape of a type with the memory layout of an array of columns.
+ * @tparam Real Component type.
+ * @tparam Columns Number of columns which is one for scalars and vectors.
+ * @tparam Rows Number of rows which is the number of components for scalars and vectors.
+ * @tparam ColumnStride Number of bytes between the columns of the type in memory.
+ */
+template <typename Real, uint8_t Columns, uint8_t Rows, size_t ColumnStride>
+class ColumnShape {
+public:
+    using Component = Real;
+
+    /**
+     * Number of columns.
+     */
+    static constexpr uint8_t columns = Columns;
+
+    /**
+     * Number of rows.
+     */
+    static constexpr uint8_t rows = Rows;
+
+    /**
+     * Number of bytes between the columns of the type in memory.
+     */
+    static constexpr size_t column_stride = ColumnStride;
+};
+
+template <>
+class Shape<float> : public ColumnShape<float, 1, 1, sizeof(float)> { };
+
+template <>
+class Shape<double> : public ColumnShape<double, 1, 1, sizeof(double)> { };
+
+template <typename Real>
+class Shape<Vector2<Real>> : public ColumnShape<Real, 1, 2, sizeof(Vector2<Real>)> { };
+
+template <typename Real>
+class Shape<Vector3<Real>> : public ColumnShape<Real, 1, 3, sizeof(Vector3<Real>)> { };
+
+template <typename Real>
+class Shape<Vector4<Real>> : public ColumnShape<Real, 1, 4, sizeof(Vector4<Real>)> { };
+
+template <typename Real>
+class Shape<Quaternion<Real>> : public ColumnShape<Real, 1, 4, sizeof(Quaternion<Real>)> { };
+
+template <typename Real>
+class Shape<Matrix2<Real>> : public ColumnShape<Real, 2, 2, sizeof(Vector2<Real>)> { };
+
+template <typename Real>
+class Shape<Basis2<Real>> : public ColumnShape<Real, 2, 2, sizeof(Vector2<Real>)> { };
+
+template <typename Real>
+class Shape<Matrix3<Real>> : public ColumnShape<Real, 3, 3, sizeof(Vector3<Real>)> { };
+
+template <typename Real>
+class Shape<Basis3<Real>> : public ColumnShape<Real, 3, 3, sizeof(Vector3<Real>)> { };
+
+template <typename Real>
+class Shape<Transform2<Real>> : public ColumnShape<Real, 3, 3, sizeof(Vector3<Real>)> { };
+
+template <typename Real>
+class Shape<Matrix4<Real>> : public ColumnShape<Real, 4, 4, sizeof(Vector4<Real>)> { };
+
+template <typename Real>
+class Shape<Transform3<Real>> : public ColumnShape<Real, 4, 4, sizeof(Vector4<Real>)> { };
+
+template <typename Real>
+class Shape<Vector3A<Real>> : public ColumnShape<Real, 1, 3, sizeof(Vector3A<Real>)> { };
+
+template <typename Real>
+class Shape<Vector4A<Real>> : public ColumnShape<Real, 1, 4, sizeof(Vector4A<Real>)> { };
+
+template <typename Real>
+class Shape<Matrix4A<Real>> : public ColumnShape<Real, 4, 4, sizeof(Vector4<Real>)> { };
+
+template <typename Real>
+class Shape<Transform3A<Real>> : public ColumnShape<Real, 4, 4, sizeof(Vector4<Real>)> { };
+
+/**
+ * Rounds up to a multiple.
+ * @param value Value.
+ * @param multiple Multiple which must be positive.
+ * @return Result.
+ */
+constexpr size_t round_up(const size_t value, const size_t multiple)
+{
+    return (value + multiple - 1) / multiple * multiple;
+}
+
+/**
+ * Number of vectors a type is stored as in a buffer which is its columns, or its rows if it is a row-major matrix.
+ * Scalars and vectors are a single vector in either order.
+ * @tparam Value Type.
+ * @param order Matrix order.
+ * @return Result.
+ */
+template <typename Value>
+constexpr uint8_t vector_count(const MatrixOrder order)
+{
+    if (Shape<Value>::columns == 1) {
+        return 1;
+    }
+    return order == MatrixOrder::row_major ? Shape<Value>::rows : Shape<Value>::columns;
+}
+
+/**
+ * Number of components in each vector a type is stored as in a buffer.
+ * @tparam Value Type.
+ * @param order Matrix order.
+ * @return Result.
+ */
+template <typename Value>
+constexpr uint8_t vector_length(const MatrixOrder order)
+{
+    if (Shape<Value>::columns == 1) {
+        return Shape<Value>::rows;
+    }
+    return order == MatrixOrder::row_major ? Shape<Value>::columns : Shape<Value>::rows;
+}
+
+/**
+ * Base alignment of a type in a buffer.
+ * @tparam Value Type.
+ * @param layout Layout.
+ * @param order Matrix order.
+ * @return Result in bytes.
+ */
+template <typename Value>
+constexpr size_t alignment(const Layout layout, const MatrixOrder order = MatrixOrder::column_major)
+{
+    const uint8_t length = vector_length<Value>(order);
+    // Three component vectors are aligned like four component vectors.
+    const size_t result = sizeof(typename Shape<Value>::Component) * (length == 3 ? 4 : length);
+    if (layout == Layout::std140 && vector_count<Value>(order) > 1) {
+        return round_up(result, 16);
+    }
+    return result;
+}
+
+/**
+ * Number of bytes a type occupies in a buffer not including padding after it.
+ * @tparam Value Type.
+ * @param layout Layout.
+ * @param order Matrix order.
+ * @return Result.
+ */
+template <typename Value>
+constexpr size_t size(const Layout layout, const MatrixOrder order = MatrixOrder::column_major)
+{
+    if (vector_count<Value>(order) == 1) {
+        return sizeof(typename Shape<Value>::Component) * vector_length<Value>(order);
+    }
+    return vector_count<Value>(order) * alignment<Value>(layout, order);
+}
+
+/**
+ * Base alignment of an array of a type in a buffer.
+ * @tparam Value Type.
+ * @param layout Layout.
+ * @param order Matrix order.
+ * @return Result in bytes.
+ */
+template <typename Value>
+constexpr size_t array_alignment(const Layout layout, const MatrixOrder order = MatrixOrder::column_major)
+{
+    if (layout == Layout::std140) {
+        return round_up(alignment<Value>(layout, order), 16);
+    }
+    return alignment<Value>(layout, order);
+}
+
+/**
+ * Number of bytes between the elements of an array of a type in a buffer.
+ * @tparam Value Type.
+ * @param layout Layout.
+ * @param order Matrix order.
+ * @return Result.
+ */
+template <typename Value>
+constexpr size_t array_stride(const Layout layout, const MatrixOrder order = MatrixOrder::column_major)
+{
+    return round_up(size<Value>(layout, order), array_alignment<Value>(layout, order));
+}
+
+/**
+ * Base alignment of a struct in a buffer.
+ * @param layout Layout.
+ * @param member_alignment Largest base alignment of the members of the struct.
+ * @return Result in bytes.
+ */
+constexpr size_t struct_alignment(const Layout layout, const size_t member_alignment)
+{
+    return layout == Layout::std140 ? round_up(member_alignment, 16) : member_alignment;
+}
+
+/**
+ * Writes an array of values into a buffer with a layout. Padding in the buffer is left unchanged unless the values
+ * are copied with their padding. Types whose memory already matches the layout, such as Matrix4, Transform3, Vector4,
+ * Quaternion, and Vector3A, are copied with a single memcpy.
+ * @tparam Value Type.
+ * @param values Input values.
+ * @param count Number of values.
+ * @param layout Layout.
+ * @param buffer Output buffer of at least count * array_stride<Value>(layout, order) bytes.
+ * @param order Matrix order.
+ * @return Number of bytes written which is count * array_stride<Value>(layout, order).
+ */
+template <typename Value>
+size_t write_array(
+    const Value* values,
+    const size_t count,
+    const Layout layout,
+    void* buffer,
+    const MatrixOrder order = MatrixOrder::column_major)
+{
+    using Real = typename Shape<Value>::Component;
+    constexpr uint8_t columns = Shape<Value>::columns;
+    constexpr uint8_t rows = Shape<Value>::rows;
+    constexpr size_t column_stride = Shape<Value>::column_stride;
+    const size_t stride = array_stride<Value>(layout, order);
+    const size_t destination_vector_stride = alignment<Value>(layout, order);
+    const bool transposed = columns > 1 && order == MatrixOrder::row_major;
+    const auto source = reinterpret_cast<const std::byte*>(values);
+    const auto destination = static_cast<std::byte*>(buffer);
+    if (!transposed && sizeof(Value) == stride && (columns == 1 || column_stride == destination_vector_stride)) {
+        std::memcpy(destination, source, count * stride);
+        return count * stride;
+    }
+    if (!transposed) {
+        for (size_t i = 0; i < count; ++i) {
+            for (uint8_t c = 0; c < columns; ++c) {
+                std::memcpy(
+                    destination + i * stride + c * destination_vector_stride,
+                    source + i * sizeof(Value) + c * column_stride,
+                    sizeof(Real) * rows);
+            }
+        }
+        return count * stride;
+    }
+    for (size_t i = 0; i < count; ++i) {
+        for (uint8_t r = 0; r < rows; ++r) {
+            for (uint8_t c = 0; c < columns; ++c) {
+                std::memcpy(
+                    destination + i * stride + r * destination_vector_stride + c * sizeof(Real),
+                    source + i * sizeof(Value) + c * column_stride + r * sizeof(Real),
+                    sizeof(Real));
+            }
+        }
+    }
+    return count * stride;
+}
+
+/**
+ * Writes a single value into a buffer with a layout. Padding in the buffer is left unchanged.
+ * @tparam Value Type.
+ * @param value Value.
+ * @param layout Layout.
+ * @param buffer Output buffer of at least size<Value>(layout, order) bytes.
+ * @param order Matrix order.
+ * @return Number of bytes written which is size<Value>(layout, order).
+ */
+template <typename Value>
+size_t write(
+    const Value& value, const Layout layout, void* buffer, const MatrixOrder order = MatrixOrder::column_major)
+{
+    using Real = typename Shape<Value>::Component;
+    if (vector_count<Value>(order) == 1) {
+        std::memcpy(buffer, &value, sizeof(Real) * vector_length<Value>(order));
+        return size<Value>(layout, order);
+    }
+    // A matrix is stored the same as an array of one matrix without the padding after it.
+    write_array(&value, 1, layout, buffer, order);
+    return size<Value>(layout, order);
+}
+
+/**
+ * Writes the members of a uniform or shader storage block, or of an array of blocks, one after another while
+ * following the alignment rules of a layout.
+ */
+class Writer {
+public:
+    /**
+     * Start of the output buffer.
+     */
+    std::byte* buffer;
+
+    /**
+     * Byte offset in the buffer where the next member is written.
+     */
+    size_t offset;
+
+    /**
+     * Layout.
+     */
+    Layout layout;
+
+    /**
+     * Matrix order.
+     */
+    MatrixOrder order;
+
+    /**
+     * Initialize at the start of a buffer.
+     * @param buffer Output buffer which must be large enough for every member written.
+     * @param layout Layout.
+     * @param order Matrix order.
+     */
+    Writer(void* buffer, const Layout layout, const MatrixOrder order = MatrixOrder::column_major)
+        : buffer { static_cast<std::byte*>(buffer) }
+        , offset { 0 }
+        , layout { layout }
+        , order { order }
+    {
+    }
+
+    /**
+     * Moves the offset forward to a multiple of an alignment.
+     * @param alignment Alignment in bytes.
+     */
+    void align(const size_t alignment)
+    {
+        offset = round_up(offset, alignment);
+    }
+
+    /**
+     * Moves the offset to the start or end of a struct. Call before the first member and after the last member.
+     * @param member_alignment Largest base alignment of the members of the struct.
+     */
+    void align_struct(const size_t member_alignment)
+    {
+        align(struct_alignment(layout, member_alignment));
+    }
+
+    /**
+     * Writes a member after aligning the offset.
+     * @tparam Value Type.
+     * @param value Value.
+     */
+    template <typename Value>
+    void write(const Value& value)
+    {
+        align(alignment<Value>(layout, order));
+        offset += gpu::write(value, layout, buffer + offset, order);
+    }
+
+    /**
+     * Writes an array member after aligning the offset.
+     * @tparam Value Type.
+     * @param values Values.
+     * @param count Number of values.
+     */
+    template <typename Value>
+    void write_array(const Value* values, const size_t count)
+    {
+        align(array_alignment<Value>(layout, order));
+        offset += gpu::write_array(values, count, layout, buffer + offset, order);
+    }
+};
+
+}
+
+#endif
@@ -0,0 +1,838 @@
+/* NNM - "No Nonsense Math"
+ * v0.5.0
+ * Copyright (c) 2025-present Matthew Oros
+ * Licensed under MIT
+ */
+
+#ifndef NNM_MATRIX3_HPP
+#define NNM_MATRIX3_HPP
+
+#include <nnm/matrix2.hpp>
+#include <nnm/vector3.hpp>
+
+#include <cstdint>
+#include <optional>
+
+namespace nnm {
+
+/**
+ * 3x3 matrix.
+ * @tparam Real Floating-point type.
+ */
+template <typename Real>
+class Matrix3 {
+public:
+    Vector3<Real> columns[3];
+
+    /**
+     * Initialize with identity matrix.
+     */
+    constexpr Matrix3()
+        : columns { { static_cast<Real>(1), static_cast<Real>(0), static_cast<Real>(0) },
+                    { static_cast<Real>(0), static_cast<Real>(1), static_cast<Real>(0) },
+                    { static_cast<Real>(0), static_cast<Real>(0), static_cast<Real>(1) } }
+    {
+    }
+
+    /**
+     * Case from other matrix type.
+     * @tparam Other Other matrix type.
+     * @param matrix Matrix to cast from
+     */
+    template <typename Other>
+    explicit constexpr Matrix3(const Matrix3<Other>& matrix)
+        : columns { { static_cast<Real>(matrix.columns[0].x),
+                      static_cast<Real>(matrix.columns[0].y),
+                      static_cast<Real>(matrix.columns[0].z) },
+                    { static_cast<Real>(matrix.columns[1].x),
+                      static_cast<Real>(matrix.columns[1].y),
+                      static_cast<Real>(matrix.columns[1].z) },
+                    { static_cast<Real>(matrix.columns[2].x),
+                      static_cast<Real>(matrix.columns[2].y),
+                      static_cast<Real>(matrix.columns[2].z) } }
+    {
+    }
+
+    /**
+     * Initialize with columns.
+     * @param column0 First column.
+     * @param column1 Second column.
+     * @param column2 Third column.
+     */
+    NNM_FORCE_INLINE constexpr Matrix3(
+        const Vector3<Real>& column0, const Vector3<Real>& column1, const Vector3<Real>& column2)
+        : columns { column0, column1, column2 }
+    {
+    }
+
+    /**
+     * Initialize with elements.
+     * @param col0_row0 First column, first row
+     * @param col0_row1 First column, second row
+     * @param col0_row2 First column, third row
+     * @param col1_row0 Second column, first row
+     * @param col1_row1 Second column, second row
+     * @param col1_row2 Second column, third row
+     * @param col2_row0 Third column, first row
+     * @param col2_row1 Third column, second row
+     * @param col2_row2 Third column, third row
+     */
+    NNM_FORCE_INLINE constexpr Matrix3(
+        const Real col0_row0,
+        const Real col0_row1,
+        const Real col0_row2,
+        const Real col1_row0,
+        const Real col1_row1,
+        const Real col1_row2,
+        const Real col2_row0,
+        const Real col2_row1,
+        const Real col2_row2)
+        : columns { { col0_row0, col0_row1, col0_row2 },
+                    { col1_row0, col1_row1, col1_row2 },
+                    { col2_row0, col2_row1, col2_row2 } }
+    {
+    }
+
+    /**
+     * Matrix with all elements equal to value.
+     * @param value Value.
+     * @return Result.
+     */
+    [[nodiscard]] static constexpr Matrix3 all(const Real value)
+    {
+        return { { value, value, value }, { value, value, value }, { value, value, value } };
+    }
+
+    /**
+     * Matrix with all elements zero.
+     * @return Result.
+     */
+    [[nodiscard]] static constexpr Matrix3 zero()
+    {
+        return all(static_cast<Real>(0));
+    }
+
+    /**
+     * Matrix with all elements one.
+     * @return Result.
+     */
+    [[nodiscard]] static constexpr Matrix3 one()
+    {
+        return all(static_cast<Real>(1));
+    }
+
+    /**
+     * Identity matrix.
+     * @return Result.
+     */
+    [[nodiscard]] static constexpr Matrix3 identity()
+    {
+        return { { static_cast<Real>(1), static_cast<Real>(0), static_cast<Real>(0) },
+                 { static_cast<Real>(0), static_cast<Real>(1), static_cast<Real>(0) },
+                 { static_cast<Real>(0), static_cast<Real>(0), static_cast<Real>(1) } };
+    }
+
+    /**
+     * Sum of matrix diagonal.
+     * @return Result.
+     */
+    [[nodiscard]] constexpr Real trace() const
+    {
+        return at(0, 0) + at(1, 1) + at(2, 2);
+    }
+
+    /**
+     * Matrix determinant.
+     * @return Result.
+     */
+    [[nodiscard]] constexpr Real determinant() const
+    {
+        Real det = static_cast<Real>(0);
+        for (uint8_t c = 0; c < 3; ++c) {
+            const Real det_minor = minor_at(c, 0);
+            det += (c % 2 == 0 ? static_cast<Real>(1) : -static_cast<Real>(1)) * at(c, 0) * det_minor;
+        }
+        return det;
+    }
+
+    /**
+     * Minor matrix at column and row which is the resulting 2x2 matrix with that column and row excluded.
+     * @param column Column.
+     * @param row Row.
+     * @return Resulting 2x2 matrix.
+     */
+    [[nodiscard]] constexpr Matrix2<Real> minor_matrix_at(const uint8_t column, const uint8_t row) const
+    {
+        NNM_BOUNDS_CHECK_ASSERT("Matrix3", column <= 2 && row <= 2);
+        Matrix2<Real> minor_matrix;
+        // Indices into this matrix are derived from the loop indices so that they are known to be in bounds.
+        for (uint8_t c = 0; c < 2; ++c) {
+            const auto from_column = static_cast<uint8_t>(c < column ? c : c + 1);
+            for (uint8_t r = 0; r < 2; ++r) {
+                minor_matrix.at(c, r) = at(from_column, static_cast<uint8_t>(r < row ? r : r + 1));
+            }
+        }
+        return minor_matrix;
+    }
+
+    /**
+     * Minor at column and row which is the determinant of the minor matrix at that column and row.
+     * @param column Column.
+     * @param row Row.
+     * @return Result.
+     */
+    [[nodiscard]] constexpr Real minor_at(const uint8_t column, const uint8_t row) const
+    {
+        NNM_BOUNDS_CHECK_ASSERT("Matrix3", column <= 2 && row <= 2);
+        return minor_matrix_at(column, row).determinant();
+    }
+
+    /**
+     * Minor matrix.
+     * @return Result.
+     */
+    [[nodiscard]] constexpr Matrix3 minor() const
+    {
+        Matrix3 result;
+        for (uint8_t c = 0; c < 3; ++c) {
+            for (uint8_t r = 0; r < 3; ++r) {
+                result.at(c, r) = minor_at(c, r);
+            }
+        }
+        return result;
+    }
+
+    /**
+     * Cofactor at column and row.
+     * @param column
+     * @param row
+     * @return Result.
+     */
+    [[nodiscard]] constexpr Real cofactor_at(const uint8_t column, const uint8_t row) const
+    {
+        NNM_BOUNDS_CHECK_ASSERT("Matrix3", column <= 2 && row <= 2);
+        return ((column + row) % 2 == 0 ? static_cast<Real>(1) : static_cast<Real>(-1)) * minor_at(column, row);
+    }
+
+    /**
+     * Cofactor matrix.
+     * @return Result.
+     */
+    [[nodiscard]] constexpr Matrix3 cofactor() const
+    {
+        Matrix3 result;
+        for (uint8_t c = 0; c < 3; ++c) {
+            for (uint8_t r = 0; r < 3; ++r) {
+                result.at(c, r) = cofactor_at(c, r);
+            }
+        }
+        return result;
+    }
+
+    /**
+     * Transpose matrix.
+     * @return Result.
+     */
+    [[nodiscard]] NNM_FORCE_INLINE constexpr Matrix3 transpose() const
+    {
+        const Vector3<Real>& c0 = columns[0];
+        const Vector3<Real>& c1 = columns[1];
+        const Vector3<Real>& c2 = columns[2];
+        return { { c0.x, c1.x, c2.x }, { c0.y, c1.y, c2.y }, { c0.z, c1.z, c2.z } };
+    }
+
+    /**
+     * Adjugate matrix.
+     * @return Result.
+     */
+    [[nodiscard]] constexpr Matrix3 adjugate() const
+    {
+        return cofactor().transpose();
+    }
+
+    /**
+     * Inverse without first checking if the matrix is singular.
+     * @return Result.
+     */
+    [[nodiscard]] constexpr Matrix3 unchecked_inverse() const
+    {
+        return adjugate() / determinant();
+    }
+
+    /**
+     * Inverse which returns null if there is no inverse.
+     * @return Inverse if there is one, null if not.
+     */
+    [[nodiscard]] constexpr std::optional<Matrix3> inverse() const
+    {
+        const Real det = determinant();
+        if (det == static_cast<Real>(0)) {
+            return std::nullopt;
+        }
+        return adjugate() / det;
+    }
+
+    struct SymmetricEigen;
+
+    /**
+     * Eigen-decomposition of a symmetric matrix using the cyclic Jacobi method with a fixed maximum number of sweeps.
+     * Only the lower triangle of the matrix is read.
+     * @return Eigenvalues sorted from largest to smallest along with the corresponding eigenvectors.
+     */
+    [[nodiscard]] SymmetricEigen symmetric_eigen() const;
+
+    struct SingularValueDecomposition;
+
+    /**
+     * Singular value decomposition using Jacobi rotations on the symmetric matrix transpose() * matrix followed by a
+     * QR factorization with Givens rotations. Both resulting bases are rotations so the last singular value is negative
+     * when the determinant is negative.
+     * @return Decomposition where the matrix is equal to u * diag(singular_values) * transpose(v).
+     */
+    [[nodiscard]] SingularValueDecomposition singular_value_decomposition() const;
+
+    struct PolarDecomposition;
+
+    /**
+     * Polar decomposition into a rotation followed by a symmetric stretch.
+     * @return Decomposition where the matrix is equal to rotation * stretch.
+     */
+    [[nodiscard]] PolarDecomposition polar_decomposition() const;
+
+    /**
+     * Element-wise approximately equal.
+     * @param other Other matrix.
+     * @return True if approximately equal, false otherwise.
+     */
+    [[nodiscard]] constexpr bool approx_equal(const Matrix3& other) const
+    {
+        for (uint8_t c = 0; c < 3; ++c) {
+            for (uint8_t r = 0; r < 3; ++r) {
+                if (!nnm::approx_equal(at(c, r), other.at(c, r))) {
+                    return false;
+                }
+            }
+        }
+        return true;
+    }
+
+    /**
+     * If all elements are approximately zero.
+     * @return True if approximately zero, false otherwise.
+     */
+    [[nodiscard]] constexpr bool approx_zero() const
+    {
+        for (uint8_t c = 0; c < 3; ++c) {
+            for (uint8_t r = 0; r < 3; ++r) {
+                if (!nnm::approx_zero(at(c, r))) {
+                    return false;
+                }
+            }
+        }
+        return true;
+    }
+
+    /**
+     * Constant reference to column at index.
+     * @param column Column.
+     * @return Constant reference.
+     */
+    [[nodiscard]] NNM_FORCE_INLINE constexpr const Vector3<Real>& at(const uint8_t column) const
+    {
+        NNM_BOUNDS_CHECK_ASSERT("Matrix3", column <= 2);
+        return columns[column];
+    }
+
+    /**
+     * Reference to column at index.
+     * @param column Column.
+     * @return Reference.
+     */
+    NNM_FORCE_INLINE constexpr Vector3<Real>& at(const uint8_t column)
+    {
+        NNM_BOUNDS_CHECK_ASSERT("Matrix3", column <= 2);
+        return columns[column];
+    }
+
+    /**
+     * Constant reference to element at column and row.
+     * @param column Column.
+     * @param row Row.
+     * @return Constant reference.
+     */
+    [[nodiscard]] NNM_FORCE_INLINE constexpr const Real& at(const uint8_t column, const uint8_t row) const
+    {
+        NNM_BOUNDS_CHECK_ASSERT("Matrix3", column <= 2 && row <= 2);
+        return columns[column][row];
+    }
+
+    /**
+     * Reference to element at column and row.
+     * @param column Column.
+     * @param row Row.
+     * @return Reference.
+     */
+    NNM_FORCE_INLINE constexpr Real& at(const uint8_t column, const uint8_t row)
+    {
+        NNM_BOUNDS_CHECK_ASSERT("Matrix3", column <= 2 && row <= 2);
+        return columns[column][row];
+    }
+
+    /**
+     * Start constant iterator.
+     * @return Constant iterator.
+     */
+    [[nodiscard]] const Real* begin() const
+    {
+        return columns[0].begin();
+    }
+
+    /**
+     * End constant iterator.
+     * @return Constant iterator.
+     */
+    [[nodiscard]] const Real* end() const
+    {
+        return columns[2].end();
+    }
+
+    /**
+     * Start iterator.
+     * @return Iterator.
+     */
+    Real* begin()
+    {
+        return columns[0].begin();
+    }
+
+    /**
+     * End iterator.
+     * @return Iterator.
+     */
+    Real* end()
+    {
+        return columns[2].end();
+    }
+
+    /**
+     * Constant reference to column at index.
+     * @param column Column.
+     * @return Constant reference.
+     */
+    NNM_FORCE_INLINE constexpr const Vector3<Real>& operator[](const uint8_t column) const
+    {
+        NNM_BOUNDS_CHECK_ASSERT("Matrix3", column <= 2);
+        return columns[column];
+    }
+
+    /**
+     * Reference to column at index.
+     * @param column Column.
+     * @return Reference.
+     */
+    NNM_FORCE_INLINE constexpr Vector3<Real>& operator[](const uint8_t column)
+    {
+        NNM_BOUNDS_CHECK_ASSERT("Matrix3", column <= 2);
+        return columns[column];
+    }
+
+    /**
+     * Element-wise equality.
+     * @param other Other matrix.
+     * @return True if equal, false otherwise.
+     */
+    [[nodiscard]] constexpr bool operator==(const Matrix3& other) const
+    {
+        for (uint8_t i = 0; i < 3; ++i) {
+            if (at(i) != other.at(i)) {
+                return false;
+            }
+        }
+        return true;
+    }
+
+    /**
+     * Element-wise inequality.
+     * @param other Other matrix.
+     * @return True if not equal, false otherwise.
+     */
+    constexpr bool operator!=(const Matrix3& other) const
+    {
+        for (uint8_t i = 0; i < 3; ++i) {
+            if (at(i) != other.at(i)) {
+                return true;
+            }
+        }
+        return false;
+    }
+
+    /**
+     * Element-wise addition.
+     * @param other Other matrix.
+     * @return Result.
+     */
+    [[nodiscard]] NNM_FORCE_INLINE constexpr Matrix3 operator+(const Matrix3& other) const
+    {
+        Matrix3 result;
+        for (uint8_t c = 0; c < 3; ++c) {
+            result.at(c) = at(c) + other.at(c);
+        }
+        return result;
+    }
+
+    /**
+     * Element-wise addition.
+     * @param other Other matrix.
+     * @return Reference to this modified matrix.
+     */
+    constexpr Matrix3& operator+=(const Matrix3& other)
+    {
+        for (uint8_t c = 0; c < 3; ++c) {
+            at(c) += other.at(c);
+        }
+        return *this;
+    }
+
+    /**
+     * Element-wise subtraction.
+     * @param other Other matrix.
+     * @return Result.
+     */
+    [[nodiscard]] NNM_FORCE_INLINE constexpr Matrix3 operator-(const Matrix3& other) const
+    {
+        Matrix3 result;
+        for (uint8_t c = 0; c < 3; ++c) {
+            result.at(c) = at(c) - other.at(c);
+        }
+        return result;
+    }
+
+    /**
+     * Element-wise subtraction.
+     * @param other Other matrix.
+     * @return Reference to this modified matrix.
+     */
+    constexpr Matrix3& operator-=(const Matrix3& other)
+    {
+        for (uint8_t c = 0; c < 3; ++c) {
+            at(c) -= other.at(c);
+        }
+        return *this;
+    }
+
+    /**
+     * Matrix multiplication.
+     * @param other Other matrix.
+     * @return Result.
+     */
+    [[nodiscard]] NNM_FORCE_INLINE constexpr Matrix3 operator*(const Matrix3& other) const
+    {
+        // Unrolled without at() so that unoptimized builds do not loop and bounds check each element.
+        return { *this * other.columns[0], *this * other.columns[1], *this * other.columns[2] };
+    }
+
+    /**
+     * Matrix multiplication.
+     * @param other Other matrix.
+     * @return Reference to this modified matrix.
+     */
+    constexpr Matrix3& operator*=(const Matrix3& other)
+    {
+        *this = *this * other;
+        return *this;
+    }
+
+    /**
+     * Matrix-vector multiplication.
+     * @param vector Vector.
+     * @return Resulting three-dimensional vector.
+     */
+    [[nodiscard]] NNM_FORCE_INLINE constexpr Vector3<Real> operator*(const Vector3<Real>& vector) const
+    {
+        const Vector3<Real>& c0 = columns[0];
+        const Vector3<Real>& c1 = columns[1];
+        const Vector3<Real>& c2 = columns[2];
+        return { c0.x * vector.x + c1.x * vector.y + c2.x * vector.z,
+                 c0.y * vector.x + c1.y * vector.y + c2.y * vector.z,
+                 c0.z * vector.x + c1.z * vector.y + c2.z * vector.z };
+    }
+
+    /**
+     * Element-wise multiplication with value.
+     * @param value Value.
+     * @return Result.
+     */
+    [[nodiscard]] NNM_FORCE_INLINE constexpr Matrix3 operator*(const Real value) const
+    {
+        return { at(0) * value, at(1) * value, at(2) * value };
+    }
+
+    /**
+     * Element-wise multiplication with value.
+     * @param value Value.
+     * @return Reference to this modified matrix.
+     */
+    constexpr Matrix3& operator*=(const Real value)
+    {
+        at(0) *= value;
+        at(1) *= value;
+        at(2) *= value;
+        return *this;
+    }
+
+    /**
+     * Element-wise division by value.
+     * @param value Value.
+     * @return Result.
+     */
+    [[nodiscard]] NNM_FORCE_INLINE constexpr Matrix3 operator/(const Real value) const
+    {
+        return { at(0) / value, at(1) / value, at(2) / value };
+    }
+
+    /**
+     * Element-wise division by value.
+     * @param value Value.
+     * @return Reference this modified matrix.
+     */
+    constexpr Matrix3& operator/=(const Real value)
+    {
+        at(0) /= value;
+        at(1) /= value;
+        at(2) /= value;
+        return *this;
+    }
+
+    /**
+     * Lexicographical comparison between elements.
+     * @param other Other matrix.
+     * @return True if less than, false otherwise.
+     */
+    [[nodiscard]] constexpr bool operator<(const Matrix3& other) const
+    {
+        for (uint8_t i = 0; i < 3; ++i) {
+            if (at(i) < other.at(i)) {
+                return true;
+            }
+            if (at(i) != other.at(i)) {
+                return false;
+            }
+        }
+        return false;
+    }
+
+    /**
+     * Evaluates to false if all components are zero, true otherwise.
+     */
+    constexpr explicit operator bool() const
+    {
+        for (uint8_t c = 0; c < 3; ++c) { // NOLINT(*-loop-convert)
+            if (!static_cast<bool>(at(c))) {
+                return false;
+            }
+        }
+        return true;
+    }
+
+    /**
+     * Result of a symmetric eigen-decomposition.
+     */
+    struct SymmetricEigen {
+        /**
+         * Eigenvalues sorted from largest to smallest.
+         */
+        Vector3<Real> values;
+
+        /**
+         * Orthonormal, right-handed basis where each column is the eigenvector of the corresponding eigenvalue.
+         */
+        Basis3<Real> vectors;
+    };
+
+    /**
+     * Result of a singular value decomposition.
+     */
+    struct SingularValueDecomposition {
+        /**
+         * Rotation whose columns are the left singular vectors.
+         */
+        Basis3<Real> u;
+
+        /**
+         * Singular values sorted from largest to smallest magnitude. Only the last may be negative.
+         */
+        Vector3<Real> singular_values;
+
+        /**
+         * Rotation whose columns are the right singular vectors.
+         */
+        Basis3<Real> v;
+    };
+
+    /**
+     * Result of a polar decomposition.
+     */
+    struct PolarDecomposition {
+        /**
+         * Closest rotation to the matrix.
+         */
+        Basis3<Real> rotation;
+
+        /**
+         * Symmetric stretch applied before the rotation.
+         */
+        Matrix3<Real> stretch;
+    };
+};
+
+/**
+ * Element-wise multiplication with value.
+ * @tparam Real Floating-point type.
+ * @param value Value.
+ * @param matrix Matrix.
+ * @return Result.
+ */
+template <typename Real>
+constexpr Matrix3<Real> operator*(const Real value, const Matrix3<Real>& matrix)
+{
+    Matrix3<Real> result;
+    for (uint8_t c = 0; c < 3; ++c) {
+        for (uint8_t r = 0; r < 3; ++r) {
+            result.at(c, r) = value * matrix.at(c, r);
+        }
+    }
+    return result;
+}
+
+/**
+ * Element-wise division with value.
+ * @tparam Real Floating-point type.
+ * @param value Value.
+ * @param matrix Matrix.
+ * @return Result.
+ */
+template <typename Real>
+constexpr Matrix3<Real> operator/(const Real value, const Matrix3<Real>& matrix)
+{
+    Matrix3<Real> result;
+    for (uint8_t c = 0; c < 3; ++c) {
+        for (uint8_t r = 0; r < 3; ++r) {
+            result.at(c, r) = value / matrix.at(c, r);
+        }
+    }
+    return result;
+}
+
+template <typename Real>
+typename Matrix3<Real>::SymmetricEigen Matrix3<Real>::symmetric_eigen() const
+{
+    constexpr uint8_t max_sweeps = 8;
+    Matrix3 a = *this;
+    a.at(1, 0) = a.at(0, 1);
+    a.at(2, 0) = a.at(0, 2);
+    a.at(2, 1) = a.at(1, 2);
+    Matrix3 v = identity();
+    for (uint8_t sweep = 0; sweep < max_sweeps; ++sweep) {
+        if (a.at(0, 1) == static_cast<Real>(0) && a.at(0, 2) == static_cast<Real>(0)
+            && a.at(1, 2) == static_cast<Real>(0)) {
+            break;
+        }
+        for (uint8_t p = 0; p < 2; ++p) {
+            for (uint8_t q = p + 1; q < 3; ++q) {
+                const Real a_pq = a.at(p, q);
+                if (a_pq == static_cast<Real>(0)) {
+                    continue;
+                }
+                // Rotation that zeroes a_pq, see Numerical Recipes 11.1
+                const auto r = static_cast<uint8_t>(3 - p - q);
+                const Real theta = (a.at(q, q) - a.at(p, p)) / (static_cast<Real>(2) * a_pq);
+                const Real t = sign(theta) / (nnm::abs(theta) + sqrt(sqrd(theta) + static_cast<Real>(1)));
+                const Real c = static_cast<Real>(1) / sqrt(sqrd(t) + static_cast<Real>(1));
+                const Real s = t * c;
+                const Real a_rp = a.at(p, r);
+                const Real a_rq = a.at(q, r);
+                a.at(p, p) -= t * a_pq;
+                a.at(q, q) += t * a_pq;
+                a.at(p, q) = static_cast<Real>(0);
+                a.at(q, p) = static_cast<Real>(0);
+                a.at(p, r) = c * a_rp - s * a_rq;
+                a.at(q, r) = s * a_rp + c * a_rq;
+                a.at(r, p) = a.at(p, r);
+                a.at(r, q) = a.at(q, r);
+                const Vector3<Real> v_p = v.at(p);
+                const Vector3<Real> v_q = v.at(q);
+                v.at(p) = v_p * c - v_q * s;
+                v.at(q) = v_p * s + v_q * c;
+            }
+        }
+    }
+    Vector3<Real> values { a.at(0, 0), a.at(1, 1), a.at(2, 2) };
+    for (uint8_t i = 0; i < 2; ++i) {
+        for (uint8_t j = 0; j < 2 - i; ++j) {
+            if (values.at(j) < values.at(j + 1)) {
+                const Real value = values.at(j);
+                values.at(j) = values.at(j + 1);
+                values.at(j + 1) = value;
+                const Vector3<Real> vector = v.at(j);
+                v.at(j) = v.at(j + 1);
+                v.at(j + 1) = vector;
+            }
+        }
+    }
+    if (v.determinant() < static_cast<Real>(0)) {
+        v.at(2) = -v.at(2);
+    }
+    return { values, Basis3<Real>(v) };
+}
+
+template <typename Real>
+typename Matrix3<Real>::SingularValueDecomposition Matrix3<Real>::singular_value_decomposition() const
+{
+    // See McAdams et al. "Computing the Singular Value Decomposition of 3x3 matrices with minimal branching and
+    // elementary floating point operations"
+    const Matrix3 v = (transpose() * *this).symmetric_eigen().vectors.matrix;
+    Matrix3 b = *this * v;
+    Matrix3 u = identity();
+    for (uint8_t c = 0; c < 2; ++c) {
+        for (uint8_t r = c + 1; r < 3; ++r) {
+            // Givens rotation of rows c and r that zeroes the element at row r
+            const Real length = sqrt(sqrd(b.at(c, c)) + sqrd(b.at(c, r)));
+            if (length == static_cast<Real>(0)) {
+                continue;
+            }
+            const Real cosine = b.at(c, c) / length;
+            const Real sine = b.at(c, r) / length;
+            for (uint8_t i = 0; i < 3; ++i) {
+                const Real b_c = b.at(i, c);
+                const Real b_r = b.at(i, r);
+                b.at(i, c) = cosine * b_c + sine * b_r;
+                b.at(i, r) = cosine * b_r - sine * b_c;
+            }
+            const Vector3<Real> u_c = u.at(c);
+            const Vector3<Real> u_r = u.at(r);
+            u.at(c) = u_c * cosine + u_r * sine;
+            u.at(r) = u_r * cosine - u_c * sine;
+        }
+    }
+    return { Basis3<Real>(u), { b.at(0, 0), b.at(1, 1), b.at(2, 2) }, Basis3<Real>(v) };
+}
+
+template <typename Real>
+typename Matrix3<Real>::PolarDecomposition Matrix3<Real>::polar_decomposition() const
+{
+    const SingularValueDecomposition svd = singular_value_decomposition();
+    const Matrix3& u = svd.u.matrix;
+    const Matrix3& v = svd.v.matrix;
+    const Matrix3 v_scaled { v.at(0) * svd.singular_values.x,
+                             v.at(1) * svd.singular_values.y,
+                             v.at(2) * svd.singular_values.z };
+    return { Basis3<Real>(u * v.transpose()), v_scaled * v.transpose() };
+}
+
+}
+
+// Classes used by the definitions above other than in their parameters. They are included after Matrix3 is complete
+// since some of them include this header.
+#include <nnm/basis3.hpp>
+
+#endif
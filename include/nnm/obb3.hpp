@@ -0,0 +1,296 @@
+/* NNM - "No Nonsense Math"
+ * v0.5.0
+ * Copyright (c) 2025-present Matthew Oros
+ * Licensed under MIT
+ */
+
+#ifndef NNM_OBB3_HPP
+#define NNM_OBB3_HPP
+
+#include <nnm/basis3.hpp>
+#include <nnm/vector3.hpp>
+
+#include <cstddef>
+#include <cstdint>
+#include <optional>
+
+namespace nnm {
+
+/**
+ * Three-dimensional oriented bounding box.
+ * @tparam Real Floating-point type.
+ */
+template <typename Real>
+class OBB3 {
+public:
+    /**
+     * Center position.
+     */
+    Vector3<Real> center;
+
+    /**
+     * Rotation whose columns are the normalized local axes of the box.
+     */
+    Basis3<Real> rotation;
+
+    /**
+     * Half of the size of the box along each local axis.
+     */
+    Vector3<Real> half_extents;
+
+    /**
+     * Initialize with zero size at the origin.
+     */
+    constexpr OBB3()
+        : center(Vector3<Real>::zero())
+        , rotation()
+        , half_extents(Vector3<Real>::zero())
+    {
+    }
+
+    /**
+     * Cast from other oriented bounding box.
+     * @tparam Other Other type.
+     * @param box Other box.
+     */
+    template <typename Other>
+    explicit constexpr OBB3(const OBB3<Other>& box)
+        : center(Vector3<Real>(box.center))
+        , rotation(Basis3<Real>(box.rotation))
+        , half_extents(Vector3<Real>(box.half_extents))
+    {
+    }
+
+    /**
+     * Initialize with components. No validation is done.
+     * @param center Center position.
+     * @param rotation Rotation with orthonormal columns.
+     * @param half_extents Half of the size along each local axis.
+     */
+    constexpr OBB3(const Vector3<Real>& center, const Basis3<Real>& rotation, const Vector3<Real>& half_extents)
+        : center(center)
+        , rotation(rotation)
+        , half_extents(half_extents)
+    {
+    }
+
+    /**
+     * Box that bounds an axis-aligned box after it is transformed. The transform is expected to be affine and without
+     * shear.
+     * @param transform Transform of the axis-aligned box.
+     * @param min Minimum corner of the axis-aligned box in local space.
+     * @param max Maximum corner of the axis-aligned box in local space.
+     * @return Result.
+     */
+    static OBB3 from_transform_aabb(
+        const Transform3<Real>& transform, const Vector3<Real>& min, const Vector3<Real>& max)
+    {
+        const Basis3<Real> basis = transform.basis();
+        const Vector3<Real> local_half_extents = (max - min) / static_cast<Real>(2);
+        OBB3 result;
+        result.center = ((min + max) / static_cast<Real>(2)).transform(transform);
+        for (uint8_t i = 0; i < 3; ++i) {
+            const Real length = basis.at(i).length();
+            result.rotation.at(i) = length > static_cast<Real>(0) ? basis.at(i) / length : Vector3<Real>::zero();
+            result.half_extents.at(i) = local_half_extents.at(i) * length;
+        }
+        return result;
+    }
+
+    /**
+     * Box that bounds a set of points with axes along the principal components of the points.
+     * @param points Points.
+     * @param count Number of points.
+     * @return Result.
+     */
+    static OBB3 fit_points(const Vector3<Real>* points, const size_t count)
+    {
+        if (count == 0) {
+            return OBB3();
+        }
+        const Vector3<Real> mean = centroid(points, count);
+        const Basis3<Real> axes = covariance(points, count).symmetric_eigen().vectors;
+        Vector3<Real> min = (points[0] - mean) * axes.matrix;
+        Vector3<Real> max = min;
+        for (size_t i = 1; i < count; ++i) {
+            const Vector3<Real> local = (points[i] - mean) * axes.matrix;
+            for (uint8_t j = 0; j < 3; ++j) {
+                min.at(j) = nnm::min(min.at(j), local.at(j));
+                max.at(j) = nnm::max(max.at(j), local.at(j));
+            }
+        }
+        const Vector3<Real> local_center = (min + max) / static_cast<Real>(2);
+        return { mean + local_center.transform(axes), axes, (max - min) / static_cast<Real>(2) };
+    }
+
+    /**
+     * Position relative to the center expressed along the local axes of the box.
+     * @param point Position.
+     * @return Result.
+     */
+    [[nodiscard]] constexpr Vector3<Real> local_point(const Vector3<Real>& point) const
+    {
+        return (point - center) * rotation.matrix;
+    }
+
+    /**
+     * Determines if a point is inside or on the surface of the box.
+     * @param point Position.
+     * @return True if contained, false otherwise.
+     */
+    [[nodiscard]] constexpr bool contains(const Vector3<Real>& point) const
+    {
+        const Vector3<Real> local = local_point(point);
+        return nnm::abs(local.x) <= half_extents.x && nnm::abs(local.y) <= half_extents.y
+            && nnm::abs(local.z) <= half_extents.z;
+    }
+
+    /**
+     * Determines if this box overlaps another box using the separating axis theorem.
+     * See Ericson "Real-Time Collision Detection" 4.4.1.
+     * @param other Other box.
+     * @return True if overlapping, false otherwise.
+     */
+    [[nodiscard]] constexpr bool intersects(const OBB3& other) const
+    {
+        const Vector3<Real>& a = half_extents;
+        const Vector3<Real>& b = other.half_extents;
+        // r.at(i, j) is the dot product of axis i of this box and axis j of the other box
+        Matrix3<Real> r;
+        Matrix3<Real> r_abs;
+        for (uint8_t i = 0; i < 3; ++i) {
+            for (uint8_t j = 0; j < 3; ++j) {
+                r.at(i, j) = rotation.at(i).dot(other.rotation.at(j));
+                // Epsilon prevents false separation when two axes are near parallel and their cross product is zero
+                r_abs.at(i, j) = nnm::abs(r.at(i, j)) + epsilon<Real>();
+            }
+        }
+        const Vector3<Real> t = local_point(other.center);
+        for (uint8_t i = 0; i < 3; ++i) {
+            const Real radius_b = b.x * r_abs.at(i, 0) + b.y * r_abs.at(i, 1) + b.z * r_abs.at(i, 2);
+            if (nnm::abs(t.at(i)) > a.at(i) + radius_b) {
+                return false;
+            }
+        }
+        for (uint8_t j = 0; j < 3; ++j) {
+            const Real radius_a = a.x * r_abs.at(0, j) + a.y * r_abs.at(1, j) + a.z * r_abs.at(2, j);
+            const Real distance = t.x * r.at(0, j) + t.y * r.at(1, j) + t.z * r.at(2, j);
+            if (nnm::abs(distance) > radius_a + b.at(j)) {
+                return false;
+            }
+        }
+        // Cross products of axis i of this box and axis j of the other box
+        for (uint8_t i = 0; i < 3; ++i) {
+            const uint8_t i1 = (i + 1) % 3;
+            const uint8_t i2 = (i + 2) % 3;
+            for (uint8_t j = 0; j < 3; ++j) {
+                const uint8_t j1 = (j + 1) % 3;
+                const uint8_t j2 = (j + 2) % 3;
+                const Real radius_a = a.at(i1) * r_abs.at(i2, j) + a.at(i2) * r_abs.at(i1, j);
+                const Real radius_b = b.at(j1) * r_abs.at(i, j2) + b.at(j2) * r_abs.at(i, j1);
+                const Real distance = t.at(i2) * r.at(i1, j) - t.at(i1) * r.at(i2, j);
+                if (nnm::abs(distance) > radius_a + radius_b) {
+                    return false;
+                }
+            }
+        }
+        return true;
+    }
+
+    /**
+     * Distance along a ray to where it enters the box.
+     * @param origin Origin of the ray.
+     * @param direction Direction of the ray which does not need to be normalized.
+     * @return Distance in multiples of the direction, zero if the origin is inside, or null if there is no
+     * intersection.
+     */
+    [[nodiscard]] constexpr std::optional<Real> intersect_ray(
+        const Vector3<Real>& origin, const Vector3<Real>& direction) const
+    {
+        const Vector3<Real> local_origin = local_point(origin);
+        const Vector3<Real> local_direction = direction * rotation.matrix;
+        Real enter = static_cast<Real>(0);
+        Real leave = static_cast<Real>(0);
+        bool bounded = false;
+        for (uint8_t i = 0; i < 3; ++i) {
+            if (local_direction.at(i) == static_cast<Real>(0)) {
+                if (nnm::abs(local_origin.at(i)) > half_extents.at(i)) {
+                    return std::nullopt;
+                }
+                continue;
+            }
+            const Real inverse_direction = static_cast<Real>(1) / local_direction.at(i);
+            const Real t1 = (-half_extents.at(i) - local_origin.at(i)) * inverse_direction;
+            const Real t2 = (half_extents.at(i) - local_origin.at(i)) * inverse_direction;
+            enter = nnm::max(enter, nnm::min(t1, t2));
+            leave = bounded ? nnm::min(leave, nnm::max(t1, t2)) : nnm::max(t1, t2);
+            bounded = true;
+            if (enter > leave) {
+                return std::nullopt;
+            }
+        }
+        return enter;
+    }
+
+    /**
+     * Determines if the box is at least partially inside the view frustum of a view-projection transform. The test is
+     * conservative so boxes near the corners of the frustum may be reported as inside.
+     * @param view_projection View-projection transform with -1 to 1 depth normalization. For 0 to 1 normalization the
+     * near plane test is conservative.
+     * @return True if possibly inside, false if definitely outside.
+     */
+    [[nodiscard]] constexpr bool intersects_frustum(const Transform3<Real>& view_projection) const
+    {
+        const Matrix4<Real>& m = view_projection.matrix;
+        const Vector4<Real> row3 { m.at(0, 3), m.at(1, 3), m.at(2, 3), m.at(3, 3) };
+        // Gribb-Hartmann plane extraction where each plane is the last row plus or minus one of the other rows
+        for (uint8_t i = 0; i < 6; ++i) {
+            const uint8_t r = i / 2;
+            const Vector4<Real> row { m.at(0, r), m.at(1, r), m.at(2, r), m.at(3, r) };
+            const Vector4<Real> plane = i % 2 == 0 ? row3 + row : row3 - row;
+            const Vector3<Real> normal = plane.xyz();
+            const Real radius = half_extents.x * nnm::abs(normal.dot(rotation.at(0)))
+                + half_extents.y * nnm::abs(normal.dot(rotation.at(1)))
+                + half_extents.z * nnm::abs(normal.dot(rotation.at(2)));
+            if (normal.dot(center) + plane.w + radius < static_cast<Real>(0)) {
+                return false;
+            }
+        }
+        return true;
+    }
+
+    /**
+     * Determines if approximately equal to another box.
+     * @param other Other box.
+     * @return True if all components are approximately equal, false otherwise.
+     */
+    [[nodiscard]] constexpr bool approx_equal(const OBB3& other) const
+    {
+        return center.approx_equal(other.center) && rotation.approx_equal(other.rotation)
+            && half_extents.approx_equal(other.half_extents);
+    }
+
+    /**
+     * Component-wise equality.
+     * @param other Other box.
+     * @return True if all components are equal, false otherwise.
+     */
+    [[nodiscard]] constexpr bool operator==(const OBB3& other) const
+    {
+        return center == other.center && rotation == other.rotation && half_extents == other.half_extents;
+    }
+
+    /**
+     * Component-wise inequality.
+     * @param other Other box.
+     * @return True if any component is not equal, false otherwise.
+     */
+    [[nodiscard]] constexpr bool operator!=(const OBB3& other) const
+    {
+        return center != other.center || rotation != other.rotation || half_extents != other.half_extents;
+    }
+};
+
+}
+
+#endif
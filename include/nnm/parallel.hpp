@@ -0,0 +1,553 @@
+/* NNM - "No Nonsense Math"
+ * v0.5.0
+ * Copyright (c) 2025-present Matthew Oros
+ * Licensed under MIT
+ */
+
+#ifndef NNM_PARALLEL_HPP
+#define NNM_PARALLEL_HPP
+
+#include <nnm/nnm.hpp>
+
+#include <atomic>
+#include <condition_variable>
+#include <cstddef>
+#include <mutex>
+#include <thread>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+namespace nnm::parallel {
+
+/**
+ * Number of threads used by default which is the number of hardware threads.
+ * @return Result which is at least one.
+ */
+inline size_t default_thread_count()
+{
+    const unsigned int count = std::thread::hardware_concurrency();
+    return count == 0 ? 1 : count;
+}
+
+/**
+ * Chunk size for a number of items. It only depends on the number of items and not on the number of threads so that
+ * reductions combine partial results in the same order on every machine.
+ * @param count Number of items.
+ * @return Result which is at least one.
+ */
+inline size_t chunk_size(const size_t count)
+{
+    constexpr size_t min_chunk_size = 1024;
+    constexpr size_t target_chunk_count = 256;
+    return max(min_chunk_size, (count + target_chunk_count - 1) / target_chunk_count);
+}
+
+/**
+ * Fixed-size pool of threads that splits index ranges into chunks. Each thread starts with a contiguous share of the
+ * chunks and steals from the end of the other shares when it runs out. The calling thread also takes a share.
+ */
+class ThreadPool {
+public:
+    /**
+     * Initialize with a number of threads including the calling thread.
+     * @param thread_count Number of threads where one means all work runs on the calling thread.
+     */
+    explicit ThreadPool(const size_t thread_count = default_thread_count())
+        : m_queues(thread_count == 0 ? 1 : thread_count)
+    {
+        m_threads.reserve(m_queues.size() - 1);
+        for (size_t i = 1; i < m_queues.size(); ++i) {
+            m_threads.emplace_back([this, i] { worker(i); });
+        }
+    }
+
+    ThreadPool(const ThreadPool&) = delete;
+
+    ThreadPool& operator=(const ThreadPool&) = delete;
+
+    ~ThreadPool()
+    {
+        {
+            std::lock_guard lock(m_mutex);
+            m_stop = true;
+        }
+        m_condition.notify_all();
+        for (std::thread& thread : m_threads) {
+            thread.join();
+        }
+    }
+
+    /**
+     * Number of threads including the calling thread.
+     * @return Result.
+     */
+    [[nodiscard]] size_t thread_count() const
+    {
+        return m_queues.size();
+    }
+
+    /**
+     * Call a function on each chunk of an index range and wait for all of them to finish. Calls from inside another
+     * parallel_for run on the calling thread.
+     * @tparam Function Callable with the parameters (size_t chunk_begin, size_t chunk_end) which must not throw.
+     * @param begin First index.
+     * @param end One past the last index.
+     * @param chunk_size Number of indices in each chunk except possibly the last.
+     * @param function Function.
+     */
+    template <typename Function>
+    void parallel_for(const size_t begin, const size_t end, const size_t chunk_size, Function&& function)
+    {
+        if (begin >= end) {
+            return;
+        }
+        const size_t size = max(chunk_size, static_cast<size_t>(1));
+        const size_t chunk_count = (end - begin + size - 1) / size;
+        if (chunk_count == 1 || m_queues.size() == 1 || t_inside_job) {
+            for (size_t chunk = 0; chunk < chunk_count; ++chunk) {
+                const size_t chunk_begin = begin + chunk * size;
+                function(chunk_begin, min(chunk_begin + size, end));
+            }
+            return;
+        }
+        std::lock_guard job_lock(m_job_mutex);
+        using FunctionType = std::remove_reference_t<Function>;
+        Job job { begin,
+                  end,
+                  size,
+                  chunk_count,
+                  [](void* context, const size_t chunk_begin, const size_t chunk_end) {
+                      (*static_cast<FunctionType*>(context))(chunk_begin, chunk_end);
+                  },
+                  static_cast<void*>(&function) };
+        for (size_t i = 0; i < m_queues.size(); ++i) {
+            std::lock_guard lock(m_queues[i].mutex);
+            m_queues[i].job = &job;
+            m_queues[i].front = chunk_count * i / m_queues.size();
+            m_queues[i].back = chunk_count * (i + 1) / m_queues.size();
+        }
+        {
+            std::lock_guard lock(m_mutex);
+            ++m_generation;
+        }
+        m_condition.notify_all();
+        run(0);
+        while (job.remaining.load(std::memory_order_acquire) != 0) {
+            std::this_thread::yield();
+        }
+    }
+
+    /**
+     * Reduce an index range by reducing each chunk and then combining the partial results in chunk order. The result
+     * does not depend on the number of threads.
+     * @tparam Result Result type.
+     * @tparam Reduce Callable with the parameters (size_t chunk_begin, size_t chunk_end) returning Result.
+     * @tparam Combine Callable with the parameters (const Result&, const Result&) returning Result.
+     * @param begin First index.
+     * @param end One past the last index.
+     * @param chunk_size Number of indices in each chunk except possibly the last.
+     * @param identity Result of an empty range.
+     * @param reduce Function which reduces a chunk.
+     * @param combine Function which combines two results.
+     * @return Result.
+     */
+    template <typename Result, typename Reduce, typename Combine>
+    Result parallel_reduce(
+        const size_t begin,
+        const size_t end,
+        const size_t chunk_size,
+        const Result& identity,
+        Reduce&& reduce,
+        Combine&& combine)
+    {
+        if (begin >= end) {
+            return identity;
+        }
+        const size_t size = max(chunk_size, static_cast<size_t>(1));
+        std::vector<Result> partials((end - begin + size - 1) / size, identity);
+        parallel_for(begin, end, size, [&](const size_t chunk_begin, const size_t chunk_end) {
+            partials[(chunk_begin - begin) / size] = reduce(chunk_begin, chunk_end);
+        });
+        Result result = identity;
+        for (const Result& partial : partials) {
+            result = combine(result, partial);
+        }
+        return result;
+    }
+
+private:
+    struct Job {
+        size_t begin;
+        size_t end;
+        size_t chunk_size;
+        std::atomic<size_t> remaining;
+        void (*invoke)(void* context, size_t chunk_begin, size_t chunk_end);
+        void* context;
+    };
+
+    struct Queue {
+        std::mutex mutex;
+        Job* job = nullptr;
+        size_t front = 0;
+        size_t back = 0;
+    };
+
+    inline static thread_local bool t_inside_job = false;
+
+    std::vector<Queue> m_queues;
+    std::vector<std::thread> m_threads;
+    std::mutex m_job_mutex;
+    std::mutex m_mutex;
+    std::condition_variable m_condition;
+    size_t m_generation = 0;
+    bool m_stop = false;
+
+    bool pop(const size_t index, Job*& job, size_t& chunk)
+    {
+        Queue& own = m_queues[index];
+        {
+            std::lock_guard lock(own.mutex);
+            if (own.front < own.back) {
+                job = own.job;
+                chunk = own.front++;
+                return true;
+            }
+        }
+        for (size_t offset = 1; offset < m_queues.size(); ++offset) {
+            Queue& other = m_queues[(index + offset) % m_queues.size()];
+            std::lock_guard lock(other.mutex);
+            if (other.front < other.back) {
+                job = other.job;
+                chunk = --other.back;
+                return true;
+            }
+        }
+        return false;
+    }
+
+    void run(const size_t index)
+    {
+        t_inside_job = true;
+        Job* job = nullptr;
+        size_t chunk = 0;
+        while (pop(index, job, chunk)) {
+            const size_t chunk_begin = job->begin + chunk * job->chunk_size;
+            job->invoke(job->context, chunk_begin, min(chunk_begin + job->chunk_size, job->end));
+            job->remaining.fetch_sub(1, std::memory_order_release);
+        }
+        t_inside_job = false;
+    }
+
+    void worker(const size_t index)
+    {
+        size_t generation = 0;
+        while (true) {
+            {
+                std::unique_lock lock(m_mutex);
+                m_condition.wait(lock, [&] { return m_stop || m_generation != generation; });
+                if (m_stop) {
+                    return;
+                }
+                generation = m_generation;
+            }
+            run(index);
+        }
+    }
+};
+
+/**
+ * Pool shared by the batch functions in this namespace which is created on first use with the default number of
+ * threads.
+ * @return Result.
+ */
+inline ThreadPool& default_pool()
+{
+    static ThreadPool pool;
+    return pool;
+}
+
+/**
+ * Call a function on each chunk of an index range using the default pool.
+ * @tparam Function Callable with the parameters (size_t chunk_begin, size_t chunk_end) which must not throw.
+ * @param begin First index.
+ * @param end One past the last index.
+ * @param function Function.
+ */
+template <typename Function>
+void parallel_for(const size_t begin, const size_t end, Function&& function)
+{
+    default_pool().parallel_for(begin, end, chunk_size(end - begin), std::forward<Function>(function));
+}
+
+/**
+ * Transform many points in parallel.
+ * @tparam Real Floating-point type.
+ * @param pool Pool.
+ * @param by Transform.
+ * @param points Points.
+ * @param count Number of points.
+ * @param results Output of each transformed point which must hold count elements.
+ */
+template <typename Real>
+void transform_point_batch(
+    ThreadPool& pool,
+    const Transform3<Real>& by,
+    const Vector3<Real>* points,
+    const size_t count,
+    Vector3<Real>* results)
+{
+    pool.parallel_for(0, count, chunk_size(count), [&](const size_t begin, const size_t end) {
+        nnm::transform_point_batch(by, points + begin, end - begin, results + begin);
+    });
+}
+
+/**
+ * Transform many points in strided views in parallel.
+ * @tparam Real Floating-point type.
+ * @param pool Pool.
+ * @param by Transform.
+ * @param points Points.
+ * @param results Output of each transformed point which must hold as many elements as points.
+ */
+template <typename Real>
+void transform_point_batch(
+    ThreadPool& pool,
+    const Transform3<Real>& by,
+    const StridedSpan<const Vector3<Real>> points,
+    const StridedSpan<Vector3<Real>> results)
+{
+    pool.parallel_for(0, points.count, chunk_size(points.count), [&](const size_t begin, const size_t end) {
+        nnm::transform_point_batch(by, points.subspan(begin, end - begin), results.subspan(begin, end - begin));
+    });
+}
+
+/**
+ * Transform many padded points in parallel.
+ * @tparam Real Floating-point type.
+ * @param pool Pool.
+ * @param by Transform.
+ * @param points Points.
+ * @param count Number of points.
+ * @param results Output of each transformed point which must hold count elements.
+ */
+template <typename Real>
+void transform_point_batch(
+    ThreadPool& pool,
+    const Transform3<Real>& by,
+    const Vector3A<Real>* points,
+    const size_t count,
+    Vector3A<Real>* results)
+{
+    pool.parallel_for(0, count, chunk_size(count), [&](const size_t begin, const size_t end) {
+        nnm::transform_point_batch(by, points + begin, end - begin, results + begin);
+    });
+}
+
+/**
+ * Compose many pairs of transforms in parallel.
+ * @tparam Real Floating-point type.
+ * @param pool Pool.
+ * @param transforms Transforms.
+ * @param by Transforms to apply after each of the transforms.
+ * @param count Number of transforms.
+ * @param results Output of each composed transform which must hold count elements.
+ */
+template <typename Real>
+void transform_batch(
+    ThreadPool& pool,
+    const Transform3<Real>* transforms,
+    const Transform3<Real>* by,
+    const size_t count,
+    Transform3<Real>* results)
+{
+    pool.parallel_for(0, count, chunk_size(count), [&](const size_t begin, const size_t end) {
+        nnm::transform_batch(transforms + begin, by + begin, end - begin, results + begin);
+    });
+}
+
+/**
+ * Normalize many vectors in parallel.
+ * @tparam Real Floating-point type.
+ * @param pool Pool.
+ * @param vectors Vectors.
+ * @param count Number of vectors.
+ * @param results Output of each normalized vector which must hold count elements.
+ */
+template <typename Real>
+void normalize_batch(ThreadPool& pool, const Vector3<Real>* vectors, const size_t count, Vector3<Real>* results)
+{
+    pool.parallel_for(0, count, chunk_size(count), [&](const size_t begin, const size_t end) {
+        nnm::normalize_batch(vectors + begin, end - begin, results + begin);
+    });
+}
+
+/**
+ * Normalize many vectors in strided views in parallel.
+ * @tparam Real Floating-point type.
+ * @param pool Pool.
+ * @param vectors Vectors.
+ * @param results Output of each normalized vector which must hold as many elements as vectors.
+ */
+template <typename Real>
+void normalize_batch(
+    ThreadPool& pool, const StridedSpan<const Vector3<Real>> vectors, const StridedSpan<Vector3<Real>> results)
+{
+    pool.parallel_for(0, vectors.count, chunk_size(vectors.count), [&](const size_t begin, const size_t end) {
+        nnm::normalize_batch(vectors.subspan(begin, end - begin), results.subspan(begin, end - begin));
+    });
+}
+
+/**
+ * Signed distances of many points to a plane in parallel.
+ * @tparam Real Floating-point type.
+ * @param pool Pool.
+ * @param plane Plane with a normalized normal.
+ * @param points Points.
+ * @param count Number of points.
+ * @param results Output of each signed distance which must hold count elements.
+ */
+template <typename Real>
+void signed_distance_batch(
+    ThreadPool& pool, const Plane3<Real>& plane, const Vector3<Real>* points, const size_t count, Real* results)
+{
+    pool.parallel_for(0, count, chunk_size(count), [&](const size_t begin, const size_t end) {
+        nnm::signed_distance_batch(plane, points + begin, end - begin, results + begin);
+    });
+}
+
+/**
+ * Signed distances of many points in a strided view to a plane in parallel.
+ * @tparam Real Floating-point type.
+ * @param pool Pool.
+ * @param plane Plane with a normalized normal.
+ * @param points Points.
+ * @param results Output of each signed distance which must hold as many elements as points.
+ */
+template <typename Real>
+void signed_distance_batch(
+    ThreadPool& pool,
+    const Plane3<Real>& plane,
+    const StridedSpan<const Vector3<Real>> points,
+    const StridedSpan<Real> results)
+{
+    pool.parallel_for(0, points.count, chunk_size(points.count), [&](const size_t begin, const size_t end) {
+        nnm::signed_distance_batch(plane, points.subspan(begin, end - begin), results.subspan(begin, end - begin));
+    });
+}
+
+/**
+ * Orthonormalize many bases to their closest rotations in parallel.
+ * @tparam Real Floating-point type.
+ * @param pool Pool.
+ * @param bases Bases to orthonormalize in place.
+ * @param count Number of bases.
+ */
+template <typename Real>
+void orthonormalize_batch(ThreadPool& pool, Basis3<Real>* bases, const size_t count)
+{
+    pool.parallel_for(0, count, chunk_size(count), [&](const size_t begin, const size_t end) {
+        nnm::orthonormalize_batch(bases + begin, end - begin);
+    });
+}
+
+/**
+ * Smallest axis-aligned box that contains a set of points computed in parallel.
+ * @tparam Real Floating-point type.
+ * @param pool Pool.
+ * @param points Points.
+ * @param count Number of points.
+ * @return Result which has zero size at the origin if there are no points.
+ */
+template <typename Real>
+AABB3<Real> aabb_from_points(ThreadPool& pool, const Vector3<Real>* points, const size_t count)
+{
+    if (count == 0) {
+        return AABB3<Real>();
+    }
+    return pool.parallel_reduce(
+        0,
+        count,
+        chunk_size(count),
+        AABB3<Real>(points[0], points[0]),
+        [&](const size_t begin, const size_t end) { return AABB3<Real>::from_points(points + begin, end - begin); },
+        [](const AABB3<Real>& a, const AABB3<Real>& b) { return a.merge(b); });
+}
+
+/**
+ * Mean position of a set of points computed in parallel. Each chunk is summed with compensated summation and the chunk
+ * sums are added in order.
+ * @tparam Real Floating-point type.
+ * @param pool Pool.
+ * @param points Points.
+ * @param count Number of points.
+ * @return Result which is zero if there are no points.
+ */
+template <typename Real>
+Vector3<Real> centroid(ThreadPool& pool, const Vector3<Real>* points, const size_t count)
+{
+    if (count == 0) {
+        return Vector3<Real>::zero();
+    }
+    const Vector3<Real> sum = pool.parallel_reduce(
+        0,
+        count,
+        chunk_size(count),
+        Vector3<Real>::zero(),
+        [&](const size_t begin, const size_t end) {
+            return nnm::centroid(points + begin, end - begin) * static_cast<Real>(end - begin);
+        },
+        [](const Vector3<Real>& a, const Vector3<Real>& b) { return a + b; });
+    return sum / static_cast<Real>(count);
+}
+
+/**
+ * Covariance matrix of a set of points about their centroid, divided by the number of points, computed in parallel.
+ * The mean and scatter matrix of each chunk are combined pairwise, see Chan et al. "Updating Formulae and a Pairwise
+ * Algorithm for Computing Sample Variances".
+ * @tparam Real Floating-point type.
+ * @param pool Pool.
+ * @param points Points.
+ * @param count Number of points.
+ * @return Result which is zero if there are no points.
+ */
+template <typename Real>
+Matrix3<Real> covariance(ThreadPool& pool, const Vector3<Real>* points, const size_t count)
+{
+    struct Moments {
+        size_t count;
+        Vector3<Real> mean;
+        Matrix3<Real> scatter;
+    };
+    if (count == 0) {
+        return Matrix3<Real>::zero();
+    }
+    const Moments moments = pool.parallel_reduce(
+        0,
+        count,
+        chunk_size(count),
+        Moments { 0, Vector3<Real>::zero(), Matrix3<Real>::zero() },
+        [&](const size_t begin, const size_t end) {
+            const size_t chunk_count = end - begin;
+            const Vector3<Real> mean = nnm::centroid(points + begin, chunk_count);
+            return Moments { chunk_count,
+                             mean,
+                             nnm::covariance(points + begin, chunk_count, mean) * static_cast<Real>(chunk_count) };
+        },
+        [](const Moments& a, const Moments& b) {
+            if (a.count == 0) {
+                return b;
+            }
+            const size_t total = a.count + b.count;
+            const Vector3<Real> delta = b.mean - a.mean;
+            const Real weight = static_cast<Real>(b.count) / static_cast<Real>(total);
+            return Moments { total,
+                             a.mean + delta * weight,
+                             a.scatter + b.scatter + delta.outer(delta) * (static_cast<Real>(a.count) * weight) };
+        });
+    return moments.scatter / static_cast<Real>(count);
+}
+
+}
+
+#endif
@@ -0,0 +1,258 @@
+/* NNM - "No Nonsense Math"
+ * v0.5.0
+ * Copyright (c) 2025-present Matthew Oros
+ * Licensed under MIT
+ */
+
+#ifndef NNM_PLANE3_HPP
+#define NNM_PLANE3_HPP
+
+#include <nnm/ray3.hpp>
+#include <nnm/vector3.hpp>
+
+#include <optional>
+
+namespace nnm {
+
+/**
+ * Three-dimensional plane made of all points where the dot product with the normal is equal to the distance.
+ * @tparam Real Floating-point type.
+ */
+template <typename Real>
+class Plane3 {
+public:
+    /**
+     * Normal of the plane which most methods expect to be normalized.
+     */
+    Vector3<Real> normal;
+
+    /**
+     * Signed distance of the plane from the origin along the normal.
+     */
+    Real distance;
+
+    /**
+     * Initialize as the plane through the origin facing positive y.
+     */
+    constexpr Plane3()
+        : normal(Vector3<Real>::axis_y())
+        , distance(static_cast<Real>(0))
+    {
+    }
+
+    /**
+     * Cast from other plane.
+     * @tparam Other Other type.
+     * @param plane Other plane.
+     */
+    template <typename Other>
+    explicit constexpr Plane3(const Plane3<Other>& plane)
+        : normal(Vector3<Real>(plane.normal))
+        , distance(static_cast<Real>(plane.distance))
+    {
+    }
+
+    /**
+     * Initialize with normal and distance.
+     * @param normal Normal.
+     * @param distance Signed distance from the origin along the normal.
+     */
+    constexpr Plane3(const Vector3<Real>& normal, const Real distance)
+        : normal(normal)
+        , distance(distance)
+    {
+    }
+
+    /**
+     * Plane through a point with a normal.
+     * @param point Point on the plane.
+     * @param normal Normal.
+     * @return Result.
+     */
+    static constexpr Plane3 from_point_normal(const Vector3<Real>& point, const Vector3<Real>& normal)
+    {
+        return { normal, normal.dot(point) };
+    }
+
+    /**
+     * Plane through three points where the normal faces the side from which the points are counter-clockwise in
+     * right-handed coordinates.
+     * @param point0 First point.
+     * @param point1 Second point.
+     * @param point2 Third point.
+     * @return Result.
+     */
+    static Plane3 from_points(const Vector3<Real>& point0, const Vector3<Real>& point1, const Vector3<Real>& point2)
+    {
+        return from_point_normal(point0, (point1 - point0).cross(point2 - point0).normalize());
+    }
+
+    /**
+     * Same plane with the normal normalized.
+     * @return Result.
+     */
+    [[nodiscard]] Plane3 normalize() const
+    {
+        const Real length = normal.length();
+        if (length == static_cast<Real>(0)) {
+            return *this;
+        }
+        return { normal / length, distance / length };
+    }
+
+    /**
+     * Signed distance to a point which is positive on the side the normal faces.
+     * @param point Point.
+     * @return Result.
+     */
+    [[nodiscard]] constexpr Real signed_distance(const Vector3<Real>& point) const
+    {
+        return normal.dot(point) - distance;
+    }
+
+    /**
+     * Closest point on the plane to a point.
+     * @param point Point.
+     * @return Result.
+     */
+    [[nodiscard]] constexpr Vector3<Real> project_point(const Vector3<Real>& point) const
+    {
+        return point - normal * signed_distance(point);
+    }
+
+    /**
+     * Mirror a point across the plane.
+     * @param point Point.
+     * @return Result.
+     */
+    [[nodiscard]] constexpr Vector3<Real> reflect_point(const Vector3<Real>& point) const
+    {
+        return point - normal * (static_cast<Real>(2) * signed_distance(point));
+    }
+
+    /**
+     * Mirror a direction across the plane.
+     * @param direction Direction.
+     * @return Result.
+     */
+    [[nodiscard]] constexpr Vector3<Real> reflect_direction(const Vector3<Real>& direction) const
+    {
+        return direction.reflect(normal);
+    }
+
+    /**
+     * Intersection with an infinite line.
+     * @param point Point on the line.
+     * @param direction Direction of the line.
+     * @return Intersection point or null if the line is parallel.
+     */
+    [[nodiscard]] constexpr std::optional<Vector3<Real>> intersect_line(
+        const Vector3<Real>& point, const Vector3<Real>& direction) const
+    {
+        const Real denominator = normal.dot(direction);
+        if (denominator == static_cast<Real>(0)) {
+            return std::nullopt;
+        }
+        return point - direction * (signed_distance(point) / denominator);
+    }
+
+    /**
+     * Intersection with a line segment.
+     * @param from Start of the segment.
+     * @param to End of the segment.
+     * @return Intersection point or null if the segment does not cross the plane.
+     */
+    [[nodiscard]] constexpr std::optional<Vector3<Real>> intersect_segment(
+        const Vector3<Real>& from, const Vector3<Real>& to) const
+    {
+        const Real distance_from = signed_distance(from);
+        const Real distance_to = signed_distance(to);
+        if ((distance_from > static_cast<Real>(0) && distance_to > static_cast<Real>(0))
+            || (distance_from < static_cast<Real>(0) && distance_to < static_cast<Real>(0))
+            || distance_from == distance_to) {
+            return std::nullopt;
+        }
+        return from + (to - from) * (distance_from / (distance_from - distance_to));
+    }
+
+    /**
+     * Line where two planes intersect.
+     * @param other Other plane.
+     * @return Line as a ray with an unnormalized direction or null if the planes are parallel.
+     */
+    [[nodiscard]] constexpr std::optional<Ray3<Real>> intersect_plane(const Plane3& other) const
+    {
+        const Vector3<Real> direction = normal.cross(other.normal);
+        const Real denominator = direction.length_sqrd();
+        if (denominator == static_cast<Real>(0)) {
+            return std::nullopt;
+        }
+        const Vector3<Real> point = (other.normal * distance - normal * other.distance).cross(direction) / denominator;
+        return Ray3<Real>(point, direction);
+    }
+
+    /**
+     * Point where three planes intersect.
+     * @param other1 Second plane.
+     * @param other2 Third plane.
+     * @return Intersection point or null if any two of the planes are parallel.
+     */
+    [[nodiscard]] constexpr std::optional<Vector3<Real>> intersect_planes(
+        const Plane3& other1, const Plane3& other2) const
+    {
+        const Vector3<Real> cross12 = other1.normal.cross(other2.normal);
+        const Real denominator = normal.dot(cross12);
+        if (denominator == static_cast<Real>(0)) {
+            return std::nullopt;
+        }
+        return (cross12 * distance + other2.normal.cross(normal) * other1.distance
+                + normal.cross(other1.normal) * other2.distance)
+            / denominator;
+    }
+
+    /**
+     * Transform by a transform using its inverse-transpose so that normals stay perpendicular under non-uniform scale.
+     * The transform must be invertible.
+     * @param by Transform.
+     * @return Result with a normalized normal.
+     */
+    [[nodiscard]] Plane3 transform(const Transform3<Real>& by) const
+    {
+        const Vector4<Real> result = Vector4<Real>(normal, -distance) * by.unchecked_inverse().matrix;
+        return Plane3(result.xyz(), -result.w).normalize();
+    }
+
+    /**
+     * Determines if approximately equal to another plane.
+     * @param other Other plane.
+     * @return True if approximately equal, false otherwise.
+     */
+    [[nodiscard]] constexpr bool approx_equal(const Plane3& other) const
+    {
+        return normal.approx_equal(other.normal) && nnm::approx_equal(distance, other.distance);
+    }
+
+    /**
+     * Equality.
+     * @param other Other plane.
+     * @return True if equal, false otherwise.
+     */
+    [[nodiscard]] constexpr bool operator==(const Plane3& other) const
+    {
+        return normal == other.normal && distance == other.distance;
+    }
+
+    /**
+     * Inequality.
+     * @param other Other plane.
+     * @return True if not equal, false otherwise.
+     */
+    [[nodiscard]] constexpr bool operator!=(const Plane3& other) const
+    {
+        return normal != other.normal || distance != other.distance;
+    }
+};
+
+}
+
+#endif
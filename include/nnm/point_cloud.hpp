@@ -0,0 +1,334 @@
+/* NNM - "No Nonsense Math"
+ * v0.5.0
+ * Copyright (c) 2025-present Matthew Oros
+ * Licensed under MIT
+ */
+
+#ifndef NNM_POINT_CLOUD_HPP
+#define NNM_POINT_CLOUD_HPP
+
+#include <nnm/nnm.hpp>
+#include <nnm/parallel.hpp>
+
+#include <cstddef>
+#include <optional>
+#include <utility>
+
+#ifdef _WIN32
+#ifndef NOMINMAX
+#define NOMINMAX
+#endif
+#ifndef WIN32_LEAN_AND_MEAN
+#define WIN32_LEAN_AND_MEAN
+#endif
+#include <windows.h>
+#else
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+namespace nnm::point_cloud {
+
+/**
+ * Number of bytes of points transformed by a single task which keeps the input and output of a task in the L2 cache.
+ */
+constexpr size_t chunk_bytes = 256 * 1024;
+
+/**
+ * File mapped into memory which is unmapped and closed on destruction.
+ */
+class MappedFile {
+public:
+    /**
+     * Maps an existing file for reading.
+     * @param path Path to the file.
+     * @return Result or null if the file could not be opened or mapped.
+     */
+    static std::optional<MappedFile> open_read(const char* path)
+    {
+        MappedFile file;
+#ifdef _WIN32
+        file.m_file = CreateFileA(
+            path, GENERIC_READ, FILE_SHARE_READ, nullptr, OPEN_EXISTING, FILE_FLAG_SEQUENTIAL_SCAN, nullptr);
+        LARGE_INTEGER size;
+        if (file.m_file == INVALID_HANDLE_VALUE || !GetFileSizeEx(file.m_file, &size)) {
+            return std::nullopt;
+        }
+        file.m_size = static_cast<size_t>(size.QuadPart);
+        if (file.m_size == 0) {
+            return file;
+        }
+        file.m_mapping = CreateFileMappingA(file.m_file, nullptr, PAGE_READONLY, 0, 0, nullptr);
+        if (file.m_mapping == nullptr) {
+            return std::nullopt;
+        }
+        file.m_data = static_cast<std::byte*>(MapViewOfFile(file.m_mapping, FILE_MAP_READ, 0, 0, 0));
+#else
+        file.m_file = ::open(path, O_RDONLY);
+        struct stat status {};
+        if (file.m_file == -1 || fstat(file.m_file, &status) != 0) {
+            return std::nullopt;
+        }
+        file.m_size = static_cast<size_t>(status.st_size);
+        if (file.m_size == 0) {
+            return file;
+        }
+        void* data = mmap(nullptr, file.m_size, PROT_READ, MAP_SHARED, file.m_file, 0);
+        if (data == MAP_FAILED) {
+            return std::nullopt;
+        }
+        file.m_data = static_cast<std::byte*>(data);
+        madvise(data, file.m_size, MADV_SEQUENTIAL);
+#endif
+        if (file.m_data == nullptr) {
+            return std::nullopt;
+        }
+        return file;
+    }
+
+    /**
+     * Creates or truncates a file to a size and maps it for reading and writing.
+     * @param path Path to the file.
+     * @param size Size of the file in bytes.
+     * @return Result or null if the file could not be created or mapped.
+     */
+    static std::optional<MappedFile> create(const char* path, const size_t size)
+    {
+        MappedFile file;
+        file.m_size = size;
+#ifdef _WIN32
+        file.m_file = CreateFileA(
+            path, GENERIC_READ | GENERIC_WRITE, 0, nullptr, CREATE_ALWAYS, FILE_ATTRIBUTE_NORMAL, nullptr);
+        if (file.m_file == INVALID_HANDLE_VALUE) {
+            return std::nullopt;
+        }
+        if (size == 0) {
+            return file;
+        }
+        const auto size64 = static_cast<unsigned long long>(size);
+        file.m_mapping = CreateFileMappingA(
+            file.m_file,
+            nullptr,
+            PAGE_READWRITE,
+            static_cast<DWORD>(size64 >> 32),
+            static_cast<DWORD>(size64 & 0xffffffffull),
+            nullptr);
+        if (file.m_mapping == nullptr) {
+            return std::nullopt;
+        }
+        file.m_data = static_cast<std::byte*>(MapViewOfFile(file.m_mapping, FILE_MAP_WRITE, 0, 0, 0));
+#else
+        file.m_file = ::open(path, O_RDWR | O_CREAT | O_TRUNC, 0644);
+        if (file.m_file == -1 || ftruncate(file.m_file, static_cast<off_t>(size)) != 0) {
+            return std::nullopt;
+        }
+        if (size == 0) {
+            return file;
+        }
+        void* data = mmap(nullptr, size, PROT_READ | PROT_WRITE, MAP_SHARED, file.m_file, 0);
+        if (data == MAP_FAILED) {
+            return std::nullopt;
+        }
+        file.m_data = static_cast<std::byte*>(data);
+#endif
+        if (file.m_data == nullptr) {
+            return std::nullopt;
+        }
+        return file;
+    }
+
+    MappedFile(const MappedFile&) = delete;
+
+    MappedFile(MappedFile&& other) noexcept
+        : m_data { std::exchange(other.m_data, nullptr) }
+        , m_size { std::exchange(other.m_size, 0) }
+#ifdef _WIN32
+        , m_file { std::exchange(other.m_file, INVALID_HANDLE_VALUE) }
+        , m_mapping { std::exchange(other.m_mapping, nullptr) }
+#else
+        , m_file { std::exchange(other.m_file, -1) }
+#endif
+    {
+    }
+
+    MappedFile& operator=(const MappedFile&) = delete;
+
+    MappedFile& operator=(MappedFile&& other) noexcept
+    {
+        if (this != &other) {
+            close();
+            m_data = std::exchange(other.m_data, nullptr);
+            m_size = std::exchange(other.m_size, 0);
+#ifdef _WIN32
+            m_file = std::exchange(other.m_file, INVALID_HANDLE_VALUE);
+            m_mapping = std::exchange(other.m_mapping, nullptr);
+#else
+            m_file = std::exchange(other.m_file, -1);
+#endif
+        }
+        return *this;
+    }
+
+    ~MappedFile()
+    {
+        close();
+    }
+
+    /**
+     * Whether a path refers to this file which compares the file identities so that different paths to the same file,
+     * such as links, also match.
+     * @param path Path.
+     * @return Result which is false if the path does not exist.
+     */
+    [[nodiscard]] bool same_file(const char* path) const
+    {
+#ifdef _WIN32
+        const HANDLE other = CreateFileA(
+            path, 0, FILE_SHARE_READ | FILE_SHARE_WRITE | FILE_SHARE_DELETE, nullptr, OPEN_EXISTING, 0, nullptr);
+        if (other == INVALID_HANDLE_VALUE) {
+            return false;
+        }
+        BY_HANDLE_FILE_INFORMATION info {};
+        BY_HANDLE_FILE_INFORMATION other_info {};
+        const bool result = GetFileInformationByHandle(m_file, &info) && GetFileInformationByHandle(other, &other_info)
+            && info.dwVolumeSerialNumber == other_info.dwVolumeSerialNumber
+            && info.nFileIndexHigh == other_info.nFileIndexHigh && info.nFileIndexLow == other_info.nFileIndexLow;
+        CloseHandle(other);
+        return result;
+#else
+        struct stat status {};
+        struct stat other_status {};
+        return fstat(m_file, &status) == 0 && ::stat(path, &other_status) == 0 && status.st_dev == other_status.st_dev
+            && status.st_ino == other_status.st_ino;
+#endif
+    }
+
+    /**
+     * Start of the mapped bytes which is null if the file is empty.
+     * @return Result.
+     */
+    [[nodiscard]] std::byte* data() const
+    {
+        return m_data;
+    }
+
+    /**
+     * Size of the file in bytes.
+     * @return Result.
+     */
+    [[nodiscard]] size_t size() const
+    {
+        return m_size;
+    }
+
+private:
+    std::byte* m_data = nullptr;
+    size_t m_size = 0;
+#ifdef _WIN32
+    HANDLE m_file = INVALID_HANDLE_VALUE;
+    HANDLE m_mapping = nullptr;
+#else
+    int m_file = -1;
+#endif
+
+    MappedFile() = default;
+
+    void close()
+    {
+#ifdef _WIN32
+        if (m_data != nullptr) {
+            UnmapViewOfFile(m_data);
+        }
+        if (m_mapping != nullptr) {
+            CloseHandle(m_mapping);
+        }
+        if (m_file != INVALID_HANDLE_VALUE) {
+            CloseHandle(m_file);
+        }
+        m_mapping = nullptr;
+        m_file = INVALID_HANDLE_VALUE;
+#else
+        if (m_data != nullptr) {
+            munmap(m_data, m_size);
+        }
+        if (m_file != -1) {
+            ::close(m_file);
+        }
+        m_file = -1;
+#endif
+        m_data = nullptr;
+        m_size = 0;
+    }
+};
+
+/**
+ * Transforms a file of packed Vector3 points into another file in parallel without reading either file into a buffer.
+ * Both files are mapped into memory and each task transforms chunk_bytes of points directly from the input mapping
+ * into the output mapping and computes the bounds of its output while it is still in the cache.
+ * @tparam Real Floating-point type of the points in the files.
+ * @param pool Pool.
+ * @param by Transform.
+ * @param input_path Path to the input file whose size must be a multiple of sizeof(Vector3<Real>).
+ * @param output_path Path to the output file which is created or replaced and must not be the input file.
+ * @return Bounds of the transformed points which has zero size at the origin if there are no points, or null if
+ * either file could not be mapped, both paths refer to the same file, or the input size is not a multiple of the point
+ * size.
+ */
+template <typename Real>
+std::optional<AABB3<Real>> transform_file(
+    parallel::ThreadPool& pool, const Transform3<Real>& by, const char* input_path, const char* output_path)
+{
+    const std::optional<MappedFile> input = MappedFile::open_read(input_path);
+    if (!input.has_value() || input->size() % sizeof(Vector3<Real>) != 0) {
+        return std::nullopt;
+    }
+    // Creating the output truncates it which would destroy the input if both paths refer to the same file.
+    if (input->same_file(output_path)) {
+        return std::nullopt;
+    }
+    const std::optional<MappedFile> output = MappedFile::create(output_path, input->size());
+    if (!output.has_value()) {
+        return std::nullopt;
+    }
+    const size_t count = input->size() / sizeof(Vector3<Real>);
+    if (count == 0) {
+        return AABB3<Real>();
+    }
+    // Mappings start on a page boundary so the points are aligned.
+    const auto points = reinterpret_cast<const Vector3<Real>*>(input->data());
+    const auto results = reinterpret_cast<Vector3<Real>*>(output->data());
+    constexpr size_t chunk_points = chunk_bytes / sizeof(Vector3<Real>);
+    return pool.parallel_reduce(
+        0,
+        count,
+        chunk_points,
+        AABB3<Real>(points[0].transform(by), points[0].transform(by)),
+        [&](const size_t begin, const size_t end) {
+            transform_point_batch(by, points + begin, end - begin, results + begin);
+            return AABB3<Real>::from_points(results + begin, end - begin);
+        },
+        [](const AABB3<Real>& a, const AABB3<Real>& b) { return a.merge(b); });
+}
+
+/**
+ * Transforms a file of packed Vector3 points into another file in parallel using the default pool.
+ * @tparam Real Floating-point type of the points in the files.
+ * @param by Transform.
+ * @param input_path Path to the input file whose size must be a multiple of sizeof(Vector3<Real>).
+ * @param output_path Path to the output file which is created or replaced and must not be the input file.
+ * @return Bounds of the transformed points which has zero size at the origin if there are no points, or null if
+ * either file could not be mapped, both paths refer to the same file, or the input size is not a multiple of the point
+ * size.
+ */
+template <typename Real>
+std::optional<AABB3<Real>> transform_file(
+    const Transform3<Real>& by, const char* input_path, const char* output_path)
+{
+    return transform_file(parallel::default_pool(), by, input_path, output_path);
+}
+
+}
+
+#endif
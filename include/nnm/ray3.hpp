@@ -0,0 +1,541 @@
+/* NNM - "No Nonsense Math"
+ * v0.5.0
+ * Copyright (c) 2025-present Matthew Oros
+ * Licensed under MIT
+ */
+
+#ifndef NNM_RAY3_HPP
+#define NNM_RAY3_HPP
+
+#include <nnm/vector3.hpp>
+
+#include <cstdint>
+#include <optional>
+
+namespace nnm {
+
+/**
+ * Three-dimensional ray with a precomputed inverse direction.
+ * @tparam Real Floating-point type.
+ */
+template <typename Real>
+class Ray3 {
+public:
+    /**
+     * Origin of the ray.
+     */
+    Vector3<Real> origin;
+
+    /**
+     * Direction of the ray which does not need to be normalized. Distances along the ray are in multiples of it.
+     */
+    Vector3<Real> direction;
+
+    /**
+     * Component-wise inverse of the direction. Must be updated if the direction is changed.
+     */
+    Vector3<Real> inverse_direction;
+
+    /**
+     * Initialize at the origin pointing towards positive z.
+     */
+    constexpr Ray3()
+        : origin(Vector3<Real>::zero())
+        , direction(Vector3<Real>::axis_z())
+        , inverse_direction(Vector3<Real>::axis_z().inverse())
+    {
+    }
+
+    /**
+     * Cast from other ray.
+     * @tparam Other Other type.
+     * @param ray Other ray.
+     */
+    template <typename Other>
+    explicit constexpr Ray3(const Ray3<Other>& ray)
+        : origin(Vector3<Real>(ray.origin))
+        , direction(Vector3<Real>(ray.direction))
+        , inverse_direction(direction.inverse())
+    {
+    }
+
+    /**
+     * Initialize with origin and direction.
+     * @param origin Origin.
+     * @param direction Direction which does not need to be normalized.
+     */
+    constexpr Ray3(const Vector3<Real>& origin, const Vector3<Real>& direction)
+        : origin(origin)
+        , direction(direction)
+        , inverse_direction(direction.inverse())
+    {
+    }
+
+    /**
+     * Ray from a position towards another position where a distance of one is at the second position.
+     * @param from Position from.
+     * @param to Position to.
+     * @return Result.
+     */
+    static constexpr Ray3 from_points(const Vector3<Real>& from, const Vector3<Real>& to)
+    {
+        return { from, to - from };
+    }
+
+    /**
+     * Position at a distance along the ray.
+     * @param distance Distance in multiples of the direction.
+     * @return Result.
+     */
+    [[nodiscard]] constexpr Vector3<Real> point_at(const Real distance) const
+    {
+        return origin + direction * distance;
+    }
+
+    /**
+     * Distance to a triangle using the Moller-Trumbore algorithm. Both sides of the triangle are hit.
+     * @param vertex0 First vertex.
+     * @param vertex1 Second vertex.
+     * @param vertex2 Third vertex.
+     * @return Distance in multiples of the direction or null if there is no intersection.
+     */
+    [[nodiscard]] constexpr std::optional<Real> intersect_triangle(
+        const Vector3<Real>& vertex0, const Vector3<Real>& vertex1, const Vector3<Real>& vertex2) const
+    {
+        const Vector3<Real> edge1 = vertex1 - vertex0;
+        const Vector3<Real> edge2 = vertex2 - vertex0;
+        const Vector3<Real> p = direction.cross(edge2);
+        const Real determinant = edge1.dot(p);
+        if (determinant == static_cast<Real>(0)) {
+            return std::nullopt;
+        }
+        const Real inverse_determinant = static_cast<Real>(1) / determinant;
+        const Vector3<Real> s = origin - vertex0;
+        const Real u = s.dot(p) * inverse_determinant;
+        if (u < static_cast<Real>(0) || u > static_cast<Real>(1)) {
+            return std::nullopt;
+        }
+        const Vector3<Real> q = s.cross(edge1);
+        const Real v = direction.dot(q) * inverse_determinant;
+        if (v < static_cast<Real>(0) || u + v > static_cast<Real>(1)) {
+            return std::nullopt;
+        }
+        const Real distance = edge2.dot(q) * inverse_determinant;
+        if (distance < static_cast<Real>(0)) {
+            return std::nullopt;
+        }
+        return distance;
+    }
+
+    /**
+     * Distance to a triangle using watertight ray-triangle intersection which never lets a ray pass between two
+     * triangles that share an edge. Both sides of the triangle are hit.
+     * See Woop et al. "Watertight Ray/Triangle Intersection".
+     * @param vertex0 First vertex.
+     * @param vertex1 Second vertex.
+     * @param vertex2 Third vertex.
+     * @return Distance in multiples of the direction or null if there is no intersection.
+     */
+    [[nodiscard]] constexpr std::optional<Real> intersect_triangle_watertight(
+        const Vector3<Real>& vertex0, const Vector3<Real>& vertex1, const Vector3<Real>& vertex2) const
+    {
+        const uint8_t kz = direction.abs_max_index();
+        uint8_t kx = (kz + 1) % 3;
+        uint8_t ky = (kx + 1) % 3;
+        if (direction.at(kz) < static_cast<Real>(0)) {
+            const uint8_t k = kx;
+            kx = ky;
+            ky = k;
+        }
+        const Real shear_x = direction.at(kx) / direction.at(kz);
+        const Real shear_y = direction.at(ky) / direction.at(kz);
+        const Real shear_z = static_cast<Real>(1) / direction.at(kz);
+        const Vector3<Real> a = vertex0 - origin;
+        const Vector3<Real> b = vertex1 - origin;
+        const Vector3<Real> c = vertex2 - origin;
+        const Real a_x = a.at(kx) - shear_x * a.at(kz);
+        const Real a_y = a.at(ky) - shear_y * a.at(kz);
+        const Real b_x = b.at(kx) - shear_x * b.at(kz);
+        const Real b_y = b.at(ky) - shear_y * b.at(kz);
+        const Real c_x = c.at(kx) - shear_x * c.at(kz);
+        const Real c_y = c.at(ky) - shear_y * c.at(kz);
+        const Real u = c_x * b_y - c_y * b_x;
+        const Real v = a_x * c_y - a_y * c_x;
+        const Real w = b_x * a_y - b_y * a_x;
+        const Real zero = static_cast<Real>(0);
+        if ((u < zero || v < zero || w < zero) && (u > zero || v > zero || w > zero)) {
+            return std::nullopt;
+        }
+        const Real determinant = u + v + w;
+        if (determinant == zero) {
+            return std::nullopt;
+        }
+        const Real scaled_distance = shear_z * (u * a.at(kz) + v * b.at(kz) + w * c.at(kz));
+        const Real distance = scaled_distance / determinant;
+        if (distance < zero) {
+            return std::nullopt;
+        }
+        return distance;
+    }
+
+    /**
+     * Distance to an axis-aligned box using the slab method.
+     * @param min Minimum corner of the box.
+     * @param max Maximum corner of the box.
+     * @return Distance in multiples of the direction, zero if the origin is inside, or null if there is no
+     * intersection.
+     */
+    [[nodiscard]] constexpr std::optional<Real> intersect_aabb(const Vector3<Real>& min, const Vector3<Real>& max) const
+    {
+        const Vector3<Real> t1 = (min - origin) * inverse_direction;
+        const Vector3<Real> t2 = (max - origin) * inverse_direction;
+        const Real enter = nnm::max(
+            nnm::min(t1.x, t2.x), nnm::min(t1.y, t2.y), nnm::min(t1.z, t2.z), static_cast<Real>(0));
+        const Real leave = nnm::min(nnm::max(t1.x, t2.x), nnm::max(t1.y, t2.y), nnm::max(t1.z, t2.z));
+        if (enter > leave) {
+            return std::nullopt;
+        }
+        return enter;
+    }
+
+    /**
+     * Distance to an axis-aligned box using the slab method.
+     * @param box Box.
+     * @return Distance in multiples of the direction, zero if the origin is inside, or null if there is no
+     * intersection.
+     */
+    [[nodiscard]] constexpr std::optional<Real> intersect_aabb(const AABB3<Real>& box) const
+    {
+        return intersect_aabb(box.min, box.max);
+    }
+
+    /**
+     * Distance to an oriented bounding box.
+     * @param box Box.
+     * @return Distance in multiples of the direction, zero if the origin is inside, or null if there is no
+     * intersection.
+     */
+    [[nodiscard]] constexpr std::optional<Real> intersect_obb(const OBB3<Real>& box) const
+    {
+        return box.intersect_ray(origin, direction);
+    }
+
+    /**
+     * Distance to a sphere.
+     * @param center Center of the sphere.
+     * @param radius Radius of the sphere.
+     * @return Distance in multiples of the direction, zero if the origin is inside, or null if there is no
+     * intersection.
+     */
+    [[nodiscard]] std::optional<Real> intersect_sphere(const Vector3<Real>& center, const Real radius) const
+    {
+        const Vector3<Real> offset = origin - center;
+        const Real c = offset.length_sqrd() - sqrd(radius);
+        if (c <= static_cast<Real>(0)) {
+            return static_cast<Real>(0);
+        }
+        const Real b = offset.dot(direction);
+        if (b >= static_cast<Real>(0)) {
+            return std::nullopt;
+        }
+        const Real a = direction.length_sqrd();
+        const Real discriminant = sqrd(b) - a * c;
+        if (discriminant < static_cast<Real>(0)) {
+            return std::nullopt;
+        }
+        return (-b - sqrt(discriminant)) / a;
+    }
+
+    /**
+     * Distance to a sphere.
+     * @param sphere Sphere.
+     * @return Distance in multiples of the direction, zero if the origin is inside, or null if there is no
+     * intersection.
+     */
+    [[nodiscard]] std::optional<Real> intersect_sphere(const Sphere3<Real>& sphere) const;
+
+    /**
+     * Distance to a plane made of all points where the dot product with the normal is equal to the distance.
+     * @param normal Normal of the plane.
+     * @param distance Distance of the plane from the origin along the normal.
+     * @return Distance in multiples of the direction or null if the ray is parallel or pointing away.
+     */
+    [[nodiscard]] constexpr std::optional<Real> intersect_plane(const Vector3<Real>& normal, const Real distance) const
+    {
+        const Real denominator = normal.dot(direction);
+        if (denominator == static_cast<Real>(0)) {
+            return std::nullopt;
+        }
+        const Real result = (distance - normal.dot(origin)) / denominator;
+        if (result < static_cast<Real>(0)) {
+            return std::nullopt;
+        }
+        return result;
+    }
+
+    /**
+     * Distance to a plane.
+     * @param plane Plane.
+     * @return Distance in multiples of the direction or null if the ray is parallel or pointing away.
+     */
+    [[nodiscard]] constexpr std::optional<Real> intersect_plane(const Plane3<Real>& plane) const;
+
+    /**
+     * Determines if approximately equal to another ray.
+     * @param other Other ray.
+     * @return True if origin and direction are approximately equal, false otherwise.
+     */
+    [[nodiscard]] constexpr bool approx_equal(const Ray3& other) const
+    {
+        return origin.approx_equal(other.origin) && direction.approx_equal(other.direction);
+    }
+
+    /**
+     * Equality.
+     * @param other Other ray.
+     * @return True if origin and direction are equal, false otherwise.
+     */
+    [[nodiscard]] constexpr bool operator==(const Ray3& other) const
+    {
+        return origin == other.origin && direction == other.direction;
+    }
+
+    /**
+     * Inequality.
+     * @param other Other ray.
+     * @return True if origin or direction are not equal, false otherwise.
+     */
+    [[nodiscard]] constexpr bool operator!=(const Ray3& other) const
+    {
+        return origin != other.origin || direction != other.direction;
+    }
+};
+
+/**
+ * Fixed number of three-dimensional rays stored as separate arrays for each component so that intersecting all rays
+ * with the same primitive can be auto-vectorized.
+ * @tparam Real Floating-point type.
+ * @tparam Size Number of rays which is typically the SIMD width such as 4 or 8.
+ */
+template <typename Real, uint8_t Size>
+class Ray3Packet {
+public:
+    /**
+     * Origin X component of each ray.
+     */
+    Real origin_x[Size];
+
+    /**
+     * Origin Y component of each ray.
+     */
+    Real origin_y[Size];
+
+    /**
+     * Origin Z component of each ray.
+     */
+    Real origin_z[Size];
+
+    /**
+     * Direction X component of each ray.
+     */
+    Real direction_x[Size];
+
+    /**
+     * Direction Y component of each ray.
+     */
+    Real direction_y[Size];
+
+    /**
+     * Direction Z component of each ray.
+     */
+    Real direction_z[Size];
+
+    /**
+     * Reciprocal of the direction X component of each ray.
+     */
+    Real inverse_direction_x[Size];
+
+    /**
+     * Reciprocal of the direction Y component of each ray.
+     */
+    Real inverse_direction_y[Size];
+
+    /**
+     * Reciprocal of the direction Z component of each ray.
+     */
+    Real inverse_direction_z[Size];
+
+    /**
+     * Result of intersecting each ray with a primitive.
+     */
+    struct Hits {
+        /**
+         * If each ray intersects.
+         */
+        bool hit[Size];
+
+        /**
+         * Distance along each ray in multiples of its direction, or zero if there is no intersection.
+         */
+        Real distance[Size];
+    };
+
+    /**
+     * Initialize all rays at the origin pointing towards positive z.
+     */
+    constexpr Ray3Packet()
+        : Ray3Packet(Ray3<Real>())
+    {
+    }
+
+    /**
+     * Initialize all rays to the same ray.
+     * @param ray Ray.
+     */
+    explicit constexpr Ray3Packet(const Ray3<Real>& ray)
+        : origin_x {}
+        , origin_y {}
+        , origin_z {}
+        , direction_x {}
+        , direction_y {}
+        , direction_z {}
+        , inverse_direction_x {}
+        , inverse_direction_y {}
+        , inverse_direction_z {}
+    {
+        for (uint8_t i = 0; i < Size; ++i) {
+            set(i, ray);
+        }
+    }
+
+    /**
+     * Initialize from an array of rays.
+     * @param rays Rays which must hold Size elements.
+     */
+    explicit constexpr Ray3Packet(const Ray3<Real>* rays)
+        : origin_x {}
+        , origin_y {}
+        , origin_z {}
+        , direction_x {}
+        , direction_y {}
+        , direction_z {}
+        , inverse_direction_x {}
+        , inverse_direction_y {}
+        , inverse_direction_z {}
+    {
+        for (uint8_t i = 0; i < Size; ++i) {
+            set(i, rays[i]);
+        }
+    }
+
+    /**
+     * Ray at an index.
+     * @param index Index.
+     * @return Result.
+     */
+    [[nodiscard]] constexpr Ray3<Real> ray(const uint8_t index) const
+    {
+        NNM_BOUNDS_CHECK_ASSERT("Ray3Packet", index < Size);
+        return { { origin_x[index], origin_y[index], origin_z[index] },
+                 { direction_x[index], direction_y[index], direction_z[index] } };
+    }
+
+    /**
+     * Replace the ray at an index.
+     * @param index Index.
+     * @param ray Ray.
+     */
+    constexpr void set(const uint8_t index, const Ray3<Real>& ray)
+    {
+        NNM_BOUNDS_CHECK_ASSERT("Ray3Packet", index < Size);
+        origin_x[index] = ray.origin.x;
+        origin_y[index] = ray.origin.y;
+        origin_z[index] = ray.origin.z;
+        direction_x[index] = ray.direction.x;
+        direction_y[index] = ray.direction.y;
+        direction_z[index] = ray.direction.z;
+        inverse_direction_x[index] = ray.inverse_direction.x;
+        inverse_direction_y[index] = ray.inverse_direction.y;
+        inverse_direction_z[index] = ray.inverse_direction.z;
+    }
+
+    /**
+     * Intersect all rays with a triangle using the Moller-Trumbore algorithm. Both sides of the triangle are hit.
+     * @param vertex0 First vertex.
+     * @param vertex1 Second vertex.
+     * @param vertex2 Third vertex.
+     * @return Result.
+     */
+    [[nodiscard]] constexpr Hits intersect_triangle(
+        const Vector3<Real>& vertex0, const Vector3<Real>& vertex1, const Vector3<Real>& vertex2) const
+    {
+        const Vector3<Real> edge1 = vertex1 - vertex0;
+        const Vector3<Real> edge2 = vertex2 - vertex0;
+        const Real zero = static_cast<Real>(0);
+        const Real one = static_cast<Real>(1);
+        Hits hits {};
+        // Branchless so that the loop can be vectorized
+        for (uint8_t i = 0; i < Size; ++i) {
+            const Real p_x = direction_y[i] * edge2.z - direction_z[i] * edge2.y;
+            const Real p_y = direction_z[i] * edge2.x - direction_x[i] * edge2.z;
+            const Real p_z = direction_x[i] * edge2.y - direction_y[i] * edge2.x;
+            const Real determinant = edge1.x * p_x + edge1.y * p_y + edge1.z * p_z;
+            const Real inverse_determinant = one / (determinant == zero ? one : determinant);
+            const Real s_x = origin_x[i] - vertex0.x;
+            const Real s_y = origin_y[i] - vertex0.y;
+            const Real s_z = origin_z[i] - vertex0.z;
+            const Real u = (s_x * p_x + s_y * p_y + s_z * p_z) * inverse_determinant;
+            const Real q_x = s_y * edge1.z - s_z * edge1.y;
+            const Real q_y = s_z * edge1.x - s_x * edge1.z;
+            const Real q_z = s_x * edge1.y - s_y * edge1.x;
+            const Real v = (direction_x[i] * q_x + direction_y[i] * q_y + direction_z[i] * q_z) * inverse_determinant;
+            const Real distance = (edge2.x * q_x + edge2.y * q_y + edge2.z * q_z) * inverse_determinant;
+            const bool hit = (determinant != zero) & (u >= zero) & (v >= zero) & (u + v <= one) & (distance >= zero);
+            hits.hit[i] = hit;
+            hits.distance[i] = hit ? distance : zero;
+        }
+        return hits;
+    }
+
+    /**
+     * Intersect all rays with an axis-aligned box using the slab method.
+     * @param min Minimum corner of the box.
+     * @param max Maximum corner of the box.
+     * @return Result where the distance is zero for rays that start inside the box.
+     */
+    [[nodiscard]] constexpr Hits intersect_aabb(const Vector3<Real>& min, const Vector3<Real>& max) const
+    {
+        Hits hits {};
+        for (uint8_t i = 0; i < Size; ++i) {
+            const Real t1_x = (min.x - origin_x[i]) * inverse_direction_x[i];
+            const Real t2_x = (max.x - origin_x[i]) * inverse_direction_x[i];
+            const Real t1_y = (min.y - origin_y[i]) * inverse_direction_y[i];
+            const Real t2_y = (max.y - origin_y[i]) * inverse_direction_y[i];
+            const Real t1_z = (min.z - origin_z[i]) * inverse_direction_z[i];
+            const Real t2_z = (max.z - origin_z[i]) * inverse_direction_z[i];
+            const Real enter = nnm::max(
+                nnm::min(t1_x, t2_x), nnm::min(t1_y, t2_y), nnm::min(t1_z, t2_z), static_cast<Real>(0));
+            const Real leave = nnm::min(nnm::max(t1_x, t2_x), nnm::max(t1_y, t2_y), nnm::max(t1_z, t2_z));
+            const bool hit = enter <= leave;
+            hits.hit[i] = hit;
+            hits.distance[i] = hit ? enter : static_cast<Real>(0);
+        }
+        return hits;
+    }
+};
+
+template <typename Real>
+std::optional<Real> Ray3<Real>::intersect_sphere(const Sphere3<Real>& sphere) const
+{
+    return intersect_sphere(sphere.center, sphere.radius);
+}
+
+template <typename Real>
+constexpr std::optional<Real> Ray3<Real>::intersect_plane(const Plane3<Real>& plane) const
+{
+    return intersect_plane(plane.normal, plane.distance);
+}
+
+}
+
+#endif
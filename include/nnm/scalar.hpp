@@ -0,0 +1,840 @@
+/* NNM - "No Nonsense Math"
+ * v0.5.0
+ * Copyright (c) 2025-present Matthew Oros
+ * Licensed under MIT
+ */
+
+#ifndef NNM_SCALAR_HPP
+#define NNM_SCALAR_HPP
+
+#include <cmath>
+#include <cstdint>
+#include <cstring>
+
+// ReSharper disable CppDFATimeOver
+
+// A failed bounds check throws std::out_of_range if exceptions are enabled and aborts otherwise. Define
+// NNM_BOUNDS_CHECK_ABORT, NNM_BOUNDS_CHECK_TRAP, or NNM_BOUNDS_CHECK_HANDLER instead of NNM_BOUNDS_CHECK to abort,
+// trap, or call the handler given to set_bounds_check_handler. The policy must be the same in every source file.
+#if defined(NNM_BOUNDS_CHECK_ABORT) || defined(NNM_BOUNDS_CHECK_TRAP) || defined(NNM_BOUNDS_CHECK_HANDLER)
+#ifndef NNM_BOUNDS_CHECK
+#define NNM_BOUNDS_CHECK
+#endif
+#elif defined(NNM_BOUNDS_CHECK) && (defined(__cpp_exceptions) || defined(_CPPUNWIND))
+#define NNM_BOUNDS_CHECK_THROW
+#endif
+
+#if defined(NNM_BOUNDS_CHECK_THROW)
+#include <stdexcept>
+#elif defined(NNM_BOUNDS_CHECK)
+#include <cstdio>
+#include <cstdlib>
+#endif
+#if defined(NNM_BOUNDS_CHECK_HANDLER)
+#include <atomic>
+#endif
+
+// The failure is handled in a separate cold function so that only a compare and a branch are inlined into accessors.
+#if defined(_MSC_VER)
+#define NNM_COLD __declspec(noinline)
+#elif defined(__GNUC__)
+#define NNM_COLD __attribute__((cold, noinline))
+#else
+#define NNM_COLD
+#endif
+
+#if defined(NNM_BOUNDS_CHECK)
+#define NNM_BOUNDS_CHECK_ASSERT(msg, expression) \
+    if (!(expression))                           \
+        nnm::bounds_check_failed(msg);
+#else
+#define NNM_BOUNDS_CHECK_ASSERT(msg, expression)
+#endif
+
+// Keeps a function out of line for expressions that the optimizer would miscompile once inlined.
+#if defined(_MSC_VER)
+#define NNM_NOINLINE __declspec(noinline)
+#elif defined(__GNUC__)
+#define NNM_NOINLINE __attribute__((noinline))
+#else
+#define NNM_NOINLINE
+#endif
+
+// Small accessors and operators are always inlined so that unoptimized and debug builds do not pay for a call per
+// element access. Define NNM_FORCE_INLINE as inline before including nnm to step into them in a debugger instead.
+#if !defined(NNM_FORCE_INLINE)
+#if defined(_MSC_VER)
+#define NNM_FORCE_INLINE __forceinline
+#elif defined(__GNUC__)
+#define NNM_FORCE_INLINE __attribute__((always_inline)) inline
+#else
+#define NNM_FORCE_INLINE inline
+#endif
+#endif
+
+namespace nnm {
+
+#if defined(NNM_BOUNDS_CHECK_HANDLER)
+/**
+ * Function called with the name of the class when a bounds check fails. The program is aborted if it returns.
+ */
+using BoundsCheckHandler = void (*)(const char* msg);
+
+/**
+ * Handler called when a bounds check fails which aborts if null. It is atomic so that it may be set while other threads
+ * access vectors and matrices.
+ */
+inline std::atomic<BoundsCheckHandler> g_bounds_check_handler { nullptr };
+
+/**
+ * Sets the function called when a bounds check fails.
+ * @param handler Handler or null to abort.
+ */
+inline void set_bounds_check_handler(const BoundsCheckHandler handler)
+{
+    g_bounds_check_handler.store(handler);
+}
+#endif
+
+#if defined(NNM_BOUNDS_CHECK)
+/**
+ * Handles a failed bounds check with the configured policy.
+ * @param msg Name of the class that was accessed out of bounds.
+ */
+[[noreturn]] NNM_COLD inline void bounds_check_failed(const char* msg)
+{
+#if defined(NNM_BOUNDS_CHECK_THROW)
+    throw std::out_of_range(msg);
+#elif defined(NNM_BOUNDS_CHECK_TRAP) && defined(__GNUC__)
+    (void)msg;
+    __builtin_trap();
+#else
+#if defined(NNM_BOUNDS_CHECK_HANDLER)
+    if (const BoundsCheckHandler handler = g_bounds_check_handler.load(); handler != nullptr) {
+        handler(msg);
+    }
+#endif
+    std::fprintf(stderr, "nnm: %s index out of range\n", msg);
+    std::abort();
+#endif
+}
+#endif
+
+/**
+ * Mathematical pi.
+ * @tparam Real Floating-point type.
+ * @return Mathematical pi.
+ */
+template <typename Real>
+constexpr Real pi()
+{
+    return static_cast<Real>(3.141592653589793238462643383279502);
+}
+
+/**
+ * Properties of a Real type which can be specialized for custom Real types.
+ * @tparam Real Floating-point type.
+ */
+template <typename Real>
+class RealTraits {
+public:
+    /**
+     * Epsilon value is the upper bound on approximation errors.
+     * @return Epsilon value.
+     */
+    static constexpr Real epsilon()
+    {
+        return static_cast<Real>(0.00001);
+    }
+
+    /**
+     * Type that values are converted to for standard library math functions.
+     */
+    using Promoted = Real;
+};
+
+/**
+ * Epsilon value is the upper bound on approximation errors which is given by RealTraits.
+ * @tparam Real Floating-point type.
+ * @return Epsilon value.
+ */
+template <typename Real>
+constexpr Real epsilon()
+{
+    return RealTraits<Real>::epsilon();
+}
+
+/**
+ * Converts a value to the type used for standard library math functions.
+ * @tparam Real Floating-point type.
+ * @param value Value.
+ * @return Result.
+ */
+template <typename Real>
+constexpr typename RealTraits<Real>::Promoted promote(const Real value)
+{
+    return static_cast<typename RealTraits<Real>::Promoted>(value);
+}
+
+#if defined(__FLT16_MAX__)
+/**
+ * Properties of the IEEE 754 half-precision compiler extension type. The epsilon value is four steps at one and
+ * standard library math functions are computed in float.
+ */
+template <>
+class RealTraits<_Float16> {
+public:
+    static constexpr _Float16 epsilon()
+    {
+        return static_cast<_Float16>(0.004);
+    }
+
+    using Promoted = float;
+};
+#endif
+
+#if defined(__BFLT16_MAX__)
+/**
+ * Properties of the bfloat16 compiler extension type. The epsilon value is four steps at one and standard library math
+ * functions are computed in float.
+ */
+template <>
+class RealTraits<__bf16> {
+public:
+    static constexpr __bf16 epsilon()
+    {
+        return static_cast<__bf16>(0.03125);
+    }
+
+    using Promoted = float;
+};
+#endif
+
+/**
+ * One multiplied by the sign of a value.
+ * @tparam Num Numeric type.
+ * @param value Value to get the sign of.
+ * @return -1 for negatives and 1 for 0 or positive.
+ */
+template <typename Num>
+constexpr Num sign(const Num value)
+{
+    if (value < static_cast<Num>(0)) {
+        return static_cast<Num>(-1);
+    }
+    return static_cast<Num>(1);
+}
+
+/**
+ * Absolute value which is the number's distance from zero.
+ * @tparam Num Numeric type
+ * @param value Value to take the absolute value of.
+ * @return Result.
+ */
+template <typename Num>
+NNM_FORCE_INLINE constexpr Num abs(const Num value)
+{
+    if (value < static_cast<Num>(0)) {
+        return -value;
+    }
+    return value;
+}
+
+/**
+ * The maximum between two values.
+ * @tparam Num Numeric type.
+ * @param a First value.
+ * @param b Second value.
+ * @return Result.
+ */
+template <typename Num>
+NNM_FORCE_INLINE constexpr Num max(const Num a, const Num b)
+{
+    if (a > b) {
+        return a;
+    }
+    return b;
+}
+
+/**
+ * The maximum between values.
+ * @tparam Num Numeric type.
+ * @tparam Rest Numeric types.
+ * @param first First value.
+ * @param rest Rest of the values.
+ * @return Result.
+ */
+template <typename Num, typename... Rest>
+constexpr Num max(const Num first, const Rest... rest)
+{
+    Num max_value = first;
+    max_value = max(first, max(rest...));
+    return max_value;
+}
+
+/**
+ * Determines if a value is approximately zero based on the epsilon value.
+ * @tparam Real Floating-point type.
+ * @param value Value to test.
+ * @return True if approximately zero or false otherwise.
+ */
+template <typename Real>
+constexpr bool approx_zero(const Real value)
+{
+    Real tolerance = epsilon<Real>() * abs(value);
+    tolerance = max(tolerance, epsilon<Real>());
+    return abs(value) <= tolerance;
+}
+
+/**
+ * Determines if two values are approximately equal based on the epsilon value.
+ * @tparam Real Floating-point type.
+ * @param a First value.
+ * @param b Second value.
+ * @return True if approximately equal or false otherwise.
+ */
+template <typename Real>
+constexpr bool approx_equal(const Real a, const Real b)
+{
+    if (a == b) {
+        return true;
+    }
+    Real tolerance = epsilon<Real>() * max(abs(a), abs(b));
+    tolerance = max(tolerance, epsilon<Real>());
+    return abs(a - b) <= tolerance;
+}
+
+/**
+ * Determine if the first value is approximately less-than but not equal to the second value.
+ * @tparam Real Floating-point type.
+ * @param a First value.
+ * @param b Second value.
+ * @return Result.
+ */
+template <typename Real>
+constexpr bool approx_less(const Real a, const Real b)
+{
+    return a < b && !approx_equal(a, b);
+}
+
+/**
+ * Determine if the first value is approximately greater-than but not equal to the second value.
+ * @tparam Real Floating-point type.
+ * @param a First value.
+ * @param b Second value.
+ * @return Result.
+ */
+template <typename Real>
+constexpr bool approx_greater(const Real a, const Real b)
+{
+    return a > b && !approx_equal(a, b);
+}
+
+/**
+ * Determine if the first value is approximately greater-than or equal to the second value.
+ * @tparam Real Floating-point type.
+ * @param a First value.
+ * @param b Second value.
+ * @return Result.
+ */
+template <typename Real>
+constexpr bool approx_less_equal(const Real a, const Real b)
+{
+    return a <= b || approx_equal(a, b);
+}
+
+/**
+ * Determine if the first value is approximately greater-than or equal to the second value.
+ * @tparam Real Floating-point type.
+ * @param a First value.
+ * @param b Second value.
+ * @return Result.
+ */
+template <typename Real>
+constexpr bool approx_greater_equal(const Real a, const Real b)
+{
+    return a >= b || approx_equal(a, b);
+}
+
+/**
+ * Determine if a value is approximately less-than but not equal to zero.
+ * @tparam Real Floating-point type.
+ * @param value Value.
+ * @return Result.
+ */
+template <typename Real>
+constexpr bool approx_less_zero(const Real value)
+{
+    return value < static_cast<Real>(0) && !approx_zero(value);
+}
+
+/**
+ * Determine if a value is approximately greater-than but not equal to zero.
+ * @tparam Real Floating-point type.
+ * @param value Value.
+ * @return Result.
+ */
+template <typename Real>
+constexpr bool approx_greater_zero(const Real value)
+{
+    return value > static_cast<Real>(0) && !approx_zero(value);
+}
+
+/**
+ * Determine if a value is approximately less-than or equal to zero.
+ * @tparam Real Floating-point type.
+ * @param value Value.
+ * @return Result.
+ */
+template <typename Real>
+constexpr bool approx_less_equal_zero(const Real value)
+{
+    return value <= static_cast<Real>(0) || approx_zero(value);
+}
+
+/**
+ * Determine if a value is approximately greater-than or equal to zero.
+ * @tparam Real Floating-point type.
+ * @param value Value.
+ * @return Result.
+ */
+template <typename Real>
+constexpr bool approx_greater_equal_zero(const Real value)
+{
+    return value >= static_cast<Real>(0) || approx_zero(value);
+}
+
+/**
+ * The least integer value greater than a value.
+ * @tparam Real Floating-point type.
+ * @param value Value to take the ceiling of.
+ * @return Result.
+ */
+template <typename Real>
+Real ceil(const Real value)
+{
+    return static_cast<Real>(std::ceil(promote(value)));
+}
+
+/**
+ * Restricts a value between a minimum and maximum range.
+ * @tparam Num Numeric type.
+ * @param value Value to clamp.
+ * @param min Minimum allowed value.
+ * @param max Maximum allowed value.
+ * @return Result.
+ */
+template <typename Num>
+constexpr Num clamp(const Num value, const Num min, const Num max)
+{
+    if (value < min) {
+        return min;
+    }
+    if (value > max) {
+        return max;
+    }
+    return value;
+}
+
+/**
+ * Square-root of a value.
+ * @tparam Real Floating-point type.
+ * @param value Value to square-root.
+ * @return Result.
+ */
+template <typename Real>
+Real sqrt(const Real value)
+{
+    return static_cast<Real>(std::sqrt(promote(value)));
+}
+
+/**
+ * Exponential operation between two values.
+ * @tparam Real Floating-point type.
+ * @param base Base value.
+ * @param power Power value.
+ * @return Result.
+ */
+template <typename Real>
+Real pow(const Real base, const Real power)
+{
+    return static_cast<Real>(std::pow(promote(base), promote(power)));
+}
+
+/**
+ * Square of a value.
+ * @tparam Num Numeric type.
+ * @param value Value to square.
+ * @return Result.
+ */
+template <typename Num>
+NNM_FORCE_INLINE constexpr Num sqrd(const Num value)
+{
+    return value * value;
+}
+
+/**
+ * Floating-point mathematical modulus where the result is always positive.
+ * @tparam Real Floating-point type.
+ * @param dividend Dividend.
+ * @param divisor Divisor.
+ * @return Result.
+ */
+template <typename Real>
+Real modf(const Real dividend, const Real divisor)
+{
+    const Real result = static_cast<Real>(std::fmod(promote(dividend), promote(divisor)));
+    const Real zero = static_cast<Real>(0);
+    if ((result < zero && divisor > zero) || (result > zero && divisor < zero)) {
+        return result + divisor;
+    }
+    return result;
+}
+
+/**
+ * Integer mathematical modulus where the result is always positive.
+ * @tparam Int Integer type.
+ * @param dividend Dividend.
+ * @param divisor Divisor.
+ * @return Result.
+ */
+template <typename Int>
+constexpr Int mod(const Int dividend, const Int divisor)
+{
+    const Int result = dividend % divisor;
+    if ((result < 0 && divisor > 0) || (result > 0 && divisor < 0)) {
+        return result + divisor;
+    }
+    return result;
+}
+
+/**
+ * Remainder of the division between two floating-point values.
+ * @tparam Real Floating-point type
+ * @param dividend Dividend.
+ * @param divisor Divisor.
+ * @return Result.
+ */
+template <typename Real>
+Real remf(const Real dividend, const Real divisor)
+{
+    return static_cast<Real>(std::fmod(promote(dividend), promote(divisor)));
+}
+
+/**
+ * Remainder of the division between two integer values.
+ * @tparam Int Integer type.
+ * @param dividend Dividend.
+ * @param divisor Divisor.
+ * @return Result.
+ */
+template <typename Int>
+constexpr Int rem(const Int dividend, const Int divisor)
+{
+    return dividend % divisor;
+}
+
+/**
+ * Normalizes an angle in radians between -pi and pi.
+ * @tparam Real Floating-point type.
+ * @param angle Angle to normalize in radians.
+ * @return Result.
+ */
+template <typename Real>
+Real normalize_angle(const Real angle)
+{
+    return modf(angle + pi<Real>(), static_cast<Real>(2) * pi<Real>()) - pi<Real>();
+}
+
+/**
+ * Determines if an angle in radians is within a range taking into account wrap-around.
+ * @tparam Real Floating-point type.
+ * @param angle Angle to test in radians.
+ * @param from First angle in radians.
+ * @param to Second angle in radians
+ * @return True if within range, false otherwise.
+ */
+template <typename Real>
+bool angle_in_range(const Real angle, const Real from, const Real to)
+{
+    const Real two_pi = static_cast<Real>(2) * pi<Real>();
+    if (from <= to) {
+        return modf(angle - from, two_pi) <= modf(to - from, two_pi);
+    }
+    return modf(angle - from, two_pi) >= modf(to - from, two_pi);
+}
+
+/**
+ * The greatest integer value less or equal to a value.
+ * @tparam Real Floating-point type.
+ * @param value Value to take the floor of.
+ * @return Result.
+ */
+template <typename Real>
+Real floor(const Real value)
+{
+    return static_cast<Real>(std::floor(promote(value)));
+}
+
+/**
+ * Linear interpolation between two values based on a weight value.
+ * @tparam Real Floating-point value.
+ * @param from Value to interpolate from.
+ * @param to Value to interpolate to.
+ * @param weight Value that indicates interpolation between the two values normally between 0 and 1.
+ * @return Result.
+ */
+template <typename Real>
+constexpr Real lerp(const Real from, const Real to, const Real weight)
+{
+    return from + weight * (to - from);
+}
+
+/**
+ * Linear interpolation between two values based on a weight value that is clamped between 0 and 1.
+ * @tparam Real Floating-point value.
+ * @param from Value to interpolate from.
+ * @param to Value to interpolate to.
+ * @param weight Value that indicates interpolation between the two values that is clamped between 0 and 1.
+ * @return Result.
+ */
+template <typename Real>
+constexpr Real lerp_clamped(const Real from, const Real to, const Real weight)
+{
+    if (weight >= static_cast<Real>(1)) {
+        return to;
+    }
+    if (weight <= static_cast<Real>(0)) {
+        return from;
+    }
+    return lerp(from, to, weight);
+}
+
+/**
+ * Mathematical sine of a value
+ * @tparam Real Floating-point type.
+ * @param value Value to take the sine of in radians.
+ * @return Result.
+ */
+template <typename Real>
+Real sin(const Real value)
+{
+    return static_cast<Real>(std::sin(promote(value)));
+}
+
+/**
+ * Mathematical cosine.
+ * @tparam Real Floating-point value.
+ * @param value Value to take the cosine of in radians.
+ * @return Result.
+ */
+template <typename Real>
+Real cos(const Real value)
+{
+    return static_cast<Real>(std::cos(promote(value)));
+}
+
+/**
+ * Mathematical tangent.
+ * @tparam Real Floating-point value.
+ * @param value Value to take the tangent of in radians.
+ * @return Result.
+ */
+template <typename Real>
+Real tan(const Real value)
+{
+    return static_cast<Real>(std::tan(promote(value)));
+}
+
+/**
+ * Rounds a value to the nearest integer value.
+ * @tparam Real Floating-point value.
+ * @param value Value to round.
+ * @return Result.
+ */
+template <typename Real>
+Real round(const Real value)
+{
+    return static_cast<Real>(std::round(promote(value)));
+}
+
+/**
+ * Mathematical inverse tangent.
+ * @tparam Real Floating-point value.
+ * @param value Value to take inverse tangent of.
+ * @return Result in radians.
+ */
+template <typename Real>
+Real atan(const Real value)
+{
+    return static_cast<Real>(std::atan(promote(value)));
+}
+
+/**
+ * Mathematical inverse tangent that takes into account all four-quadrants.
+ * @tparam Real Floating-point value.
+ * @param y Y value.
+ * @param x X value.
+ * @return Result in radians.
+ */
+template <typename Real>
+Real atan2(const Real y, const Real x)
+{
+    return static_cast<Real>(std::atan2(promote(y), promote(x)));
+}
+
+/**
+ * Converts angle in degrees to radians.
+ * @tparam Real Floating-point value.
+ * @param degrees Angle in degrees.
+ * @return Resulting angle in radians.
+ */
+template <typename Real>
+constexpr Real radians(const Real degrees)
+{
+    return pi<Real>() / static_cast<Real>(180) * degrees;
+}
+
+/**
+ * Converts angle in radians to degrees.
+ * @tparam Real Floating-point value.
+ * @param radians Angle in radians.
+ * @return Resulting angle in degrees.
+ */
+template <typename Real>
+constexpr Real degrees(const Real radians)
+{
+    return static_cast<Real>(180) / pi<Real>() * radians;
+}
+
+/**
+ * Mathematical inverse sine.
+ * @tparam Real Floating-point value.
+ * @param value Value to take inverse sine of.
+ * @return Resulting angle in radians.
+ */
+template <typename Real>
+Real asin(const Real value)
+{
+    return static_cast<Real>(std::asin(promote(value)));
+}
+
+/**
+ * Mathematical inverse cosine.
+ * @tparam Real Floating-point value.
+ * @param value Value to take the inverse cosine of.
+ * @return Resulting angle in radians.
+ */
+template <typename Real>
+Real acos(const Real value)
+{
+    return static_cast<Real>(std::acos(promote(value)));
+}
+
+/**
+ * The minimum value between two values.
+ * @tparam Num Numeric type.
+ * @param a First value.
+ * @param b Second value.
+ * @return Result.
+ */
+template <typename Num>
+NNM_FORCE_INLINE constexpr Num min(const Num a, const Num b)
+{
+    if (a < b) {
+        return a;
+    }
+    return b;
+}
+
+/**
+ * The minimum between values.
+ * @tparam Num Numeric type.
+ * @tparam Rest Numeric types.
+ * @param first First value.
+ * @param rest Rest of the values.
+ * @return Result.
+ */
+template <typename Num, typename... Rest>
+constexpr Num min(const Num first, const Rest... rest)
+{
+    Num min_value = first;
+    min_value = min(first, min(rest...));
+    return min_value;
+}
+
+/**
+ * Binary logarithm of a value which is the power to which the number 2 must be raised to obtain the value.
+ * @tparam Real Floating-point value.
+ * @param value Value to take logarithm of.
+ * @return Result.
+ */
+template <typename Real>
+Real log2(const Real value)
+{
+    return static_cast<Real>(std::log2(promote(value)));
+}
+
+/**
+ * Converts a value to the bits of an IEEE 754 half-precision value rounding to nearest even. Values too large become
+ * infinity, values too small become zero or subnormal, and NaNs stay NaN. Written without branches on the value so that
+ * loops over many values can be vectorized.
+ * @param value Value.
+ * @return Half-precision bits.
+ */
+inline uint16_t float_to_half(const float value)
+{
+    uint32_t bits;
+    std::memcpy(&bits, &value, sizeof(bits));
+    const uint32_t sign = (bits >> 16) & 0x8000u;
+    const uint32_t magnitude = bits & 0x7fffffffu;
+    // Rebias the exponent from 127 to 15 and round the dropped 13 mantissa bits to nearest even.
+    const uint32_t normal = (magnitude + 0xc8000fffu + ((magnitude >> 13) & 1u)) >> 13;
+    // Adding 0.5 aligns the mantissa so that the hardware rounds subnormals.
+    float magnitude_value;
+    std::memcpy(&magnitude_value, &magnitude, sizeof(magnitude_value));
+    const float subnormal_value = magnitude_value + 0.5f;
+    uint32_t subnormal;
+    std::memcpy(&subnormal, &subnormal_value, sizeof(subnormal));
+    subnormal -= 0x3f000000u;
+    // Choose with masks rather than conditionals which compilers may turn into branches that prevent vectorization.
+    const uint32_t is_subnormal = 0u - static_cast<uint32_t>(magnitude < 0x38800000u);
+    const uint32_t is_overflow = 0u - static_cast<uint32_t>(magnitude >= 0x47800000u);
+    const uint32_t is_nan = 0u - static_cast<uint32_t>(magnitude > 0x7f800000u);
+    uint32_t result = (subnormal & is_subnormal) | (normal & ~is_subnormal);
+    result = (0x7c00u & is_overflow) | (result & ~is_overflow);
+    result |= 0x0200u & is_nan;
+    return static_cast<uint16_t>(result | sign);
+}
+
+/**
+ * Converts the bits of an IEEE 754 half-precision value to a float which is always exact.
+ * @param value Half-precision bits.
+ * @return Result.
+ */
+inline float half_to_float(const uint16_t value)
+{
+    const uint32_t magnitude = (static_cast<uint32_t>(value) & 0x7fffu) << 13;
+    const uint32_t exponent = magnitude & 0x0f800000u;
+    const uint32_t normal = magnitude + 0x38000000u;
+    const uint32_t special = magnitude + 0x70000000u;
+    // Subnormals are renormalized by the hardware by subtracting the smallest normal half value.
+    const uint32_t subnormal_bits = magnitude + 0x38800000u;
+    float subnormal_value;
+    std::memcpy(&subnormal_value, &subnormal_bits, sizeof(subnormal_value));
+    subnormal_value -= 6.103515625e-05f;
+    uint32_t subnormal;
+    std::memcpy(&subnormal, &subnormal_value, sizeof(subnormal));
+    const uint32_t is_subnormal = 0u - static_cast<uint32_t>(exponent == 0);
+    const uint32_t is_special = 0u - static_cast<uint32_t>(exponent == 0x0f800000u);
+    uint32_t result = (subnormal & is_subnormal) | (normal & ~is_subnormal);
+    result = (special & is_special) | (result & ~is_special);
+    result |= (static_cast<uint32_t>(value) & 0x8000u) << 16;
+    float result_value;
+    std::memcpy(&result_value, &result, sizeof(result_value));
+    return result_value;
+}
+
+}
+
+#endif
@@ -0,0 +1,495 @@
+/* NNM - "No Nonsense Math"
+ * v0.5.0
+ * Copyright (c) 2025-present Matthew Oros
+ * Licensed under MIT
+ */
+
+#ifndef NNM_SNAPSHOT_HPP
+#define NNM_SNAPSHOT_HPP
+
+#include <nnm/nnm.hpp>
+
+#include <cstddef>
+#include <array>
+#include <cstdint>
+#include <optional>
+#include <utility>
+#include <vector>
+
+namespace nnm::snapshot {
+
+/**
+ * Number of states whose differences from the baseline are packed with a shared bit width.
+ */
+constexpr size_t block_size = 32;
+
+/**
+ * Number of integers that a state is split into for delta encoding which are the three translation components, the
+ * index of the dropped rotation component, and the three remaining rotation components.
+ */
+constexpr uint8_t channel_count = 7;
+
+/**
+ * Quantized translation and rotation of one object.
+ */
+class State {
+public:
+    /**
+     * Translation x in grid steps.
+     */
+    int32_t x;
+
+    /**
+     * Translation y in grid steps.
+     */
+    int32_t y;
+
+    /**
+     * Translation z in grid steps.
+     */
+    int32_t z;
+
+    /**
+     * Rotation as the bits of a QuaternionPacked48.
+     */
+    uint64_t rotation;
+
+    /**
+     * Initializes to zero translation and identity rotation.
+     */
+    constexpr State()
+        : x { 0 }
+        , y { 0 }
+        , z { 0 }
+        // Bits of QuaternionPacked48() which drops w and stores zero as the middle step for x, y, and z.
+        , rotation { (3ull << 45) | (16383ull << 30) | (16383ull << 15) | 16383ull }
+    {
+    }
+
+    /**
+     * Splits into the integers that are delta encoded.
+     * @param result Output of channel_count integers.
+     */
+    constexpr void channels(uint32_t* result) const
+    {
+        result[0] = static_cast<uint32_t>(x);
+        result[1] = static_cast<uint32_t>(y);
+        result[2] = static_cast<uint32_t>(z);
+        result[3] = static_cast<uint32_t>(rotation >> 45) & 3u;
+        result[4] = static_cast<uint32_t>(rotation >> 30) & 0x7fffu;
+        result[5] = static_cast<uint32_t>(rotation >> 15) & 0x7fffu;
+        result[6] = static_cast<uint32_t>(rotation) & 0x7fffu;
+    }
+
+    /**
+     * State from the integers of channels. Bits that are out of range for a channel are ignored.
+     * @param channels Input of channel_count integers.
+     * @return Result.
+     */
+    static constexpr State from_channels(const uint32_t* channels)
+    {
+        State result;
+        result.x = static_cast<int32_t>(channels[0]);
+        result.y = static_cast<int32_t>(channels[1]);
+        result.z = static_cast<int32_t>(channels[2]);
+        result.rotation = (static_cast<uint64_t>(channels[3] & 3u) << 45)
+            | (static_cast<uint64_t>(channels[4] & 0x7fffu) << 30)
+            | (static_cast<uint64_t>(channels[5] & 0x7fffu) << 15) | static_cast<uint64_t>(channels[6] & 0x7fffu);
+        return result;
+    }
+
+    /**
+     * Equality of the quantized values.
+     * @param other Other state.
+     * @return True if equal, false otherwise.
+     */
+    [[nodiscard]] constexpr bool operator==(const State& other) const
+    {
+        return x == other.x && y == other.y && z == other.z && rotation == other.rotation;
+    }
+
+    /**
+     * Inequality of the quantized values.
+     * @param other Other state.
+     * @return True if not equal, false otherwise.
+     */
+    [[nodiscard]] constexpr bool operator!=(const State& other) const
+    {
+        return !(*this == other);
+    }
+};
+
+/**
+ * Quantizes translations to a uniform grid and rotations with QuaternionPacked48. Each decoded translation component is
+ * within half of a step of the original as long as it is within 2^31 steps of the origin, and the rotation error is
+ * that of QuaternionPacked48.
+ */
+class Codec {
+public:
+    /**
+     * Grid spacing of translations.
+     */
+    float step;
+
+    /**
+     * Initialize with a grid spacing.
+     * @param step Grid spacing of translations which must be positive.
+     */
+    explicit constexpr Codec(const float step)
+        : step { step }
+    {
+    }
+
+    /**
+     * Quantize a translation and rotation.
+     * @param translation Translation.
+     * @param rotation Unit quaternion.
+     * @return Result.
+     */
+    [[nodiscard]] State quantize(const Vector3f& translation, const QuaternionF& rotation) const
+    {
+        const Vector3f steps = (translation / step + Vector3f::all(0.5f)).floor();
+        State result;
+        result.x = static_cast<int32_t>(steps.x);
+        result.y = static_cast<int32_t>(steps.y);
+        result.z = static_cast<int32_t>(steps.z);
+        result.rotation = QuaternionPacked48(rotation).bits();
+        return result;
+    }
+
+    /**
+     * Quantize a rigid transform.
+     * @param transform Transform with an orthonormal basis.
+     * @return Result.
+     */
+    [[nodiscard]] State quantize(const Transform3f& transform) const
+    {
+        return quantize(transform.translation(), QuaternionF::from_basis(transform.basis()));
+    }
+
+    /**
+     * Translation of a state.
+     * @param state State.
+     * @return Result.
+     */
+    [[nodiscard]] constexpr Vector3f translation(const State& state) const
+    {
+        return Vector3f(static_cast<float>(state.x), static_cast<float>(state.y), static_cast<float>(state.z)) * step;
+    }
+
+    /**
+     * Rotation of a state.
+     * @param state State.
+     * @return Result.
+     */
+    [[nodiscard]] static QuaternionF rotation(const State& state)
+    {
+        return QuaternionPacked48(state.rotation).decode();
+    }
+
+    /**
+     * Rigid transform of a state.
+     * @param state State.
+     * @return Result.
+     */
+    [[nodiscard]] Transform3f transform(const State& state) const
+    {
+        return Transform3f::from_basis_translation(
+            Basis3f::from_rotation_quaternion(rotation(state)), translation(state));
+    }
+
+    /**
+     * Quantize many translations and rotations.
+     * @param translations Translations.
+     * @param rotations Unit quaternions.
+     * @param count Number of translations and rotations.
+     * @param results Output of each state which must hold count elements.
+     */
+    void quantize_batch(
+        const Vector3f* translations, const QuaternionF* rotations, const size_t count, State* results) const
+    {
+        for (size_t i = 0; i < count; ++i) {
+            results[i] = quantize(translations[i], rotations[i]);
+        }
+    }
+
+    /**
+     * Quantize many rigid transforms.
+     * @param transforms Transforms with orthonormal bases.
+     * @param count Number of transforms.
+     * @param results Output of each state which must hold count elements.
+     */
+    void quantize_batch(const Transform3f* transforms, const size_t count, State* results) const
+    {
+        for (size_t i = 0; i < count; ++i) {
+            results[i] = quantize(transforms[i]);
+        }
+    }
+
+    /**
+     * Translations and rotations of many states.
+     * @param states States.
+     * @param count Number of states.
+     * @param translations Output of each translation which must hold count elements.
+     * @param rotations Output of each rotation which must hold count elements.
+     */
+    void dequantize_batch(
+        const State* states, const size_t count, Vector3f* translations, QuaternionF* rotations) const
+    {
+        for (size_t i = 0; i < count; ++i) {
+            translations[i] = translation(states[i]);
+            rotations[i] = rotation(states[i]);
+        }
+    }
+
+    /**
+     * Rigid transforms of many states.
+     * @param states States.
+     * @param count Number of states.
+     * @param results Output of each transform which must hold count elements.
+     */
+    void dequantize_batch(const State* states, const size_t count, Transform3f* results) const
+    {
+        for (size_t i = 0; i < count; ++i) {
+            results[i] = transform(states[i]);
+        }
+    }
+};
+
+/**
+ * Maps small negative and positive differences to small unsigned integers by interleaving them.
+ * @param value Value.
+ * @return Result.
+ */
+constexpr uint32_t zigzag_encode(const uint32_t value)
+{
+    return (value << 1) ^ (0u - (value >> 31));
+}
+
+/**
+ * Inverse of zigzag_encode.
+ * @param value Value.
+ * @return Result.
+ */
+constexpr uint32_t zigzag_decode(const uint32_t value)
+{
+    return (value >> 1) ^ (0u - (value & 1u));
+}
+
+/**
+ * Number of bits needed to store a value.
+ * @param value Value.
+ * @return Result from zero to 32.
+ */
+constexpr uint8_t bit_width(const uint32_t value)
+{
+    uint8_t result = 0;
+    while (result < 32 && value >> result != 0) {
+        ++result;
+    }
+    return result;
+}
+
+/**
+ * Packs values at a fixed bit width into 32-bit little-endian words. The position of every value is known at compile
+ * time so there are only constant shifts and no branches that depend on the width.
+ * @tparam Width Bit width of each value.
+ * @tparam Indices Indices of the values.
+ * @param values Input of block_size values which fit in Width bits.
+ * @param output Output of Width words.
+ */
+template <uint8_t Width, size_t... Indices>
+void pack(const uint32_t* values, uint8_t* output, std::index_sequence<Indices...>)
+{
+    // Values that straddle two words spill into the upper half of the first.
+    uint64_t words[Width + 1] {};
+    ((words[Indices * Width / 32] |= static_cast<uint64_t>(values[Indices]) << (Indices * Width % 32)), ...);
+    for (uint8_t w = 0; w < Width; ++w) {
+        const uint32_t word
+            = static_cast<uint32_t>(words[w]) | (w == 0 ? 0u : static_cast<uint32_t>(words[w - 1] >> 32));
+        for (uint8_t b = 0; b < 4; ++b) {
+            output[w * 4 + b] = static_cast<uint8_t>(word >> (b * 8));
+        }
+    }
+}
+
+/**
+ * Inverse of pack.
+ * @tparam Width Bit width of each value.
+ * @tparam Indices Indices of the values.
+ * @param input Input of Width words.
+ * @param values Output of block_size values.
+ */
+template <uint8_t Width, size_t... Indices>
+void unpack(const uint8_t* input, uint32_t* values, std::index_sequence<Indices...>)
+{
+    if constexpr (Width == 0) {
+        // Unchanged channels have no words and the word after the first value would be past the end of the buffer.
+        static_cast<void>(input);
+        ((values[Indices] = 0), ...);
+    }
+    else {
+        uint64_t words[Width + 1] {};
+        for (uint8_t w = 0; w < Width; ++w) {
+            for (uint8_t b = 0; b < 4; ++b) {
+                words[w] |= static_cast<uint64_t>(input[w * 4 + b]) << (b * 8);
+            }
+        }
+        constexpr uint64_t mask = (1ull << Width) - 1;
+        ((values[Indices] = static_cast<uint32_t>(
+              ((words[Indices * Width / 32] | words[Indices * Width / 32 + 1] << 32) >> (Indices * Width % 32))
+              & mask)),
+         ...);
+    }
+}
+
+/**
+ * Functions that pack a block indexed by bit width.
+ * @tparam Widths Bit widths from zero to 32.
+ * @return Result.
+ */
+template <size_t... Widths>
+constexpr std::array<void (*)(const uint32_t*, uint8_t*), sizeof...(Widths)> pack_functions(
+    std::index_sequence<Widths...>)
+{
+    return { [](const uint32_t* values, uint8_t* output) {
+        pack<static_cast<uint8_t>(Widths)>(values, output, std::make_index_sequence<block_size>());
+    }... };
+}
+
+/**
+ * Functions that unpack a block indexed by bit width.
+ * @tparam Widths Bit widths from zero to 32.
+ * @return Result.
+ */
+template <size_t... Widths>
+constexpr std::array<void (*)(const uint8_t*, uint32_t*), sizeof...(Widths)> unpack_functions(
+    std::index_sequence<Widths...>)
+{
+    return { [](const uint8_t* input, uint32_t* values) {
+        unpack<static_cast<uint8_t>(Widths)>(input, values, std::make_index_sequence<block_size>());
+    }... };
+}
+
+/**
+ * Delta-encode states against a baseline such as the last snapshot the receiver acknowledged. The result starts with
+ * the number of states as 32 bits. Then for each block of block_size states and each channel there is one byte with
+ * the bit width of the zigzag-encoded differences from the baseline followed by the differences of the block packed at
+ * that width, so unchanged channels only take the byte. Multi-byte values are little-endian. States past the end of the
+ * baseline are encoded against all channels being zero.
+ * @param states States.
+ * @param count Number of states.
+ * @param baseline Baseline states.
+ * @param baseline_count Number of baseline states.
+ * @param bytes Output which is replaced by the encoding.
+ */
+inline void encode_delta(
+    const State* states,
+    const size_t count,
+    const State* baseline,
+    const size_t baseline_count,
+    std::vector<uint8_t>& bytes)
+{
+    static constexpr auto packers = pack_functions(std::make_index_sequence<33>());
+    constexpr State zero = State::from_channels(std::array<uint32_t, channel_count> {}.data());
+    // Reserved for the widest encoding up front so that growing does not reallocate. Resizing to the worst case
+    // instead would spend more time filling it with zeros than encoding.
+    const size_t block_count = (count + block_size - 1) / block_size;
+    bytes.reserve(4 + block_count * channel_count * (1 + block_size * 4));
+    bytes.resize(4);
+    for (uint8_t i = 0; i < 4; ++i) {
+        bytes[i] = static_cast<uint8_t>(count >> (i * 8));
+    }
+    for (size_t block = 0; block < count; block += block_size) {
+        uint32_t deltas[channel_count][block_size] {};
+        for (size_t i = 0; i < block_size && block + i < count; ++i) {
+            uint32_t current[channel_count];
+            states[block + i].channels(current);
+            uint32_t previous[channel_count];
+            (block + i < baseline_count ? baseline[block + i] : zero).channels(previous);
+            for (uint8_t c = 0; c < channel_count; ++c) {
+                deltas[c][i] = zigzag_encode(current[c] - previous[c]);
+            }
+        }
+        uint8_t widths[channel_count];
+        size_t block_bytes = channel_count;
+        for (uint8_t c = 0; c < channel_count; ++c) {
+            uint32_t combined = 0;
+            for (size_t i = 0; i < block_size; ++i) {
+                combined |= deltas[c][i];
+            }
+            widths[c] = bit_width(combined);
+            block_bytes += static_cast<size_t>(widths[c]) * 4;
+        }
+        const size_t offset = bytes.size();
+        bytes.resize(offset + block_bytes);
+        uint8_t* output = bytes.data() + offset;
+        for (uint8_t c = 0; c < channel_count; ++c) {
+            *output++ = widths[c];
+            packers[widths[c]](deltas[c], output);
+            output += static_cast<size_t>(widths[c]) * 4;
+        }
+    }
+}
+
+/**
+ * Decode states encoded with encode_delta against the same baseline.
+ * @param bytes Encoding.
+ * @param size Number of bytes.
+ * @param baseline Baseline states.
+ * @param baseline_count Number of baseline states.
+ * @return Result or null if the encoding is truncated or malformed.
+ */
+inline std::optional<std::vector<State>> decode_delta(
+    const uint8_t* bytes, const size_t size, const State* baseline, const size_t baseline_count)
+{
+    if (size < 4) {
+        return std::nullopt;
+    }
+    size_t count = 0;
+    for (uint8_t i = 0; i < 4; ++i) {
+        count |= static_cast<size_t>(bytes[i]) << (i * 8);
+    }
+    // Every block takes at least one byte per channel which bounds the count before allocating.
+    if ((count + block_size - 1) / block_size * channel_count > size - 4) {
+        return std::nullopt;
+    }
+    static constexpr auto unpackers = unpack_functions(std::make_index_sequence<33>());
+    std::vector<State> result(count);
+    size_t offset = 4;
+    for (size_t block = 0; block < count; block += block_size) {
+        uint32_t deltas[channel_count][block_size];
+        for (uint8_t c = 0; c < channel_count; ++c) {
+            if (offset >= size) {
+                return std::nullopt;
+            }
+            const uint8_t width = bytes[offset++];
+            if (width > 32 || size - offset < static_cast<size_t>(width) * 4) {
+                return std::nullopt;
+            }
+            unpackers[width](bytes + offset, deltas[c]);
+            offset += static_cast<size_t>(width) * 4;
+            for (size_t i = 0; i < block_size; ++i) {
+                deltas[c][i] = zigzag_decode(deltas[c][i]);
+            }
+        }
+        for (size_t i = 0; i < block_size && block + i < count; ++i) {
+            uint32_t current[channel_count] {};
+            if (block + i < baseline_count) {
+                baseline[block + i].channels(current);
+            }
+            for (uint8_t c = 0; c < channel_count; ++c) {
+                current[c] += deltas[c][i];
+            }
+            result[block + i] = State::from_channels(current);
+        }
+    }
+    if (offset != size) {
+        return std::nullopt;
+    }
+    return result;
+}
+
+}
+
+#endif
@@ -0,0 +1,239 @@
+/* NNM - "No Nonsense Math"
+ * v0.5.0
+ * Copyright (c) 2025-present Matthew Oros
+ * Licensed under MIT
+ */
+
+#ifndef NNM_SPHERE3_HPP
+#define NNM_SPHERE3_HPP
+
+#include <nnm/vector3.hpp>
+
+#include <cstddef>
+
+namespace nnm {
+
+/**
+ * Three-dimensional sphere.
+ * @tparam Real Floating-point type.
+ */
+template <typename Real>
+class Sphere3 {
+public:
+    /**
+     * Center position.
+     */
+    Vector3<Real> center;
+
+    /**
+     * Radius.
+     */
+    Real radius;
+
+    /**
+     * Initialize as a sphere with zero radius at the origin.
+     */
+    constexpr Sphere3()
+        : center(Vector3<Real>::zero())
+        , radius(static_cast<Real>(0))
+    {
+    }
+
+    /**
+     * Cast from other sphere.
+     * @tparam Other Other type.
+     * @param sphere Other sphere.
+     */
+    template <typename Other>
+    explicit constexpr Sphere3(const Sphere3<Other>& sphere)
+        : center(Vector3<Real>(sphere.center))
+        , radius(static_cast<Real>(sphere.radius))
+    {
+    }
+
+    /**
+     * Initialize with center and radius.
+     * @param center Center.
+     * @param radius Radius.
+     */
+    constexpr Sphere3(const Vector3<Real>& center, const Real radius)
+        : center(center)
+        , radius(radius)
+    {
+    }
+
+    /**
+     * Sphere that bounds a set of points using Ritter's algorithm which is fast but typically a few percent larger than
+     * the smallest bounding sphere.
+     * @param points Points.
+     * @param count Number of points.
+     * @return Result which has zero radius at the origin if there are no points.
+     */
+    static Sphere3 from_points_ritter(const Vector3<Real>* points, const size_t count)
+    {
+        if (count == 0) {
+            return Sphere3();
+        }
+        const Vector3<Real>& first = farthest(points, count, points[0]);
+        const Vector3<Real>& second = farthest(points, count, first);
+        Sphere3 result { (first + second) / static_cast<Real>(2), first.distance(second) / static_cast<Real>(2) };
+        for (size_t i = 0; i < count; ++i) {
+            const Real distance_sqrd = result.center.distance_sqrd(points[i]);
+            if (distance_sqrd > sqrd(result.radius)) {
+                const Real distance = sqrt(distance_sqrd);
+                const Real radius = (result.radius + distance) / static_cast<Real>(2);
+                result.center += (points[i] - result.center) * ((radius - result.radius) / distance);
+                result.radius = radius;
+            }
+        }
+        return result;
+    }
+
+    /**
+     * Sphere that bounds a set of points and is close to the smallest bounding sphere. Starting from Ritter's sphere,
+     * the center is repeatedly moved towards the farthest point by a shrinking fraction of the distance and the
+     * smallest sphere found is returned.
+     * @param points Points.
+     * @param count Number of points.
+     * @param iterations Number of refinement passes over the points.
+     * @return Result which has zero radius at the origin if there are no points.
+     */
+    static Sphere3 from_points(const Vector3<Real>* points, const size_t count, const size_t iterations = 32)
+    {
+        Sphere3 result = from_points_ritter(points, count);
+        if (count == 0) {
+            return result;
+        }
+        Vector3<Real> center = result.center;
+        Real step = static_cast<Real>(0.1);
+        for (size_t i = 0; i < iterations; ++i) {
+            const Vector3<Real>& point = farthest(points, count, center);
+            const Real radius = center.distance(point);
+            if (radius < result.radius) {
+                result = { center, radius };
+            }
+            center += (point - center) * step;
+            step *= static_cast<Real>(0.85);
+        }
+        return result;
+    }
+
+    /**
+     * Signed distance to a point which is negative inside the sphere.
+     * @param point Point.
+     * @return Result.
+     */
+    [[nodiscard]] Real signed_distance(const Vector3<Real>& point) const
+    {
+        return center.distance(point) - radius;
+    }
+
+    /**
+     * Determines if a point is inside or on the surface of the sphere.
+     * @param point Point.
+     * @return True if contained, false otherwise.
+     */
+    [[nodiscard]] constexpr bool contains(const Vector3<Real>& point) const
+    {
+        return center.distance_sqrd(point) <= sqrd(radius);
+    }
+
+    /**
+     * Determines if another sphere is entirely inside the sphere.
+     * @param other Other sphere.
+     * @return True if contained, false otherwise.
+     */
+    [[nodiscard]] bool contains(const Sphere3& other) const
+    {
+        return center.distance(other.center) + other.radius <= radius;
+    }
+
+    /**
+     * Determines if the sphere overlaps another sphere.
+     * @param other Other sphere.
+     * @return True if overlapping, false otherwise.
+     */
+    [[nodiscard]] constexpr bool intersects(const Sphere3& other) const
+    {
+        return center.distance_sqrd(other.center) <= sqrd(radius + other.radius);
+    }
+
+    /**
+     * Determines if the sphere touches a plane.
+     * @param plane Plane with a normalized normal.
+     * @return True if touching, false otherwise.
+     */
+    [[nodiscard]] constexpr bool intersects(const Plane3<Real>& plane) const
+    {
+        return nnm::abs(plane.signed_distance(center)) <= radius;
+    }
+
+    /**
+     * Smallest sphere that contains both the sphere and another sphere.
+     * @param other Other sphere.
+     * @return Result.
+     */
+    [[nodiscard]] Sphere3 merge(const Sphere3& other) const
+    {
+        const Vector3<Real> offset = other.center - center;
+        const Real distance = offset.length();
+        if (distance + other.radius <= radius) {
+            return *this;
+        }
+        if (distance + radius <= other.radius) {
+            return other;
+        }
+        const Real merged_radius = (distance + radius + other.radius) / static_cast<Real>(2);
+        return { center + offset * ((merged_radius - radius) / distance), merged_radius };
+    }
+
+    /**
+     * Determines if approximately equal to another sphere.
+     * @param other Other sphere.
+     * @return True if approximately equal, false otherwise.
+     */
+    [[nodiscard]] constexpr bool approx_equal(const Sphere3& other) const
+    {
+        return center.approx_equal(other.center) && nnm::approx_equal(radius, other.radius);
+    }
+
+    /**
+     * Equality.
+     * @param other Other sphere.
+     * @return True if equal, false otherwise.
+     */
+    [[nodiscard]] constexpr bool operator==(const Sphere3& other) const
+    {
+        return center == other.center && radius == other.radius;
+    }
+
+    /**
+     * Inequality.
+     * @param other Other sphere.
+     * @return True if not equal, false otherwise.
+     */
+    [[nodiscard]] constexpr bool operator!=(const Sphere3& other) const
+    {
+        return center != other.center || radius != other.radius;
+    }
+
+private:
+    // Point that is the farthest from another point which must not be called with zero points.
+    static const Vector3<Real>& farthest(const Vector3<Real>* points, const size_t count, const Vector3<Real>& from)
+    {
+        size_t index = 0;
+        Real max_distance_sqrd = from.distance_sqrd(points[0]);
+        for (size_t i = 1; i < count; ++i) {
+            const Real distance_sqrd = from.distance_sqrd(points[i]);
+            if (distance_sqrd > max_distance_sqrd) {
+                index = i;
+                max_distance_sqrd = distance_sqrd;
+            }
+        }
+        return points[index];
+    }
+};
+
+}
+
+#endif
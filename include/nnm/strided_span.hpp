@@ -0,0 +1,182 @@
+/* NNM - "No Nonsense Math"
+ * v0.5.0
+ * Copyright (c) 2025-present Matthew Oros
+ * Licensed under MIT
+ */
+
+#ifndef NNM_STRIDED_SPAN_HPP
+#define NNM_STRIDED_SPAN_HPP
+
+#include <nnm/fwd.hpp>
+#include <nnm/scalar.hpp>
+
+#include <cstddef>
+#include <cstring>
+#include <type_traits>
+
+namespace nnm {
+
+/**
+ * Read-only view of elements that are a fixed number of bytes apart in a buffer that is not owned such as an
+ * interleaved vertex buffer or a memory-mapped file. Elements are copied out with memcpy rather than read through a
+ * pointer to the element type so that the buffer may hold any type without breaking strict aliasing, and compilers
+ * turn each copy into plain loads.
+ * @tparam Value Trivially copyable element type.
+ */
+template <typename Value>
+class StridedSpan<const Value> {
+public:
+    static_assert(std::is_trivially_copyable_v<Value>, "StridedSpan elements must be trivially copyable");
+
+    /**
+     * First byte of the first element.
+     */
+    const std::byte* data;
+
+    /**
+     * Number of elements.
+     */
+    size_t count;
+
+    /**
+     * Number of bytes from the start of one element to the start of the next.
+     */
+    size_t stride;
+
+    /**
+     * Initializes to an empty view.
+     */
+    constexpr StridedSpan()
+        : data { nullptr }
+        , count { 0 }
+        , stride { sizeof(Value) }
+    {
+    }
+
+    /**
+     * Initialize over a buffer of any type such as float or std::byte.
+     * @param buffer Start of the buffer.
+     * @param count Number of elements.
+     * @param stride Number of bytes from the start of one element to the start of the next.
+     * @param offset Number of bytes from the start of the buffer to the first element.
+     */
+    StridedSpan(const void* buffer, const size_t count, const size_t stride, const size_t offset = 0)
+        : data { static_cast<const std::byte*>(buffer) + offset }
+        , count { count }
+        , stride { stride }
+    {
+    }
+
+    /**
+     * Initialize over a contiguous array of elements.
+     * @param values Elements.
+     * @param count Number of elements.
+     */
+    StridedSpan(const Value* values, const size_t count)
+        : StridedSpan(static_cast<const void*>(values), count, sizeof(Value))
+    {
+    }
+
+    /**
+     * Copy of an element.
+     * @param index Index of the element.
+     * @return Result.
+     */
+    [[nodiscard]] Value load(const size_t index) const
+    {
+        NNM_BOUNDS_CHECK_ASSERT("StridedSpan", index < count);
+        Value result;
+        std::memcpy(static_cast<void*>(&result), data + index * stride, sizeof(Value));
+        return result;
+    }
+
+    /**
+     * Copy of an element.
+     * @param index Index of the element.
+     * @return Result.
+     */
+    [[nodiscard]] Value operator[](const size_t index) const
+    {
+        return load(index);
+    }
+
+    /**
+     * View of a range of the elements.
+     * @param offset Index of the first element.
+     * @param count Number of elements.
+     * @return Result.
+     */
+    [[nodiscard]] StridedSpan subspan(const size_t offset, const size_t count) const
+    {
+        NNM_BOUNDS_CHECK_ASSERT("StridedSpan", offset <= this->count && count <= this->count - offset);
+        StridedSpan result = *this;
+        result.data += offset * stride;
+        result.count = count;
+        return result;
+    }
+};
+
+/**
+ * Writable view of elements that are a fixed number of bytes apart in a buffer that is not owned. It derives from the
+ * read-only view so that it can be passed wherever the read-only view is expected, including to function templates.
+ * @tparam Value Trivially copyable element type.
+ */
+template <typename Value>
+class StridedSpan : public StridedSpan<const Value> {
+public:
+    /**
+     * Initializes to an empty view.
+     */
+    constexpr StridedSpan() = default;
+
+    /**
+     * Initialize over a buffer of any type such as float or std::byte.
+     * @param buffer Start of the buffer.
+     * @param count Number of elements.
+     * @param stride Number of bytes from the start of one element to the start of the next.
+     * @param offset Number of bytes from the start of the buffer to the first element.
+     */
+    StridedSpan(void* buffer, const size_t count, const size_t stride, const size_t offset = 0)
+        : StridedSpan<const Value>(buffer, count, stride, offset)
+    {
+    }
+
+    /**
+     * Initialize over a contiguous array of elements.
+     * @param values Elements.
+     * @param count Number of elements.
+     */
+    StridedSpan(Value* values, const size_t count)
+        : StridedSpan<const Value>(values, count)
+    {
+    }
+
+    /**
+     * Overwrite an element.
+     * @param index Index of the element.
+     * @param value Value.
+     */
+    void store(const size_t index, const Value& value) const
+    {
+        NNM_BOUNDS_CHECK_ASSERT("StridedSpan", index < this->count);
+        // The buffer was writable when the view was created.
+        std::memcpy(const_cast<std::byte*>(this->data) + index * this->stride, &value, sizeof(Value));
+    }
+
+    /**
+     * View of a range of the elements.
+     * @param offset Index of the first element.
+     * @param count Number of elements.
+     * @return Result.
+     */
+    [[nodiscard]] StridedSpan subspan(const size_t offset, const size_t count) const
+    {
+        StridedSpan result;
+        static_cast<StridedSpan<const Value>&>(result) = StridedSpan<const Value>::subspan(offset, count);
+        return result;
+    }
+};
+
+}
+
+#endif
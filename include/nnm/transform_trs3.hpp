@@ -0,0 +1,345 @@
+/* NNM - "No Nonsense Math"
+ * v0.5.0
+ * Copyright (c) 2025-present Matthew Oros
+ * Licensed under MIT
+ */
+
+#ifndef NNM_TRANSFORM_TRS3_HPP
+#define NNM_TRANSFORM_TRS3_HPP
+
+#include <nnm/transform3.hpp>
+
+#include <optional>
+
+namespace nnm {
+
+/**
+ * Three-dimensional transform stored as separate translation, rotation, and scale components. This is more compact
+ * than a 4x4 transformation matrix and composes with quaternion multiplication. Scale is applied first, then rotation,
+ * then translation. Composition and inversion are exact for uniform scale, and for non-uniform scale the shear that
+ * would result is discarded.
+ * @tparam Real Floating-point type.
+ */
+template <typename Real>
+class TransformTRS3 {
+public:
+    /**
+     * Translation.
+     */
+    Vector3<Real> translation;
+
+    /**
+     * Rotation which is expected to be normalized.
+     */
+    Quaternion<Real> rotation;
+
+    /**
+     * Per-axis scale.
+     */
+    Vector3<Real> scale;
+
+    /**
+     * Initialize with identity.
+     */
+    constexpr TransformTRS3()
+        : translation(Vector3<Real>::zero())
+        , rotation(Quaternion<Real>::identity())
+        , scale(Vector3<Real>::one())
+    {
+    }
+
+    /**
+     * Cast from other transform.
+     * @tparam Other Other type.
+     * @param transform Other transform.
+     */
+    template <typename Other>
+    explicit constexpr TransformTRS3(const TransformTRS3<Other>& transform)
+        : translation(Vector3<Real>(transform.translation))
+        , rotation(Quaternion<Real>(transform.rotation))
+        , scale(Vector3<Real>(transform.scale))
+    {
+    }
+
+    /**
+     * Initialize with components. No normalization is done.
+     * @param translation Translation.
+     * @param rotation Normalized rotation.
+     * @param scale Per-axis scale.
+     */
+    constexpr TransformTRS3(
+        const Vector3<Real>& translation, const Quaternion<Real>& rotation, const Vector3<Real>& scale)
+        : translation(translation)
+        , rotation(rotation)
+        , scale(scale)
+    {
+    }
+
+    /**
+     * Transform with a translation.
+     * @param translation 3D translation vector.
+     * @return Result.
+     */
+    static constexpr TransformTRS3 from_translation(const Vector3<Real>& translation)
+    {
+        return { translation, Quaternion<Real>::identity(), Vector3<Real>::one() };
+    }
+
+    /**
+     * Transform rotated about a normalized axis and angle.
+     * @param axis Normalized 3D axis vector.
+     * @param angle Angle in radians.
+     * @return Result.
+     */
+    static TransformTRS3 from_rotation_axis_angle(const Vector3<Real>& axis, const Real angle)
+    {
+        return from_rotation_quaternion(Quaternion<Real>::from_axis_angle(axis, angle));
+    }
+
+    /**
+     * Transform rotated by quaternion.
+     * @param quaternion Normalized quaternion.
+     * @return Result.
+     */
+    static constexpr TransformTRS3 from_rotation_quaternion(const Quaternion<Real>& quaternion)
+    {
+        return { Vector3<Real>::zero(), quaternion, Vector3<Real>::one() };
+    }
+
+    /**
+     * Transform scaled by per-axis factor.
+     * @param factor Scale factor vector.
+     * @return Result.
+     */
+    static constexpr TransformTRS3 from_scale(const Vector3<Real>& factor)
+    {
+        return { Vector3<Real>::zero(), Quaternion<Real>::identity(), factor };
+    }
+
+    /**
+     * Determines if the scale is the same along all axes in which case composition and inversion are exact.
+     * @return True if uniform, false otherwise.
+     */
+    [[nodiscard]] constexpr bool uniform_scale() const
+    {
+        return scale.x == scale.y && scale.y == scale.z;
+    }
+
+    /**
+     * Determines if the transform is valid which is when no scale component is zero.
+     * @return True if valid, false otherwise.
+     */
+    [[nodiscard]] constexpr bool valid() const
+    {
+        return scale.x != static_cast<Real>(0) && scale.y != static_cast<Real>(0)
+            && scale.z != static_cast<Real>(0);
+    }
+
+    /**
+     * Inverse without checking if the transform is valid first. Exact for uniform scale.
+     * @return Result.
+     */
+    [[nodiscard]] constexpr TransformTRS3 unchecked_inverse() const
+    {
+        const Quaternion<Real> inverse_rotation = rotation.inverse();
+        const Vector3<Real> inverse_scale = scale.inverse();
+        const Vector3<Real> inverse_translation = -(inverse_scale * translation.rotate_quaternion(inverse_rotation));
+        return { inverse_translation, inverse_rotation, inverse_scale };
+    }
+
+    /**
+     * Inverse of the transform. Exact for uniform scale.
+     * @return Inverse transform if the transform is valid or null otherwise.
+     */
+    [[nodiscard]] constexpr std::optional<TransformTRS3> inverse() const
+    {
+        if (valid()) {
+            return unchecked_inverse();
+        }
+        return std::nullopt;
+    }
+
+    /**
+     * Translation.
+     * @param offset Offset vector.
+     * @return Result.
+     */
+    [[nodiscard]] constexpr TransformTRS3 translate(const Vector3<Real>& offset) const
+    {
+        return { translation + offset, rotation, scale };
+    }
+
+    /**
+     * Local translation.
+     * @param offset Offset vector.
+     * @return Result.
+     */
+    [[nodiscard]] constexpr TransformTRS3 translate_local(const Vector3<Real>& offset) const
+    {
+        return transform_local(from_translation(offset));
+    }
+
+    /**
+     * Rotation about an axis by an angle.
+     * @param axis Normalized 3D vector axis.
+     * @param angle Angle in radians.
+     * @return Result.
+     */
+    [[nodiscard]] TransformTRS3 rotate_axis_angle(const Vector3<Real>& axis, const Real angle) const
+    {
+        return rotate_quaternion(Quaternion<Real>::from_axis_angle(axis, angle));
+    }
+
+    /**
+     * Local rotation about an axis by an angle.
+     * @param axis Normalized 3D vector axis.
+     * @param angle Angle in radians.
+     * @return Result.
+     */
+    [[nodiscard]] TransformTRS3 rotate_axis_angle_local(const Vector3<Real>& axis, const Real angle) const
+    {
+        return rotate_quaternion_local(Quaternion<Real>::from_axis_angle(axis, angle));
+    }
+
+    /**
+     * Rotation by quaternion.
+     * @param quaternion Normalized quaternion.
+     * @return Result.
+     */
+    [[nodiscard]] constexpr TransformTRS3 rotate_quaternion(const Quaternion<Real>& quaternion) const
+    {
+        return { translation.rotate_quaternion(quaternion), quaternion * rotation, scale };
+    }
+
+    /**
+     * Local rotation by quaternion. Exact for uniform scale.
+     * @param quaternion Normalized quaternion.
+     * @return Result.
+     */
+    [[nodiscard]] constexpr TransformTRS3 rotate_quaternion_local(const Quaternion<Real>& quaternion) const
+    {
+        return transform_local(from_rotation_quaternion(quaternion));
+    }
+
+    /**
+     * Local per-axis scale by factor.
+     * @param factor 3D scale factor vector.
+     * @return Result.
+     */
+    [[nodiscard]] constexpr TransformTRS3 scale_local(const Vector3<Real>& factor) const
+    {
+        return { translation, rotation, scale * factor };
+    }
+
+    /**
+     * Transform by another transform which applies this transform first and then the other. Exact for uniform scale.
+     * @param by Other transform.
+     * @return Result.
+     */
+    [[nodiscard]] constexpr TransformTRS3 transform(const TransformTRS3& by) const
+    {
+        return { by.transform_point(translation), by.rotation * rotation, by.scale * scale };
+    }
+
+    /**
+     * Local transform by another transform which applies the other transform first and then this one. Exact for
+     * uniform scale.
+     * @param by Other transform.
+     * @return Result.
+     */
+    [[nodiscard]] constexpr TransformTRS3 transform_local(const TransformTRS3& by) const
+    {
+        return by.transform(*this);
+    }
+
+    /**
+     * Transform a position which is affected by scale, rotation, and translation.
+     * @param point Position to transform.
+     * @return Result.
+     */
+    [[nodiscard]] constexpr Vector3<Real> transform_point(const Vector3<Real>& point) const
+    {
+        return (point * scale).rotate_quaternion(rotation) + translation;
+    }
+
+    /**
+     * Transform a direction which is affected by scale and rotation but not translation.
+     * @param direction Direction to transform.
+     * @return Result.
+     */
+    [[nodiscard]] constexpr Vector3<Real> transform_direction(const Vector3<Real>& direction) const
+    {
+        return (direction * scale).rotate_quaternion(rotation);
+    }
+
+    /**
+     * Interpolate from this transform to another where translation and scale are linearly interpolated and rotation is
+     * spherically interpolated.
+     * @param to Transform to interpolate to.
+     * @param weight Interpolation weight typically from zero to one.
+     * @return Result.
+     */
+    [[nodiscard]] TransformTRS3 interpolate(const TransformTRS3& to, const Real weight) const
+    {
+        return { translation.lerp(to.translation, weight),
+                 rotation.slerp(to.rotation, weight),
+                 scale.lerp(to.scale, weight) };
+    }
+
+    /**
+     * Basis of the transform which is the rotation and scale.
+     * @return Result.
+     */
+    [[nodiscard]] constexpr Basis3<Real> basis() const
+    {
+        Basis3<Real> result = Basis3<Real>::from_rotation_quaternion(rotation);
+        result.at(0) *= scale.x;
+        result.at(1) *= scale.y;
+        result.at(2) *= scale.z;
+        return result;
+    }
+
+    /**
+     * Equivalent 4x4 transformation matrix.
+     * @return Result.
+     */
+    [[nodiscard]] constexpr Transform3<Real> transform3() const
+    {
+        return Transform3<Real>::from_basis_translation(basis(), translation);
+    }
+
+    /**
+     * Determines if approximately equal to another transform.
+     * @param other Other transform.
+     * @return True if all components are approximately equal, false otherwise.
+     */
+    [[nodiscard]] constexpr bool approx_equal(const TransformTRS3& other) const
+    {
+        return translation.approx_equal(other.translation) && rotation.approx_equal(other.rotation)
+            && scale.approx_equal(other.scale);
+    }
+
+    /**
+     * Component-wise equality.
+     * @param other Other transform.
+     * @return True if all components are equal, false otherwise.
+     */
+    [[nodiscard]] constexpr bool operator==(const TransformTRS3& other) const
+    {
+        return translation == other.translation && rotation == other.rotation && scale == other.scale;
+    }
+
+    /**
+     * Component-wise inequality.
+     * @param other Other transform.
+     * @return True if any component is not equal, false otherwise.
+     */
+    [[nodiscard]] constexpr bool operator!=(const TransformTRS3& other) const
+    {
+        return translation != other.translation || rotation != other.rotation || scale != other.scale;
+    }
+};
+
+}
+
+#endif
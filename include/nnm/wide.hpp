@@ -0,0 +1,1280 @@
+/* NNM - "No Nonsense Math"
+ * v0.5.0
+ * Copyright (c) 2025-present Matthew Oros
+ * Licensed under MIT
+ */
+
+#ifndef NNM_WIDE_HPP
+#define NNM_WIDE_HPP
+
+#include <nnm/matrix4.hpp>
+#include <nnm/quaternion.hpp>
+#include <nnm/vector3.hpp>
+#include <nnm/vector4.hpp>
+
+#include <cstdint>
+
+namespace nnm {
+
+/**
+ * Fixed number of boolean lanes produced by comparing wide types and consumed by select.
+ * @tparam Size Number of lanes.
+ */
+template <uint8_t Size>
+class Maskx {
+public:
+    /**
+     * Value of each lane.
+     */
+    bool lanes[Size];
+
+    /**
+     * Initialize with all lanes false.
+     */
+    constexpr Maskx()
+        : lanes {}
+    {
+    }
+
+    /**
+     * Initialize with all lanes set to the same value.
+     * @param value Value.
+     */
+    constexpr Maskx(const bool value) // NOLINT(*-explicit-constructor)
+        : lanes {}
+    {
+        for (uint8_t i = 0; i < Size; ++i) {
+            lanes[i] = value;
+        }
+    }
+
+    /**
+     * Determines if any lane is true.
+     * @return True if any lane is true, false otherwise.
+     */
+    [[nodiscard]] constexpr bool any() const
+    {
+        bool result = false;
+        for (uint8_t i = 0; i < Size; ++i) {
+            result |= lanes[i];
+        }
+        return result;
+    }
+
+    /**
+     * Determines if all lanes are true.
+     * @return True if all lanes are true, false otherwise.
+     */
+    [[nodiscard]] constexpr bool all() const
+    {
+        bool result = true;
+        for (uint8_t i = 0; i < Size; ++i) {
+            result &= lanes[i];
+        }
+        return result;
+    }
+
+    /**
+     * Determines if no lane is true.
+     * @return True if no lane is true, false otherwise.
+     */
+    [[nodiscard]] constexpr bool none() const
+    {
+        return !any();
+    }
+
+    /**
+     * Constant reference to lane at index.
+     * @param index Index.
+     * @return Constant reference.
+     */
+    [[nodiscard]] constexpr const bool& at(const uint8_t index) const
+    {
+        NNM_BOUNDS_CHECK_ASSERT("Maskx", index < Size);
+        return lanes[index];
+    }
+
+    /**
+     * Reference to lane at index.
+     * @param index Index.
+     * @return Reference.
+     */
+    constexpr bool& at(const uint8_t index)
+    {
+        NNM_BOUNDS_CHECK_ASSERT("Maskx", index < Size);
+        return lanes[index];
+    }
+
+    /**
+     * Lane-wise and.
+     * @param other Other mask.
+     * @return Result.
+     */
+    [[nodiscard]] constexpr Maskx operator&(const Maskx& other) const
+    {
+        Maskx result;
+        for (uint8_t i = 0; i < Size; ++i) {
+            result.lanes[i] = lanes[i] & other.lanes[i];
+        }
+        return result;
+    }
+
+    /**
+     * Lane-wise or.
+     * @param other Other mask.
+     * @return Result.
+     */
+    [[nodiscard]] constexpr Maskx operator|(const Maskx& other) const
+    {
+        Maskx result;
+        for (uint8_t i = 0; i < Size; ++i) {
+            result.lanes[i] = lanes[i] | other.lanes[i];
+        }
+        return result;
+    }
+
+    /**
+     * Lane-wise not.
+     * @return Result.
+     */
+    [[nodiscard]] constexpr Maskx operator!() const
+    {
+        Maskx result;
+        for (uint8_t i = 0; i < Size; ++i) {
+            result.lanes[i] = !lanes[i];
+        }
+        return result;
+    }
+};
+
+/**
+ * Fixed number of lanes of a scalar with the same operations as a single scalar. Each operation is a plain loop over
+ * the lanes that the compiler may vectorize. Arithmetic usually is, but sqrt and select often stay scalar since
+ * std::sqrt sets errno and select can compile to branches.
+ * @tparam Real Floating-point type.
+ * @tparam Size Number of lanes which is typically the SIMD width such as 4, 8, or 16.
+ */
+template <typename Real, uint8_t Size>
+class Scalarx {
+public:
+    /**
+     * Value of each lane.
+     */
+    Real lanes[Size];
+
+    /**
+     * Initialize with all lanes zero.
+     */
+    constexpr Scalarx()
+        : lanes {}
+    {
+    }
+
+    /**
+     * Initialize with all lanes set to the same value.
+     * @param value Value.
+     */
+    constexpr Scalarx(const Real value) // NOLINT(*-explicit-constructor)
+        : lanes {}
+    {
+        for (uint8_t i = 0; i < Size; ++i) {
+            lanes[i] = value;
+        }
+    }
+
+    /**
+     * Load from an array.
+     * @param values Values which must hold Size elements.
+     * @return Result.
+     */
+    static constexpr Scalarx load(const Real* values)
+    {
+        Scalarx result;
+        for (uint8_t i = 0; i < Size; ++i) {
+            result.lanes[i] = values[i];
+        }
+        return result;
+    }
+
+    /**
+     * Choose each lane from one of two values.
+     * @param mask Mask.
+     * @param if_true Value for lanes where the mask is true.
+     * @param if_false Value for lanes where the mask is false.
+     * @return Result.
+     */
+    static constexpr Scalarx select(const Maskx<Size>& mask, const Scalarx& if_true, const Scalarx& if_false)
+    {
+        Scalarx result;
+        for (uint8_t i = 0; i < Size; ++i) {
+            result.lanes[i] = mask.lanes[i] ? if_true.lanes[i] : if_false.lanes[i];
+        }
+        return result;
+    }
+
+    /**
+     * Store to an array.
+     * @param values Values which must hold Size elements.
+     */
+    constexpr void store(Real* values) const
+    {
+        for (uint8_t i = 0; i < Size; ++i) {
+            values[i] = lanes[i];
+        }
+    }
+
+    /**
+     * Absolute value of each lane.
+     * @return Result.
+     */
+    [[nodiscard]] constexpr Scalarx abs() const
+    {
+        Scalarx result;
+        for (uint8_t i = 0; i < Size; ++i) {
+            result.lanes[i] = nnm::abs(lanes[i]);
+        }
+        return result;
+    }
+
+    /**
+     * Square root of each lane.
+     * @return Result.
+     */
+    [[nodiscard]] Scalarx sqrt() const
+    {
+        Scalarx result;
+        for (uint8_t i = 0; i < Size; ++i) {
+            result.lanes[i] = nnm::sqrt(lanes[i]);
+        }
+        return result;
+    }
+
+    /**
+     * Lane-wise minimum.
+     * @param other Other value.
+     * @return Result.
+     */
+    [[nodiscard]] constexpr Scalarx min(const Scalarx& other) const
+    {
+        Scalarx result;
+        for (uint8_t i = 0; i < Size; ++i) {
+            result.lanes[i] = nnm::min(lanes[i], other.lanes[i]);
+        }
+        return result;
+    }
+
+    /**
+     * Lane-wise maximum.
+     * @param other Other value.
+     * @return Result.
+     */
+    [[nodiscard]] constexpr Scalarx max(const Scalarx& other) const
+    {
+        Scalarx result;
+        for (uint8_t i = 0; i < Size; ++i) {
+            result.lanes[i] = nnm::max(lanes[i], other.lanes[i]);
+        }
+        return result;
+    }
+
+    /**
+     * Linear interpolation of each lane.
+     * @param to Value to interpolate to.
+     * @param weight Interpolation weight which typically ranges from zero to one.
+     * @return Result.
+     */
+    [[nodiscard]] constexpr Scalarx lerp(const Scalarx& to, const Scalarx& weight) const
+    {
+        return *this + weight * (to - *this);
+    }
+
+    /**
+     * Constant reference to lane at index.
+     * @param index Index.
+     * @return Constant reference.
+     */
+    [[nodiscard]] constexpr const Real& at(const uint8_t index) const
+    {
+        NNM_BOUNDS_CHECK_ASSERT("Scalarx", index < Size);
+        return lanes[index];
+    }
+
+    /**
+     * Reference to lane at index.
+     * @param index Index.
+     * @return Reference.
+     */
+    constexpr Real& at(const uint8_t index)
+    {
+        NNM_BOUNDS_CHECK_ASSERT("Scalarx", index < Size);
+        return lanes[index];
+    }
+
+    /**
+     * Lane-wise addition.
+     * @param other Other value.
+     * @return Result.
+     */
+    [[nodiscard]] constexpr Scalarx operator+(const Scalarx& other) const
+    {
+        Scalarx result;
+        for (uint8_t i = 0; i < Size; ++i) {
+            result.lanes[i] = lanes[i] + other.lanes[i];
+        }
+        return result;
+    }
+
+    /**
+     * Lane-wise subtraction.
+     * @param other Other value.
+     * @return Result.
+     */
+    [[nodiscard]] constexpr Scalarx operator-(const Scalarx& other) const
+    {
+        Scalarx result;
+        for (uint8_t i = 0; i < Size; ++i) {
+            result.lanes[i] = lanes[i] - other.lanes[i];
+        }
+        return result;
+    }
+
+    /**
+     * Lane-wise multiplication.
+     * @param other Other value.
+     * @return Result.
+     */
+    [[nodiscard]] constexpr Scalarx operator*(const Scalarx& other) const
+    {
+        Scalarx result;
+        for (uint8_t i = 0; i < Size; ++i) {
+            result.lanes[i] = lanes[i] * other.lanes[i];
+        }
+        return result;
+    }
+
+    /**
+     * Lane-wise division.
+     * @param other Other value.
+     * @return Result.
+     */
+    [[nodiscard]] constexpr Scalarx operator/(const Scalarx& other) const
+    {
+        Scalarx result;
+        for (uint8_t i = 0; i < Size; ++i) {
+            result.lanes[i] = lanes[i] / other.lanes[i];
+        }
+        return result;
+    }
+
+    /**
+     * Lane-wise negation.
+     * @return Result.
+     */
+    [[nodiscard]] constexpr Scalarx operator-() const
+    {
+        Scalarx result;
+        for (uint8_t i = 0; i < Size; ++i) {
+            result.lanes[i] = -lanes[i];
+        }
+        return result;
+    }
+
+    /**
+     * Lane-wise less than.
+     * @param other Other value.
+     * @return Result.
+     */
+    [[nodiscard]] constexpr Maskx<Size> operator<(const Scalarx& other) const
+    {
+        Maskx<Size> result;
+        for (uint8_t i = 0; i < Size; ++i) {
+            result.lanes[i] = lanes[i] < other.lanes[i];
+        }
+        return result;
+    }
+
+    /**
+     * Lane-wise less than or equal.
+     * @param other Other value.
+     * @return Result.
+     */
+    [[nodiscard]] constexpr Maskx<Size> operator<=(const Scalarx& other) const
+    {
+        Maskx<Size> result;
+        for (uint8_t i = 0; i < Size; ++i) {
+            result.lanes[i] = lanes[i] <= other.lanes[i];
+        }
+        return result;
+    }
+
+    /**
+     * Lane-wise greater than.
+     * @param other Other value.
+     * @return Result.
+     */
+    [[nodiscard]] constexpr Maskx<Size> operator>(const Scalarx& other) const
+    {
+        return other < *this;
+    }
+
+    /**
+     * Lane-wise greater than or equal.
+     * @param other Other value.
+     * @return Result.
+     */
+    [[nodiscard]] constexpr Maskx<Size> operator>=(const Scalarx& other) const
+    {
+        return other <= *this;
+    }
+
+    /**
+     * Lane-wise equality.
+     * @param other Other value.
+     * @return Result.
+     */
+    [[nodiscard]] constexpr Maskx<Size> operator==(const Scalarx& other) const
+    {
+        Maskx<Size> result;
+        for (uint8_t i = 0; i < Size; ++i) {
+            result.lanes[i] = lanes[i] == other.lanes[i];
+        }
+        return result;
+    }
+
+    /**
+     * Lane-wise inequality.
+     * @param other Other value.
+     * @return Result.
+     */
+    [[nodiscard]] constexpr Maskx<Size> operator!=(const Scalarx& other) const
+    {
+        return !(*this == other);
+    }
+};
+
+/**
+ * Fixed number of lanes of three-dimensional vectors stored as one Scalarx per component. Provides the same methods
+ * as Vector3 so that loops over vectors can be ported by changing the type.
+ * @tparam Real Floating-point type.
+ * @tparam Size Number of lanes which is typically the SIMD width such as 4, 8, or 16.
+ */
+template <typename Real, uint8_t Size>
+class Vector3x {
+public:
+    Scalarx<Real, Size> x;
+    Scalarx<Real, Size> y;
+    Scalarx<Real, Size> z;
+
+    /**
+     * Initialize with all lanes zero.
+     */
+    constexpr Vector3x() = default;
+
+    /**
+     * Initialize with all lanes set to the same vector.
+     * @param vector Vector.
+     */
+    explicit constexpr Vector3x(const Vector3<Real>& vector)
+        : x(vector.x)
+        , y(vector.y)
+        , z(vector.z)
+    {
+    }
+
+    /**
+     * Initialize with components.
+     * @param x X components.
+     * @param y Y components.
+     * @param z Z components.
+     */
+    constexpr Vector3x(const Scalarx<Real, Size>& x, const Scalarx<Real, Size>& y, const Scalarx<Real, Size>& z)
+        : x(x)
+        , y(y)
+        , z(z)
+    {
+    }
+
+    /**
+     * Load from an array of vectors.
+     * @param vectors Vectors which must hold Size elements.
+     * @return Result.
+     */
+    static constexpr Vector3x load(const Vector3<Real>* vectors)
+    {
+        Vector3x result;
+        for (uint8_t i = 0; i < Size; ++i) {
+            result.set(i, vectors[i]);
+        }
+        return result;
+    }
+
+    /**
+     * Choose each lane from one of two vectors.
+     * @param mask Mask.
+     * @param if_true Vector for lanes where the mask is true.
+     * @param if_false Vector for lanes where the mask is false.
+     * @return Result.
+     */
+    static constexpr Vector3x select(const Maskx<Size>& mask, const Vector3x& if_true, const Vector3x& if_false)
+    {
+        return { Scalarx<Real, Size>::select(mask, if_true.x, if_false.x),
+                 Scalarx<Real, Size>::select(mask, if_true.y, if_false.y),
+                 Scalarx<Real, Size>::select(mask, if_true.z, if_false.z) };
+    }
+
+    /**
+     * Store to an array of vectors.
+     * @param vectors Vectors which must hold Size elements.
+     */
+    constexpr void store(Vector3<Real>* vectors) const
+    {
+        for (uint8_t i = 0; i < Size; ++i) {
+            vectors[i] = at(i);
+        }
+    }
+
+    /**
+     * Vector at a lane.
+     * @param index Lane index.
+     * @return Result.
+     */
+    [[nodiscard]] constexpr Vector3<Real> at(const uint8_t index) const
+    {
+        return { x.at(index), y.at(index), z.at(index) };
+    }
+
+    /**
+     * Replace the vector at a lane.
+     * @param index Lane index.
+     * @param vector Vector.
+     */
+    constexpr void set(const uint8_t index, const Vector3<Real>& vector)
+    {
+        x.at(index) = vector.x;
+        y.at(index) = vector.y;
+        z.at(index) = vector.z;
+    }
+
+    /**
+     * Squared length of each vector.
+     * @return Result.
+     */
+    [[nodiscard]] constexpr Scalarx<Real, Size> length_sqrd() const
+    {
+        return dot(*this);
+    }
+
+    /**
+     * Length of each vector.
+     * @return Result.
+     */
+    [[nodiscard]] Scalarx<Real, Size> length() const
+    {
+        return length_sqrd().sqrt();
+    }
+
+    /**
+     * Normalize each vector with zero length vectors remaining zero.
+     * @return Result.
+     */
+    [[nodiscard]] Vector3x normalize() const
+    {
+        const Scalarx<Real, Size> length = this->length();
+        const Maskx<Size> valid = length > Scalarx<Real, Size>(static_cast<Real>(0));
+        const Scalarx<Real, Size> inverse_length = Scalarx<Real, Size>::select(
+            valid, Scalarx<Real, Size>(static_cast<Real>(1)) / length, Scalarx<Real, Size>(static_cast<Real>(0)));
+        return *this * inverse_length;
+    }
+
+    /**
+     * Linear interpolation of each vector.
+     * @param to Vectors to interpolate to.
+     * @param weight Interpolation weight which typically ranges from zero to one.
+     * @return Result.
+     */
+    [[nodiscard]] constexpr Vector3x lerp(const Vector3x& to, const Scalarx<Real, Size>& weight) const
+    {
+        return { x.lerp(to.x, weight), y.lerp(to.y, weight), z.lerp(to.z, weight) };
+    }
+
+    /**
+     * Dot product of each vector.
+     * @param other Other vectors.
+     * @return Result.
+     */
+    [[nodiscard]] constexpr Scalarx<Real, Size> dot(const Vector3x& other) const
+    {
+        return x * other.x + y * other.y + z * other.z;
+    }
+
+    /**
+     * Cross product of each vector.
+     * @param other Other vectors.
+     * @return Result.
+     */
+    [[nodiscard]] constexpr Vector3x cross(const Vector3x& other) const
+    {
+        return { y * other.z - z * other.y, z * other.x - x * other.z, x * other.y - y * other.x };
+    }
+
+    /**
+     * Transform all vectors by the same transform.
+     * @param by Transform.
+     * @param w W component which is typically one for points and zero for directions.
+     * @return Result.
+     */
+    [[nodiscard]] constexpr Vector3x transform(const Transform3<Real>& by, const Real w = static_cast<Real>(1)) const
+    {
+        return Vector4x<Real, Size>(*this, w).transform(by).xyz();
+    }
+
+    /**
+     * Transform each vector by its own matrix.
+     * @param by Matrices.
+     * @param w W component which is typically one for points and zero for directions.
+     * @return Result.
+     */
+    [[nodiscard]] constexpr Vector3x transform(
+        const Matrix4x<Real, Size>& by, const Real w = static_cast<Real>(1)) const
+    {
+        return (by * Vector4x<Real, Size>(*this, w)).xyz();
+    }
+
+    /**
+     * Rotate each vector by its own quaternion.
+     * @param quaternion Quaternions.
+     * @return Result.
+     */
+    [[nodiscard]] constexpr Vector3x rotate_quaternion(const Quaternionx<Real, Size>& quaternion) const
+    {
+        const Vector3x axis { quaternion.x, quaternion.y, quaternion.z };
+        const Vector3x t = axis.cross(*this) * Scalarx<Real, Size>(static_cast<Real>(2));
+        return *this + t * quaternion.w + axis.cross(t);
+    }
+
+    /**
+     * Component-wise addition.
+     * @param other Other vectors.
+     * @return Result.
+     */
+    [[nodiscard]] constexpr Vector3x operator+(const Vector3x& other) const
+    {
+        return { x + other.x, y + other.y, z + other.z };
+    }
+
+    /**
+     * Component-wise subtraction.
+     * @param other Other vectors.
+     * @return Result.
+     */
+    [[nodiscard]] constexpr Vector3x operator-(const Vector3x& other) const
+    {
+        return { x - other.x, y - other.y, z - other.z };
+    }
+
+    /**
+     * Component-wise multiplication.
+     * @param other Other vectors.
+     * @return Result.
+     */
+    [[nodiscard]] constexpr Vector3x operator*(const Vector3x& other) const
+    {
+        return { x * other.x, y * other.y, z * other.z };
+    }
+
+    /**
+     * Multiply each vector by a value.
+     * @param value Value for each lane.
+     * @return Result.
+     */
+    [[nodiscard]] constexpr Vector3x operator*(const Scalarx<Real, Size>& value) const
+    {
+        return { x * value, y * value, z * value };
+    }
+
+    /**
+     * Divide each vector by a value.
+     * @param value Value for each lane.
+     * @return Result.
+     */
+    [[nodiscard]] constexpr Vector3x operator/(const Scalarx<Real, Size>& value) const
+    {
+        return { x / value, y / value, z / value };
+    }
+
+    /**
+     * Negation.
+     * @return Result.
+     */
+    [[nodiscard]] constexpr Vector3x operator-() const
+    {
+        return { -x, -y, -z };
+    }
+};
+
+/**
+ * Fixed number of lanes of four-dimensional vectors stored as one Scalarx per component. Provides the same methods
+ * as Vector4 so that loops over vectors can be ported by changing the type.
+ * @tparam Real Floating-point type.
+ * @tparam Size Number of lanes which is typically the SIMD width such as 4, 8, or 16.
+ */
+template <typename Real, uint8_t Size>
+class Vector4x {
+public:
+    Scalarx<Real, Size> x;
+    Scalarx<Real, Size> y;
+    Scalarx<Real, Size> z;
+    Scalarx<Real, Size> w;
+
+    /**
+     * Initialize with all lanes zero.
+     */
+    constexpr Vector4x() = default;
+
+    /**
+     * Initialize with all lanes set to the same vector.
+     * @param vector Vector.
+     */
+    explicit constexpr Vector4x(const Vector4<Real>& vector)
+        : x(vector.x)
+        , y(vector.y)
+        , z(vector.z)
+        , w(vector.w)
+    {
+    }
+
+    /**
+     * Initialize with three-dimensional vectors and a w component.
+     * @param vector Vectors.
+     * @param w W components.
+     */
+    constexpr Vector4x(const Vector3x<Real, Size>& vector, const Scalarx<Real, Size>& w)
+        : x(vector.x)
+        , y(vector.y)
+        , z(vector.z)
+        , w(w)
+    {
+    }
+
+    /**
+     * Initialize with components.
+     * @param x X components.
+     * @param y Y components.
+     * @param z Z components.
+     * @param w W components.
+     */
+    constexpr Vector4x(
+        const Scalarx<Real, Size>& x,
+        const Scalarx<Real, Size>& y,
+        const Scalarx<Real, Size>& z,
+        const Scalarx<Real, Size>& w)
+        : x(x)
+        , y(y)
+        , z(z)
+        , w(w)
+    {
+    }
+
+    /**
+     * Load from an array of vectors.
+     * @param vectors Vectors which must hold Size elements.
+     * @return Result.
+     */
+    static constexpr Vector4x load(const Vector4<Real>* vectors)
+    {
+        Vector4x result;
+        for (uint8_t i = 0; i < Size; ++i) {
+            result.set(i, vectors[i]);
+        }
+        return result;
+    }
+
+    /**
+     * Choose each lane from one of two vectors.
+     * @param mask Mask.
+     * @param if_true Vector for lanes where the mask is true.
+     * @param if_false Vector for lanes where the mask is false.
+     * @return Result.
+     */
+    static constexpr Vector4x select(const Maskx<Size>& mask, const Vector4x& if_true, const Vector4x& if_false)
+    {
+        return { Scalarx<Real, Size>::select(mask, if_true.x, if_false.x),
+                 Scalarx<Real, Size>::select(mask, if_true.y, if_false.y),
+                 Scalarx<Real, Size>::select(mask, if_true.z, if_false.z),
+                 Scalarx<Real, Size>::select(mask, if_true.w, if_false.w) };
+    }
+
+    /**
+     * Store to an array of vectors.
+     * @param vectors Vectors which must hold Size elements.
+     */
+    constexpr void store(Vector4<Real>* vectors) const
+    {
+        for (uint8_t i = 0; i < Size; ++i) {
+            vectors[i] = at(i);
+        }
+    }
+
+    /**
+     * Vector at a lane.
+     * @param index Lane index.
+     * @return Result.
+     */
+    [[nodiscard]] constexpr Vector4<Real> at(const uint8_t index) const
+    {
+        return { x.at(index), y.at(index), z.at(index), w.at(index) };
+    }
+
+    /**
+     * Replace the vector at a lane.
+     * @param index Lane index.
+     * @param vector Vector.
+     */
+    constexpr void set(const uint8_t index, const Vector4<Real>& vector)
+    {
+        x.at(index) = vector.x;
+        y.at(index) = vector.y;
+        z.at(index) = vector.z;
+        w.at(index) = vector.w;
+    }
+
+    /**
+     * X, Y, and Z components.
+     * @return Result.
+     */
+    [[nodiscard]] constexpr Vector3x<Real, Size> xyz() const
+    {
+        return { x, y, z };
+    }
+
+    /**
+     * Squared length of each vector.
+     * @return Result.
+     */
+    [[nodiscard]] constexpr Scalarx<Real, Size> length_sqrd() const
+    {
+        return dot(*this);
+    }
+
+    /**
+     * Length of each vector.
+     * @return Result.
+     */
+    [[nodiscard]] Scalarx<Real, Size> length() const
+    {
+        return length_sqrd().sqrt();
+    }
+
+    /**
+     * Normalize each vector with zero length vectors remaining zero.
+     * @return Result.
+     */
+    [[nodiscard]] Vector4x normalize() const
+    {
+        const Scalarx<Real, Size> length = this->length();
+        const Maskx<Size> valid = length > Scalarx<Real, Size>(static_cast<Real>(0));
+        const Scalarx<Real, Size> inverse_length = Scalarx<Real, Size>::select(
+            valid, Scalarx<Real, Size>(static_cast<Real>(1)) / length, Scalarx<Real, Size>(static_cast<Real>(0)));
+        return *this * inverse_length;
+    }
+
+    /**
+     * Linear interpolation of each vector.
+     * @param to Vectors to interpolate to.
+     * @param weight Interpolation weight which typically ranges from zero to one.
+     * @return Result.
+     */
+    [[nodiscard]] constexpr Vector4x lerp(const Vector4x& to, const Scalarx<Real, Size>& weight) const
+    {
+        return { x.lerp(to.x, weight), y.lerp(to.y, weight), z.lerp(to.z, weight), w.lerp(to.w, weight) };
+    }
+
+    /**
+     * Dot product of each vector.
+     * @param other Other vectors.
+     * @return Result.
+     */
+    [[nodiscard]] constexpr Scalarx<Real, Size> dot(const Vector4x& other) const
+    {
+        return x * other.x + y * other.y + z * other.z + w * other.w;
+    }
+
+    /**
+     * Transform all vectors by the same transform.
+     * @param by Transform.
+     * @return Result.
+     */
+    [[nodiscard]] constexpr Vector4x transform(const Transform3<Real>& by) const
+    {
+        const Vector4<Real>* columns = by.matrix.columns;
+        return Vector4x(columns[0]) * x + Vector4x(columns[1]) * y + Vector4x(columns[2]) * z
+            + Vector4x(columns[3]) * w;
+    }
+
+    /**
+     * Transform each vector by its own matrix.
+     * @param by Matrices.
+     * @return Result.
+     */
+    [[nodiscard]] constexpr Vector4x transform(const Matrix4x<Real, Size>& by) const
+    {
+        return by * *this;
+    }
+
+    /**
+     * Component-wise addition.
+     * @param other Other vectors.
+     * @return Result.
+     */
+    [[nodiscard]] constexpr Vector4x operator+(const Vector4x& other) const
+    {
+        return { x + other.x, y + other.y, z + other.z, w + other.w };
+    }
+
+    /**
+     * Component-wise subtraction.
+     * @param other Other vectors.
+     * @return Result.
+     */
+    [[nodiscard]] constexpr Vector4x operator-(const Vector4x& other) const
+    {
+        return { x - other.x, y - other.y, z - other.z, w - other.w };
+    }
+
+    /**
+     * Component-wise multiplication.
+     * @param other Other vectors.
+     * @return Result.
+     */
+    [[nodiscard]] constexpr Vector4x operator*(const Vector4x& other) const
+    {
+        return { x * other.x, y * other.y, z * other.z, w * other.w };
+    }
+
+    /**
+     * Multiply each vector by a value.
+     * @param value Value for each lane.
+     * @return Result.
+     */
+    [[nodiscard]] constexpr Vector4x operator*(const Scalarx<Real, Size>& value) const
+    {
+        return { x * value, y * value, z * value, w * value };
+    }
+
+    /**
+     * Divide each vector by a value.
+     * @param value Value for each lane.
+     * @return Result.
+     */
+    [[nodiscard]] constexpr Vector4x operator/(const Scalarx<Real, Size>& value) const
+    {
+        return { x / value, y / value, z / value, w / value };
+    }
+
+    /**
+     * Negation.
+     * @return Result.
+     */
+    [[nodiscard]] constexpr Vector4x operator-() const
+    {
+        return { -x, -y, -z, -w };
+    }
+};
+
+/**
+ * Fixed number of lanes of quaternions stored as one Scalarx per component.
+ * @tparam Real Floating-point type.
+ * @tparam Size Number of lanes which is typically the SIMD width such as 4, 8, or 16.
+ */
+template <typename Real, uint8_t Size>
+class Quaternionx {
+public:
+    Scalarx<Real, Size> x;
+    Scalarx<Real, Size> y;
+    Scalarx<Real, Size> z;
+    Scalarx<Real, Size> w;
+
+    /**
+     * Initialize with all lanes identity.
+     */
+    constexpr Quaternionx()
+        : w(static_cast<Real>(1))
+    {
+    }
+
+    /**
+     * Initialize with all lanes set to the same quaternion.
+     * @param quaternion Quaternion.
+     */
+    explicit constexpr Quaternionx(const Quaternion<Real>& quaternion)
+        : x(quaternion.x)
+        , y(quaternion.y)
+        , z(quaternion.z)
+        , w(quaternion.w)
+    {
+    }
+
+    /**
+     * Initialize with components.
+     * @param x X components.
+     * @param y Y components.
+     * @param z Z components.
+     * @param w W components.
+     */
+    constexpr Quaternionx(
+        const Scalarx<Real, Size>& x,
+        const Scalarx<Real, Size>& y,
+        const Scalarx<Real, Size>& z,
+        const Scalarx<Real, Size>& w)
+        : x(x)
+        , y(y)
+        , z(z)
+        , w(w)
+    {
+    }
+
+    /**
+     * Load from an array of quaternions.
+     * @param quaternions Quaternions which must hold Size elements.
+     * @return Result.
+     */
+    static constexpr Quaternionx load(const Quaternion<Real>* quaternions)
+    {
+        Quaternionx result;
+        for (uint8_t i = 0; i < Size; ++i) {
+            result.set(i, quaternions[i]);
+        }
+        return result;
+    }
+
+    /**
+     * Choose each lane from one of two quaternions.
+     * @param mask Mask.
+     * @param if_true Quaternion for lanes where the mask is true.
+     * @param if_false Quaternion for lanes where the mask is false.
+     * @return Result.
+     */
+    static constexpr Quaternionx select(
+        const Maskx<Size>& mask, const Quaternionx& if_true, const Quaternionx& if_false)
+    {
+        return { Scalarx<Real, Size>::select(mask, if_true.x, if_false.x),
+                 Scalarx<Real, Size>::select(mask, if_true.y, if_false.y),
+                 Scalarx<Real, Size>::select(mask, if_true.z, if_false.z),
+                 Scalarx<Real, Size>::select(mask, if_true.w, if_false.w) };
+    }
+
+    /**
+     * Store to an array of quaternions.
+     * @param quaternions Quaternions which must hold Size elements.
+     */
+    constexpr void store(Quaternion<Real>* quaternions) const
+    {
+        for (uint8_t i = 0; i < Size; ++i) {
+            quaternions[i] = at(i);
+        }
+    }
+
+    /**
+     * Quaternion at a lane.
+     * @param index Lane index.
+     * @return Result.
+     */
+    [[nodiscard]] constexpr Quaternion<Real> at(const uint8_t index) const
+    {
+        return { x.at(index), y.at(index), z.at(index), w.at(index) };
+    }
+
+    /**
+     * Replace the quaternion at a lane.
+     * @param index Lane index.
+     * @param quaternion Quaternion.
+     */
+    constexpr void set(const uint8_t index, const Quaternion<Real>& quaternion)
+    {
+        x.at(index) = quaternion.x;
+        y.at(index) = quaternion.y;
+        z.at(index) = quaternion.z;
+        w.at(index) = quaternion.w;
+    }
+
+    /**
+     * Normalize each quaternion.
+     * @return Result.
+     */
+    [[nodiscard]] Quaternionx normalize() const
+    {
+        const Scalarx<Real, Size> inverse_length = Scalarx<Real, Size>(static_cast<Real>(1)) / length();
+        return { x * inverse_length, y * inverse_length, z * inverse_length, w * inverse_length };
+    }
+
+    /**
+     * Inverse of each quaternion.
+     * @return Result.
+     */
+    [[nodiscard]] constexpr Quaternionx inverse() const
+    {
+        return { -x, -y, -z, w };
+    }
+
+    /**
+     * Squared length of each quaternion.
+     * @return Result.
+     */
+    [[nodiscard]] constexpr Scalarx<Real, Size> length_sqrd() const
+    {
+        return x * x + y * y + z * z + w * w;
+    }
+
+    /**
+     * Length of each quaternion.
+     * @return Result.
+     */
+    [[nodiscard]] Scalarx<Real, Size> length() const
+    {
+        return length_sqrd().sqrt();
+    }
+
+    /**
+     * Spherical linear interpolation of each quaternion.
+     * @param to Quaternions to interpolate to.
+     * @param weight Interpolation weight which typically ranges from zero to one.
+     * @return Result.
+     */
+    [[nodiscard]] Quaternionx slerp(const Quaternionx& to, const Scalarx<Real, Size>& weight) const
+    {
+        Quaternionx result;
+        for (uint8_t i = 0; i < Size; ++i) {
+            result.set(i, at(i).slerp(to.at(i), weight.at(i)));
+        }
+        return result;
+    }
+
+    /**
+     * Rotate each quaternion by another quaternion.
+     * @param by Quaternions to rotate by.
+     * @return Result.
+     */
+    [[nodiscard]] constexpr Quaternionx rotate_quaternion(const Quaternionx& by) const
+    {
+        return by * *this;
+    }
+
+    /**
+     * Quaternion multiplication of each lane.
+     * @param other Other quaternions.
+     * @return Result.
+     */
+    [[nodiscard]] constexpr Quaternionx operator*(const Quaternionx& other) const
+    {
+        return { w * other.x + x * other.w + y * other.z - z * other.y,
+                 w * other.y - x * other.z + y * other.w + z * other.x,
+                 w * other.z + x * other.y - y * other.x + z * other.w,
+                 w * other.w - x * other.x - y * other.y - z * other.z };
+    }
+};
+
+/**
+ * Fixed number of lanes of 4x4 matrices stored as one Vector4x per column.
+ * @tparam Real Floating-point type.
+ * @tparam Size Number of lanes which is typically the SIMD width such as 4, 8, or 16.
+ */
+template <typename Real, uint8_t Size>
+class Matrix4x {
+public:
+    Vector4x<Real, Size> columns[4];
+
+    /**
+     * Initialize with all lanes identity.
+     */
+    constexpr Matrix4x()
+        : Matrix4x(Matrix4<Real>())
+    {
+    }
+
+    /**
+     * Initialize with all lanes set to the same matrix.
+     * @param matrix Matrix.
+     */
+    explicit constexpr Matrix4x(const Matrix4<Real>& matrix)
+        : columns { Vector4x<Real, Size>(matrix.columns[0]),
+                    Vector4x<Real, Size>(matrix.columns[1]),
+                    Vector4x<Real, Size>(matrix.columns[2]),
+                    Vector4x<Real, Size>(matrix.columns[3]) }
+    {
+    }
+
+    /**
+     * Load from an array of matrices.
+     * @param matrices Matrices which must hold Size elements.
+     * @return Result.
+     */
+    static constexpr Matrix4x load(const Matrix4<Real>* matrices)
+    {
+        Matrix4x result;
+        for (uint8_t i = 0; i < Size; ++i) {
+            result.set(i, matrices[i]);
+        }
+        return result;
+    }
+
+    /**
+     * Store to an array of matrices.
+     * @param matrices Matrices which must hold Size elements.
+     */
+    constexpr void store(Matrix4<Real>* matrices) const
+    {
+        for (uint8_t i = 0; i < Size; ++i) {
+            matrices[i] = at(i);
+        }
+    }
+
+    /**
+     * Matrix at a lane.
+     * @param index Lane index.
+     * @return Result.
+     */
+    [[nodiscard]] constexpr Matrix4<Real> at(const uint8_t index) const
+    {
+        return { columns[0].at(index), columns[1].at(index), columns[2].at(index), columns[3].at(index) };
+    }
+
+    /**
+     * Replace the matrix at a lane.
+     * @param index Lane index.
+     * @param matrix Matrix.
+     */
+    constexpr void set(const uint8_t index, const Matrix4<Real>& matrix)
+    {
+        for (uint8_t c = 0; c < 4; ++c) {
+            columns[c].set(index, matrix.columns[c]);
+        }
+    }
+
+    /**
+     * Matrix-vector multiplication of each lane.
+     * @param vector Vectors.
+     * @return Result.
+     */
+    [[nodiscard]] constexpr Vector4x<Real, Size> operator*(const Vector4x<Real, Size>& vector) const
+    {
+        return columns[0] * vector.x + columns[1] * vector.y + columns[2] * vector.z + columns[3] * vector.w;
+    }
+
+    /**
+     * Matrix multiplication of each lane.
+     * @param other Other matrices.
+     * @return Result.
+     */
+    [[nodiscard]] constexpr Matrix4x operator*(const Matrix4x& other) const
+    {
+        Matrix4x result;
+        for (uint8_t c = 0; c < 4; ++c) {
+            result.columns[c] = *this * other.columns[c];
+        }
+        return result;
+    }
+};
+
+}
+
+#endif
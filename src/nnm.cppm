@@ -0,0 +1,26 @@
+/* NNM - "No Nonsense Math"
+ * v0.5.0
+ * Copyright (c) 2025-present Matthew Oros
+ * Licensed under MIT
+ */
+
+module;
+
+// Standard library headers are included in the global module fragment so that their include guards keep them out of
+// the exported declarations below.
+#include <atomic>
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <optional>
+#include <stdexcept>
+#include <type_traits>
+
+export module nnm;
+
+export {
+#include <nnm/nnm.hpp>
+}
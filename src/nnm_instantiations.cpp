@@ -0,0 +1,46 @@
+/* NNM - "No Nonsense Math"
+ * v0.5.0
+ * Copyright (c) 2025-present Matthew Oros
+ * Licensed under MIT
+ */
+
+#include <nnm/nnm.hpp>
+
+namespace nnm {
+
+template class Vector2<float>;
+template class Vector2<double>;
+template class Vector3<float>;
+template class Vector3<double>;
+template class Vector4<float>;
+template class Vector4<double>;
+template class Quaternion<float>;
+template class Quaternion<double>;
+template class Matrix2<float>;
+template class Matrix2<double>;
+template class Basis2<float>;
+template class Basis2<double>;
+template class Transform2<float>;
+template class Transform2<double>;
+template class Matrix3<float>;
+template class Matrix3<double>;
+template class Basis3<float>;
+template class Basis3<double>;
+template class Transform3<float>;
+template class Transform3<double>;
+template class Matrix4<float>;
+template class Matrix4<double>;
+template class TransformTRS3<float>;
+template class TransformTRS3<double>;
+template class AABB3<float>;
+template class AABB3<double>;
+template class OBB3<float>;
+template class OBB3<double>;
+template class Ray3<float>;
+template class Ray3<double>;
+template class Plane3<float>;
+template class Plane3<double>;
+template class Sphere3<float>;
+template class Sphere3<double>;
+
+}
@@ -0,0 +1,61 @@
+// The bounds check policy must be the same in every source file of a program, so the handler policy is tested by its
+// own executable.
+#define NNM_BOUNDS_CHECK_HANDLER
+#include <nnm/nnm.hpp>
+
+#include <cstdlib>
+#include <string>
+
+#include "test.hpp"
+
+struct BoundsCheckFailure {
+    std::string msg;
+};
+
+[[noreturn]] static void throw_failure(const char* msg)
+{
+    throw BoundsCheckFailure { msg };
+}
+
+int main()
+{
+    test_case("bounds_check_handler");
+    {
+        test_section("set_bounds_check_handler");
+        {
+            ASSERT(nnm::g_bounds_check_handler.load() == nullptr);
+            nnm::set_bounds_check_handler(throw_failure);
+            ASSERT(nnm::g_bounds_check_handler.load() == throw_failure);
+        }
+
+        test_section("out_of_range");
+        {
+            const nnm::Matrix4f matrix;
+            const nnm::Vector3f vector;
+            ASSERT(matrix.at(3, 3) == 1.0f && vector[2] == 0.0f);
+            std::string msg;
+            try {
+                static_cast<void>(matrix.at(4, 0));
+            }
+            catch (const BoundsCheckFailure& failure) {
+                msg = failure.msg;
+            }
+            ASSERT(msg == "Matrix4");
+            msg.clear();
+            try {
+                static_cast<void>(vector[3]);
+            }
+            catch (const BoundsCheckFailure& failure) {
+                msg = failure.msg;
+            }
+            ASSERT(msg == "Vector3");
+        }
+
+        test_section("reset");
+        {
+            nnm::set_bounds_check_handler(nullptr);
+            ASSERT(nnm::g_bounds_check_handler.load() == nullptr);
+        }
+    }
+    END_TESTS
+}
@@ -0,0 +1,13 @@
+// Checks that bounds checks compile without exceptions, where a failed check aborts instead of throwing. It is built
+// with exceptions disabled.
+#define NNM_BOUNDS_CHECK
+#include <nnm/nnm.hpp>
+
+#if defined(NNM_BOUNDS_CHECK_THROW)
+#error "Bounds checks must not throw without exceptions"
+#endif
+
+float bounds_check_no_exceptions(const nnm::Matrix4f& matrix, const nnm::Vector3f& vector, const uint8_t index)
+{
+    return matrix.at(index, index) + vector[index];
+}
@@ -0,0 +1,5 @@
+// Checks that nnm/aabb3.hpp can be used without including any other NNM header.
+#define NNM_BOUNDS_CHECK
+#include <nnm/aabb3.hpp>
+
+template class nnm::AABB3<float>;
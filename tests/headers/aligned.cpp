@@ -0,0 +1,8 @@
+// Checks that nnm/aligned.hpp can be used without including any other NNM header.
+#define NNM_BOUNDS_CHECK
+#include <nnm/aligned.hpp>
+
+template class nnm::Vector3A<float>;
+template class nnm::Vector4A<float>;
+template class nnm::Matrix4A<float>;
+template class nnm::Transform3A<float>;
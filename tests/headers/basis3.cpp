@@ -0,0 +1,5 @@
+// Checks that nnm/basis3.hpp can be used without including any other NNM header.
+#define NNM_BOUNDS_CHECK
+#include <nnm/basis3.hpp>
+
+template class nnm::Basis3<float>;
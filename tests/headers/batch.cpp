@@ -0,0 +1,8 @@
+// Checks that nnm/batch.hpp can be used without including any other NNM header.
+#define NNM_BOUNDS_CHECK
+#include <nnm/batch.hpp>
+
+void batch_header_test(const nnm::Matrix3f* matrices, const size_t count, nnm::Matrix3f::SymmetricEigen* results)
+{
+    nnm::symmetric_eigen_batch(matrices, count, results);
+}
@@ -0,0 +1,11 @@
+// Checks that nnm/compressed.hpp can be used without including any other NNM header.
+#define NNM_BOUNDS_CHECK
+#include <nnm/compressed.hpp>
+
+nnm::Vector3f compressed_header_test(const nnm::Vector3f& vector, const nnm::QuaternionF& rotation)
+{
+    return nnm::Vector3h(vector).decode() + nnm::Vector3snorm16(vector).decode()
+        + nnm::Vector4unorm8(nnm::Vector4f(vector, 1.0f)).decode().xyz() + nnm::Vector3oct16(vector).decode()
+        + nnm::Vector3f(nnm::Vector3Split(nnm::Vector3d(vector)).decode())
+        + nnm::QuaternionPacked<32>(rotation).decode().axis();
+}
@@ -0,0 +1,5 @@
+// Checks that nnm/fixed.hpp can be used without including any other NNM header.
+#define NNM_BOUNDS_CHECK
+#include <nnm/fixed.hpp>
+
+template class nnm::Fixed<16, 16>;
@@ -0,0 +1,8 @@
+// Checks that nnm/fwd.hpp can be used without including any other NNM header.
+#define NNM_BOUNDS_CHECK
+#include <nnm/fwd.hpp>
+
+const nnm::Transform3f* fwd_header_test(const nnm::Vector3f* vector)
+{
+    return vector == nullptr ? nullptr : reinterpret_cast<const nnm::Transform3f*>(vector);
+}
@@ -0,0 +1,5 @@
+// Checks that nnm/matrix2.hpp can be used without including any other NNM header.
+#define NNM_BOUNDS_CHECK
+#include <nnm/matrix2.hpp>
+
+template class nnm::Matrix2<float>;
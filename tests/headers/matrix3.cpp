@@ -0,0 +1,6 @@
+// Checks that nnm/matrix3.hpp can be used without including any other NNM header.
+#define NNM_BOUNDS_CHECK
+#include <nnm/matrix3.hpp>
+
+template class nnm::Matrix3<float>;
+template class nnm::Matrix3<double>;
@@ -0,0 +1,6 @@
+// Checks that nnm/matrix4.hpp can be used without including any other NNM header.
+#define NNM_BOUNDS_CHECK
+#include <nnm/matrix4.hpp>
+
+template class nnm::Matrix4<float>;
+template class nnm::Matrix4<double>;
@@ -0,0 +1,5 @@
+// Checks that nnm/obb3.hpp can be used without including any other NNM header.
+#define NNM_BOUNDS_CHECK
+#include <nnm/obb3.hpp>
+
+template class nnm::OBB3<float>;
@@ -0,0 +1,5 @@
+// Checks that nnm/plane3.hpp can be used without including any other NNM header.
+#define NNM_BOUNDS_CHECK
+#include <nnm/plane3.hpp>
+
+template class nnm::Plane3<float>;
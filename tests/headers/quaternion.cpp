@@ -0,0 +1,5 @@
+// Checks that nnm/quaternion.hpp can be used without including any other NNM header.
+#define NNM_BOUNDS_CHECK
+#include <nnm/quaternion.hpp>
+
+template class nnm::Quaternion<float>;
@@ -0,0 +1,15 @@
+// Checks that nnm/ray3.hpp can be used without including any other NNM header.
+#define NNM_BOUNDS_CHECK
+#include <nnm/ray3.hpp>
+
+// Members with parameters of other classes are left out since their callers include those classes.
+float ray3_header_test(const nnm::Ray3f& ray, const nnm::Vector3f& a, const nnm::Vector3f& b, const nnm::Vector3f& c)
+{
+    const nnm::Ray3f rays[8] { ray, ray, ray, ray, ray, ray, ray, ray };
+    const nnm::Ray3Packet8f packet(rays);
+    const auto hits = packet.intersect_triangle(a, b, c);
+    const auto box_hits = packet.intersect_aabb(a, b);
+    return ray.intersect_triangle(a, b, c).value_or(0.0f) + ray.intersect_triangle_watertight(a, b, c).value_or(0.0f)
+        + ray.intersect_aabb(a, b).value_or(0.0f) + ray.intersect_sphere(a, 1.0f).value_or(0.0f)
+        + ray.intersect_plane(a, 1.0f).value_or(0.0f) + static_cast<float>(sizeof(hits) + sizeof(box_hits));
+}
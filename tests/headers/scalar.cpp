@@ -0,0 +1,8 @@
+// Checks that nnm/scalar.hpp can be used without including any other NNM header.
+#define NNM_BOUNDS_CHECK
+#include <nnm/scalar.hpp>
+
+float scalar_header_test(const float value)
+{
+    return nnm::clamp(nnm::sqrd(value), 0.0f, 1.0f) + nnm::sqrt(value) + nnm::lerp(0.0f, value, 0.5f);
+}
@@ -0,0 +1,12 @@
+// Checks that nnm/sphere3.hpp can be used without including any other NNM header.
+#define NNM_BOUNDS_CHECK
+#include <nnm/sphere3.hpp>
+
+// Members with parameters of other classes are left out since their callers include those classes.
+float sphere3_header_test(const nnm::Vector3f* points, const size_t count)
+{
+    const nnm::Sphere3f sphere = nnm::Sphere3f::from_points(points, count);
+    const nnm::Sphere3f ritter = nnm::Sphere3f::from_points_ritter(points, count);
+    return sphere.signed_distance(points[0]) + static_cast<float>(sphere.contains(ritter))
+        + static_cast<float>(sphere.intersects(ritter)) + static_cast<float>(sphere.approx_equal(ritter));
+}
@@ -0,0 +1,5 @@
+// Checks that nnm/strided_span.hpp can be used without including any other NNM header.
+#define NNM_BOUNDS_CHECK
+#include <nnm/strided_span.hpp>
+
+template class nnm::StridedSpan<float>;
@@ -0,0 +1,5 @@
+// Checks that nnm/transform2.hpp can be used without including any other NNM header.
+#define NNM_BOUNDS_CHECK
+#include <nnm/transform2.hpp>
+
+template class nnm::Transform2<float>;
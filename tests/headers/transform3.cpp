@@ -0,0 +1,5 @@
+// Checks that nnm/transform3.hpp can be used without including any other NNM header.
+#define NNM_BOUNDS_CHECK
+#include <nnm/transform3.hpp>
+
+template class nnm::Transform3<float>;
@@ -0,0 +1,5 @@
+// Checks that nnm/transform_trs3.hpp can be used without including any other NNM header.
+#define NNM_BOUNDS_CHECK
+#include <nnm/transform_trs3.hpp>
+
+template class nnm::TransformTRS3<float>;
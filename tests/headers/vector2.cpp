@@ -0,0 +1,6 @@
+// Checks that nnm/vector2.hpp can be used without including any other NNM header.
+#define NNM_BOUNDS_CHECK
+#include <nnm/vector2.hpp>
+
+template class nnm::Vector2<float>;
+template class nnm::Vector2<double>;
@@ -0,0 +1,5 @@
+// Checks that nnm/vector2i.hpp can be used without including any other NNM header.
+#define NNM_BOUNDS_CHECK
+#include <nnm/vector2i.hpp>
+
+template class nnm::Vector2i<int>;
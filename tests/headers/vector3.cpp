@@ -0,0 +1,13 @@
+// Checks that nnm/vector3.hpp can be used without including any other NNM header.
+#define NNM_BOUNDS_CHECK
+#include <nnm/vector3.hpp>
+
+// Members with parameters of other classes are left out since their callers include those classes.
+nnm::Vector3f vector3_header_test(const nnm::Vector3f& vector, const nnm::Vector3f& axis)
+{
+    const nnm::Vector3f points[] { vector, axis };
+    return vector.rotate_axis_angle(axis, 0.5f) + vector.rotate_axis_angle_at(axis, axis, 0.5f)
+        + vector.translate(axis) + vector.scale(axis) + vector.scale_at(axis, axis) + vector.shear_x(0.5f, 0.5f)
+        + vector.shear_y_at(axis, 0.5f, 0.5f) + vector.shear_z(0.5f, 0.5f) + vector.outer(axis).at(0)
+        + nnm::Vector3f(vector.xy(), 1.0f) + nnm::centroid(points, 2) + nnm::covariance(points, 2).at(1);
+}
@@ -0,0 +1,5 @@
+// Checks that nnm/vector3i.hpp can be used without including any other NNM header.
+#define NNM_BOUNDS_CHECK
+#include <nnm/vector3i.hpp>
+
+template class nnm::Vector3i<int>;
@@ -0,0 +1,6 @@
+// Checks that nnm/vector4.hpp can be used without including any other NNM header.
+#define NNM_BOUNDS_CHECK
+#include <nnm/vector4.hpp>
+
+template class nnm::Vector4<float>;
+template class nnm::Vector4<double>;
@@ -0,0 +1,10 @@
+// Checks that nnm/wide.hpp can be used without including any other NNM header.
+#define NNM_BOUNDS_CHECK
+#include <nnm/wide.hpp>
+
+template class nnm::Maskx<4>;
+template class nnm::Scalarx<float, 4>;
+template class nnm::Vector3x<float, 4>;
+template class nnm::Vector4x<float, 4>;
+template class nnm::Quaternionx<float, 4>;
+template class nnm::Matrix4x<float, 4>;
@@ -1,6 +1,20 @@
+// nnm_instantiations_tests links the compiled instantiations which must be used with the configuration that they were
+// compiled with, so it does not check bounds.
+#if !defined(NNM_EXTERN_TEMPLATES)
 #define NNM_BOUNDS_CHECK
+#endif
+#include <nnm/dispatch.hpp>
+#include <nnm/gpu.hpp>
 #include <nnm/nnm.hpp>
+#include <nnm/parallel.hpp>
+#include <nnm/point_cloud.hpp>
+#include <nnm/snapshot.hpp>
 
+#include "nnm_dispatch_tests.hpp"
+#include "nnm_gpu_tests.hpp"
+#include "nnm_parallel_tests.hpp"
+#include "nnm_point_cloud_tests.hpp"
+#include "nnm_snapshot_tests.hpp"
 #include "nnm_tests.hpp"
 
 #include "test.hpp"
@@ -8,5 +22,10 @@
 int main()
 {
     nnm_tests();
+    nnm_parallel_tests();
+    nnm_dispatch_tests();
+    nnm_snapshot_tests();
+    nnm_gpu_tests();
+    nnm_point_cloud_tests();
     END_TESTS
 }
@@ -0,0 +1,46 @@
+// test.hpp is not used here since GCC 12 fails with an internal compiler error when a unit that imports nnm also
+// includes <string> or <optional>, which the module includes in its global module fragment. The assertions below only
+// need <cstdio>.
+#include <cstdio>
+
+import nnm;
+
+static bool g_module_tests_success = true;
+
+static void module_test_failed(const char* section, const int line)
+{
+    g_module_tests_success = false;
+    std::fprintf(stderr, "%s:%d TEST_FAILED [module] [%s]\n", __FILE__, line, section);
+}
+
+#define MODULE_ASSERT(section, expression) \
+    if (!(expression))                     \
+        module_test_failed(section, __LINE__);
+
+int main()
+{
+    {
+        const auto transform = nnm::Transform3f::from_rotation_axis_angle(nnm::Vector3f::axis_y(), 0.5f)
+                                   .translate({ 1.0f, 2.0f, 3.0f });
+        MODULE_ASSERT(
+            "Transform3",
+            nnm::Vector3f(1.0f, 2.0f, 3.0f).transform(transform).approx_equal({ 3.315859f, 4.0f, 5.153322f }));
+    }
+    {
+        MODULE_ASSERT("functions", nnm::approx_equal(nnm::sqrt(2.0f), 1.4142135f));
+        MODULE_ASSERT("functions", nnm::sqrt(nnm::Fixed16(2)).raw == 92682);
+    }
+    {
+        const nnm::Vector3f vectors[2] { { 2.0f, 0.0f, 0.0f }, { 0.0f, 0.0f, -3.0f } };
+        nnm::Vector3f results[2];
+        nnm::normalize_batch(vectors, 2, results);
+        MODULE_ASSERT(
+            "normalize_batch",
+            results[0] == nnm::Vector3f(1.0f, 0.0f, 0.0f) && results[1] == nnm::Vector3f(0.0f, 0.0f, -1.0f));
+    }
+    if (!g_module_tests_success) {
+        return 1;
+    }
+    std::printf("All tests passed!\n");
+    return 0;
+}
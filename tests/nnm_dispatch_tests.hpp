@@ -0,0 +1,224 @@
+#pragma once
+
+#include "test.hpp"
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+#include <vector>
+
+// ReSharper disable CppDFATimeOver
+
+// Whether a is within max_ulps units in the last place of magnitude from b. Variants may contract multiplies and adds
+// into FMAs, so a result that cancels to almost zero can differ from the baseline by many units in its own last place
+// but not in the last place of the terms it was computed from.
+inline bool ulp_equal(const float a, const float b, const float magnitude, const int max_ulps)
+{
+    const float ulp = std::nextafter(magnitude, std::numeric_limits<float>::infinity()) - magnitude;
+    return std::abs(a - b) <= static_cast<float>(max_ulps) * ulp;
+}
+
+inline bool ulp_equal(const nnm::Vector3f& a, const nnm::Vector3f& b, const int max_ulps)
+{
+    const float magnitude = b.abs().max();
+    for (int i = 0; i < 3; ++i) {
+        if (!ulp_equal(a[i], b[i], magnitude, max_ulps)) {
+            return false;
+        }
+    }
+    return true;
+}
+
+inline bool ulp_equal(const nnm::Transform3f& a, const nnm::Transform3f& b, const int max_ulps)
+{
+    float magnitude = 0.0f;
+    for (const float value : b.matrix) {
+        magnitude = std::max(magnitude, std::abs(value));
+    }
+    for (int i = 0; i < 16; ++i) {
+        if (!ulp_equal(a.matrix.begin()[i], b.matrix.begin()[i], magnitude, max_ulps)) {
+            return false;
+        }
+    }
+    return true;
+}
+
+inline void nnm_dispatch_tests()
+{
+    using nnm::dispatch::Isa;
+
+    test_case("dispatch");
+    {
+        test_section("supported");
+        {
+            ASSERT(nnm::dispatch::supported(Isa::baseline));
+            ASSERT(nnm::dispatch::supported(nnm::dispatch::detect()));
+            ASSERT(nnm::dispatch::supported(nnm::dispatch::active()));
+            ASSERT(!nnm::dispatch::supported(Isa::avx512) || nnm::dispatch::supported(Isa::avx2));
+            ASSERT(!nnm::dispatch::supported(Isa::avx512fp16) || nnm::dispatch::supported(Isa::avx512));
+        }
+
+        test_section("isa_from_name");
+        {
+            ASSERT(nnm::dispatch::isa_from_name("baseline") == Isa::baseline);
+            ASSERT(nnm::dispatch::isa_from_name("avx2") == Isa::avx2);
+            ASSERT(nnm::dispatch::isa_from_name("avx512") == Isa::avx512);
+            ASSERT(nnm::dispatch::isa_from_name("avx512fp16") == Isa::avx512fp16);
+            ASSERT_FALSE(nnm::dispatch::isa_from_name("sse2").has_value());
+            ASSERT_FALSE(nnm::dispatch::isa_from_name("").has_value());
+        }
+
+        test_section("select");
+        {
+            ASSERT(nnm::dispatch::select(nullptr) == nnm::dispatch::detect());
+            ASSERT(nnm::dispatch::select("baseline") == Isa::baseline);
+            if (nnm::dispatch::supported(Isa::avx2)) {
+                ASSERT(nnm::dispatch::select("avx2") == Isa::avx2);
+            }
+        }
+
+        std::vector<nnm::Vector3f> points(1003);
+        for (size_t i = 0; i < points.size(); ++i) {
+            const auto value = static_cast<float>(i);
+            points[i] = { nnm::sin(value) * value, nnm::cos(value) + 1.0f, 3.0f - value * 0.25f };
+        }
+        const Isa isas[4] { Isa::baseline, Isa::avx2, Isa::avx512, Isa::avx512fp16 };
+
+        test_section("transform_point_batch");
+        {
+            const auto transform = nnm::Transform3f::from_rotation_axis_angle({ 0.0f, 0.6f, 0.8f }, 0.7f)
+                                       .scale({ 2.0f, 3.0f, 0.5f })
+                                       .translate({ 1.0f, -2.0f, 3.0f });
+            std::vector<nnm::Vector3f> expected(points.size());
+            nnm::transform_point_batch(transform, points.data(), points.size(), expected.data());
+            for (const Isa isa : isas) {
+                if (!nnm::dispatch::supported(isa)) {
+                    continue;
+                }
+                std::vector<nnm::Vector3f> results(points.size());
+                nnm::dispatch::transform_point_batch(isa, transform, points.data(), points.size(), results.data());
+                bool correct = true;
+                for (size_t i = 0; i < points.size(); ++i) {
+                    correct = correct && ulp_equal(results[i], expected[i], 4);
+                }
+                ASSERT(correct);
+            }
+            std::vector<nnm::Vector3f> results(points.size());
+            nnm::dispatch::transform_point_batch(transform, points.data(), points.size(), results.data());
+            ASSERT(ulp_equal(results.back(), expected.back(), 4));
+        }
+
+        test_section("transform_batch");
+        {
+            std::vector<nnm::Transform3f> locals(points.size());
+            std::vector<nnm::Transform3f> parents(points.size());
+            for (size_t i = 0; i < points.size(); ++i) {
+                locals[i] = nnm::Transform3f::from_translation(points[i]);
+                parents[i] = nnm::Transform3f::from_rotation_axis_angle(
+                    nnm::Vector3f::axis_x(), static_cast<float>(i) * 0.01f);
+            }
+            std::vector<nnm::Transform3f> expected(points.size());
+            nnm::transform_batch(locals.data(), parents.data(), points.size(), expected.data());
+            for (const Isa isa : isas) {
+                if (!nnm::dispatch::supported(isa)) {
+                    continue;
+                }
+                std::vector<nnm::Transform3f> results(points.size());
+                nnm::dispatch::transform_batch(isa, locals.data(), parents.data(), points.size(), results.data());
+                bool correct = true;
+                for (size_t i = 0; i < points.size(); ++i) {
+                    correct = correct && ulp_equal(results[i], expected[i], 4);
+                }
+                ASSERT(correct);
+            }
+        }
+
+        test_section("normalize_batch");
+        {
+            std::vector<nnm::Vector3f> expected(points.size());
+            nnm::normalize_batch(points.data(), points.size(), expected.data());
+            for (const Isa isa : isas) {
+                if (!nnm::dispatch::supported(isa)) {
+                    continue;
+                }
+                std::vector<nnm::Vector3f> results(points.size());
+                nnm::dispatch::normalize_batch(isa, points.data(), points.size(), results.data());
+                bool correct = true;
+                for (size_t i = 0; i < points.size(); ++i) {
+                    correct = correct && ulp_equal(results[i], expected[i], 4);
+                }
+                ASSERT(correct);
+            }
+        }
+
+        test_section("signed_distance_batch");
+        {
+            const nnm::Plane3f plane = nnm::Plane3f({ 1.0f, -2.0f, 3.0f }, 4.0f).normalize();
+            std::vector<float> expected(points.size());
+            nnm::signed_distance_batch(plane, points.data(), points.size(), expected.data());
+            for (const Isa isa : isas) {
+                if (!nnm::dispatch::supported(isa)) {
+                    continue;
+                }
+                std::vector<float> results(points.size());
+                nnm::dispatch::signed_distance_batch(isa, plane, points.data(), points.size(), results.data());
+                bool correct = true;
+                for (size_t i = 0; i < points.size(); ++i) {
+                    correct = correct
+                        && ulp_equal(results[i], expected[i], points[i].abs().max() + std::abs(plane.distance), 4);
+                }
+                ASSERT(correct);
+            }
+        }
+
+#if defined(__FLT16_MAX__)
+        test_section("transform_point_batch (Vector3f16)");
+        {
+            const auto float_transform = nnm::Transform3f::from_rotation_axis_angle({ 0.0f, 0.6f, 0.8f }, 0.7f)
+                                             .translate({ 1.0f, -2.0f, 3.0f });
+            const nnm::Transform3f16 transform(float_transform);
+            std::vector<nnm::Vector3f16> half_points(points.size());
+            for (size_t i = 0; i < points.size(); ++i) {
+                half_points[i] = nnm::Vector3f16(points[i] * 0.01f);
+            }
+            std::vector<nnm::Vector3f> expected(points.size());
+            for (size_t i = 0; i < points.size(); ++i) {
+                expected[i] = nnm::Vector3f(half_points[i]).transform(nnm::Transform3f(transform));
+            }
+            for (const Isa isa : isas) {
+                if (!nnm::dispatch::supported(isa)) {
+                    continue;
+                }
+                std::vector<nnm::Vector3f16> results(points.size());
+                nnm::dispatch::transform_point_batch(
+                    isa, transform, half_points.data(), half_points.size(), results.data());
+                bool correct = true;
+                for (size_t i = 0; i < points.size(); ++i) {
+                    correct = correct && (nnm::Vector3f(results[i]) - expected[i]).abs().max() < 0.02f;
+                }
+                ASSERT(correct);
+            }
+        }
+
+#endif
+        test_section("encode_batch/decode_batch (Vector3h)");
+        {
+            std::vector<nnm::Vector3h> expected(points.size());
+            nnm::encode_batch(points.data(), points.size(), expected.data());
+            for (const Isa isa : isas) {
+                if (!nnm::dispatch::supported(isa)) {
+                    continue;
+                }
+                std::vector<nnm::Vector3h> encoded(points.size());
+                nnm::dispatch::encode_batch(isa, points.data(), points.size(), encoded.data());
+                std::vector<nnm::Vector3f> decoded(points.size());
+                nnm::dispatch::decode_batch(isa, encoded.data(), encoded.size(), decoded.data());
+                bool correct = true;
+                for (size_t i = 0; i < points.size(); ++i) {
+                    correct = correct && encoded[i] == expected[i] && decoded[i] == expected[i].decode();
+                }
+                ASSERT(correct);
+            }
+        }
+    }
+}
\ No newline at end of file
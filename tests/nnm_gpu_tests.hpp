@@ -0,0 +1,255 @@
+#pragma once
+
+#include "test.hpp"
+
+#include <cstring>
+#include <vector>
+
+// ReSharper disable CppDFATimeOver
+
+inline float read_float(const std::vector<std::byte>& buffer, const size_t offset)
+{
+    float result;
+    std::memcpy(&result, buffer.data() + offset, sizeof(float));
+    return result;
+}
+
+inline void nnm_gpu_tests()
+{
+    using nnm::gpu::Layout;
+    using nnm::gpu::MatrixOrder;
+
+    test_case("gpu layout");
+    {
+        test_section("alignment");
+        {
+            static_assert(nnm::gpu::alignment<float>(Layout::std140) == 4);
+            static_assert(nnm::gpu::alignment<nnm::Vector2f>(Layout::std140) == 8);
+            static_assert(nnm::gpu::alignment<nnm::Vector3f>(Layout::std140) == 16);
+            static_assert(nnm::gpu::alignment<nnm::Vector3d>(Layout::std430) == 32);
+            static_assert(nnm::gpu::alignment<nnm::Matrix2f>(Layout::std140) == 16);
+            static_assert(nnm::gpu::alignment<nnm::Matrix2f>(Layout::std430) == 8);
+            static_assert(nnm::gpu::alignment<nnm::Matrix3f>(Layout::std430) == 16);
+            static_assert(nnm::gpu::alignment<nnm::Matrix4d>(Layout::std140) == 32);
+        }
+
+        test_section("size");
+        {
+            static_assert(nnm::gpu::size<nnm::Vector3f>(Layout::std140) == 12);
+            static_assert(nnm::gpu::size<nnm::Matrix2f>(Layout::std140) == 32);
+            static_assert(nnm::gpu::size<nnm::Matrix2f>(Layout::std430) == 16);
+            static_assert(nnm::gpu::size<nnm::Basis3f>(Layout::std140) == 48);
+            static_assert(nnm::gpu::size<nnm::Transform3f>(Layout::std430) == 64);
+            static_assert(nnm::gpu::size<nnm::Matrix3d>(Layout::std430) == 96);
+            static_assert(nnm::gpu::size<nnm::Vector3f>(Layout::std140, MatrixOrder::row_major) == 12);
+            static_assert(nnm::gpu::size<float>(Layout::std430, MatrixOrder::row_major) == 4);
+        }
+
+        test_section("array_stride");
+        {
+            static_assert(nnm::gpu::array_stride<float>(Layout::std140) == 16);
+            static_assert(nnm::gpu::array_stride<float>(Layout::std430) == 4);
+            static_assert(nnm::gpu::array_stride<nnm::Vector2f>(Layout::std140) == 16);
+            static_assert(nnm::gpu::array_stride<nnm::Vector2f>(Layout::std430) == 8);
+            static_assert(nnm::gpu::array_stride<nnm::Vector3f>(Layout::std430) == 16);
+            static_assert(nnm::gpu::array_stride<nnm::Vector3d>(Layout::std140) == 32);
+            static_assert(nnm::gpu::array_stride<nnm::QuaternionF>(Layout::std430) == 16);
+            static_assert(nnm::gpu::array_stride<nnm::Matrix2f>(Layout::std430) == 16);
+            static_assert(nnm::gpu::array_stride<nnm::Basis3f>(Layout::std430) == 48);
+            static_assert(nnm::gpu::array_stride<nnm::Matrix4f>(Layout::std140) == 64);
+            static_assert(nnm::gpu::array_stride<nnm::Vector3f>(Layout::std430, MatrixOrder::row_major) == 16);
+            static_assert(nnm::gpu::array_stride<float>(Layout::std430, MatrixOrder::row_major) == 4);
+        }
+
+        test_section("struct_alignment");
+        {
+            static_assert(nnm::gpu::struct_alignment(Layout::std140, 8) == 16);
+            static_assert(nnm::gpu::struct_alignment(Layout::std430, 8) == 8);
+        }
+    }
+
+    test_case("gpu::Writer");
+    {
+        // Block of float a; vec2 b; vec3 c; float d; float e[2]; mat3 f; vec3 g[2]; mat4 h; mat2 i; vec4 j; with
+        // every component set to its index plus one.
+        struct Component {
+            size_t std140;
+            size_t std430;
+            float value;
+        };
+        constexpr Component table[] {
+        { 0, 0, 1.0f }, { 8, 8, 2.0f }, { 12, 12, 3.0f }, { 16, 16, 4.0f }, { 20, 20, 5.0f }, { 24, 24, 6.0f },
+        { 28, 28, 7.0f }, { 32, 32, 8.0f }, { 48, 36, 9.0f }, { 64, 48, 10.0f }, { 68, 52, 11.0f },
+        { 72, 56, 12.0f }, { 80, 64, 13.0f }, { 84, 68, 14.0f }, { 88, 72, 15.0f }, { 96, 80, 16.0f },
+        { 100, 84, 17.0f }, { 104, 88, 18.0f }, { 112, 96, 19.0f }, { 116, 100, 20.0f }, { 120, 104, 21.0f },
+        { 128, 112, 22.0f }, { 132, 116, 23.0f }, { 136, 120, 24.0f }, { 144, 128, 25.0f }, { 148, 132, 26.0f },
+        { 152, 136, 27.0f }, { 156, 140, 28.0f }, { 160, 144, 29.0f }, { 164, 148, 30.0f }, { 168, 152, 31.0f },
+        { 172, 156, 32.0f }, { 176, 160, 33.0f }, { 180, 164, 34.0f }, { 184, 168, 35.0f }, { 188, 172, 36.0f },
+        { 192, 176, 37.0f }, { 196, 180, 38.0f }, { 200, 184, 39.0f }, { 204, 188, 40.0f }, { 208, 192, 41.0f },
+        { 212, 196, 42.0f }, { 224, 200, 43.0f }, { 228, 204, 44.0f }, { 240, 208, 45.0f }, { 244, 212, 46.0f },
+        { 248, 216, 47.0f }, { 252, 220, 48.0f }
+        };
+        const nnm::Vector3f g[] { { 19.0f, 20.0f, 21.0f }, { 22.0f, 23.0f, 24.0f } };
+        const float e[] { 8.0f, 9.0f };
+        // Writing the transpose of each matrix row-major gives the same bytes as writing it column-major.
+        auto write_block = [&](nnm::gpu::Writer& writer, const bool transpose) {
+            writer.write(1.0f);
+            writer.write(nnm::Vector2f(2.0f, 3.0f));
+            writer.write(nnm::Vector3f(4.0f, 5.0f, 6.0f));
+            writer.write(7.0f);
+            writer.write_array(e, 2);
+            const nnm::Matrix3f f(10.0f, 11.0f, 12.0f, 13.0f, 14.0f, 15.0f, 16.0f, 17.0f, 18.0f);
+            writer.write(transpose ? f.transpose() : f);
+            writer.write_array(g, 2);
+            const nnm::Matrix4f h(
+                25.0f,
+                26.0f,
+                27.0f,
+                28.0f,
+                29.0f,
+                30.0f,
+                31.0f,
+                32.0f,
+                33.0f,
+                34.0f,
+                35.0f,
+                36.0f,
+                37.0f,
+                38.0f,
+                39.0f,
+                40.0f);
+            writer.write(transpose ? h.transpose() : h);
+            const nnm::Matrix2f i({ 41.0f, 42.0f }, { 43.0f, 44.0f });
+            writer.write(transpose ? i.transpose() : i);
+            writer.write(nnm::Vector4f(45.0f, 46.0f, 47.0f, 48.0f));
+        };
+
+        test_section("std140");
+        {
+            std::vector<std::byte> buffer(256);
+            nnm::gpu::Writer writer(buffer.data(), Layout::std140);
+            write_block(writer, false);
+            ASSERT(writer.offset == 256);
+            bool matches = true;
+            for (const Component& component : table) {
+                matches = matches && read_float(buffer, component.std140) == component.value;
+            }
+            ASSERT(matches);
+        }
+
+        test_section("std430");
+        {
+            std::vector<std::byte> buffer(224);
+            nnm::gpu::Writer writer(buffer.data(), Layout::std430);
+            write_block(writer, false);
+            ASSERT(writer.offset == 224);
+            bool matches = true;
+            for (const Component& component : table) {
+                matches = matches && read_float(buffer, component.std430) == component.value;
+            }
+            ASSERT(matches);
+        }
+
+        test_section("row_major");
+        {
+            std::vector<std::byte> buffer140(256);
+            nnm::gpu::Writer writer140(buffer140.data(), Layout::std140, MatrixOrder::row_major);
+            write_block(writer140, true);
+            ASSERT(writer140.offset == 256);
+            std::vector<std::byte> buffer430(224);
+            nnm::gpu::Writer writer430(buffer430.data(), Layout::std430, MatrixOrder::row_major);
+            write_block(writer430, true);
+            ASSERT(writer430.offset == 224);
+            bool matches = true;
+            for (const Component& component : table) {
+                matches = matches && read_float(buffer140, component.std140) == component.value
+                    && read_float(buffer430, component.std430) == component.value;
+            }
+            ASSERT(matches);
+        }
+
+        test_section("align_struct");
+        {
+            // Array of struct { mat4 model; vec3 color; } which is 76 bytes padded to 80.
+            std::vector<std::byte> buffer(240);
+            nnm::gpu::Writer writer(buffer.data(), Layout::std140);
+            for (int i = 0; i < 3; ++i) {
+                writer.align_struct(16);
+                writer.write(nnm::Transform3f::from_translation({ static_cast<float>(i), 0.0f, 0.0f }));
+                writer.write(nnm::Vector3f(1.0f, 0.5f, static_cast<float>(i)));
+                writer.align_struct(16);
+            }
+            ASSERT(writer.offset == 240);
+            ASSERT(read_float(buffer, 80 + 48) == 1.0f);
+            ASSERT(read_float(buffer, 160 + 64 + 8) == 2.0f);
+        }
+    }
+
+    test_case("gpu::write_array");
+    {
+        const nnm::Matrix4f matrix(
+            1.0f, 2.0f, 3.0f, 4.0f, 5.0f, 6.0f, 7.0f, 8.0f, 9.0f, 10.0f, 11.0f, 12.0f, 13.0f, 14.0f, 15.0f, 16.0f);
+
+        test_section("Matrix4");
+        {
+            const nnm::Matrix4f matrices[] { matrix, matrix.transpose() };
+            std::vector<std::byte> buffer(128);
+            ASSERT(nnm::gpu::write_array(matrices, 2, Layout::std140, buffer.data()) == 128);
+            ASSERT(std::memcmp(buffer.data(), matrices, sizeof(matrices)) == 0);
+        }
+
+        test_section("row_major");
+        {
+            const nnm::Matrix4f matrices[] { matrix, matrix.transpose() };
+            std::vector<std::byte> buffer(128);
+            nnm::gpu::write_array(matrices, 2, Layout::std430, buffer.data(), MatrixOrder::row_major);
+            const nnm::Matrix4f transposed[] { matrix.transpose(), matrix };
+            ASSERT(std::memcmp(buffer.data(), transposed, sizeof(transposed)) == 0);
+            const nnm::Basis3f basis(nnm::Matrix3f(1.0f, 2.0f, 3.0f, 4.0f, 5.0f, 6.0f, 7.0f, 8.0f, 9.0f));
+            std::vector<std::byte> basis_buffer(48);
+            nnm::gpu::write_array(&basis, 1, Layout::std140, basis_buffer.data(), MatrixOrder::row_major);
+            ASSERT(read_float(basis_buffer, 4) == 4.0f);
+            ASSERT(read_float(basis_buffer, 16) == 2.0f);
+            ASSERT(read_float(basis_buffer, 40) == 9.0f);
+        }
+
+        test_section("Vector3");
+        {
+            const nnm::Vector3f vectors[] { { 1.0f, 2.0f, 3.0f }, { 4.0f, 5.0f, 6.0f }, { 7.0f, 8.0f, 9.0f } };
+            std::vector<std::byte> buffer(48);
+            ASSERT(nnm::gpu::write_array(vectors, 3, Layout::std430, buffer.data()) == 48);
+            ASSERT(read_float(buffer, 16) == 4.0f);
+            ASSERT(read_float(buffer, 40) == 9.0f);
+            const nnm::Vector3Af aligned[] {
+                nnm::Vector3Af(vectors[0]), nnm::Vector3Af(vectors[1]), nnm::Vector3Af(vectors[2])
+            };
+            std::vector<std::byte> aligned_buffer(48);
+            ASSERT(nnm::gpu::write_array(aligned, 3, Layout::std430, aligned_buffer.data()) == 48);
+            bool matches = true;
+            for (size_t i = 0; i < 3; ++i) {
+                matches = matches && std::memcmp(buffer.data() + i * 16, aligned_buffer.data() + i * 16, 12) == 0;
+            }
+            ASSERT(matches);
+        }
+
+        test_section("Basis3");
+        {
+            const nnm::Basis3f bases[] { nnm::Basis3f::from_rotation_axis_angle({ 0.0f, 1.0f, 0.0f }, 0.5f),
+                                         nnm::Basis3f::from_scale({ 2.0f, 3.0f, 4.0f }) };
+            std::vector<std::byte> buffer(96);
+            ASSERT(nnm::gpu::write_array(bases, 2, Layout::std140, buffer.data()) == 96);
+            ASSERT(read_float(buffer, 48 + 16 + 4) == 3.0f);
+            ASSERT(read_float(buffer, 8) == bases[0].matrix.at(0, 2));
+        }
+
+        test_section("double");
+        {
+            const nnm::Vector3d vectors[] { { 1.0, 2.0, 3.0 }, { 4.0, 5.0, 6.0 } };
+            std::vector<std::byte> buffer(64);
+            ASSERT(nnm::gpu::write_array(vectors, 2, Layout::std140, buffer.data()) == 64);
+            double value;
+            std::memcpy(&value, buffer.data() + 32, sizeof(double));
+            ASSERT(value == 4.0);
+        }
+    }
+}
\ No newline at end of file
@@ -0,0 +1,258 @@
+#pragma once
+
+#include "test.hpp"
+
+#include <atomic>
+#include <vector>
+
+// ReSharper disable CppDFATimeOver
+
+inline void nnm_parallel_tests()
+{
+    test_case("chunk_size");
+    {
+        ASSERT(nnm::parallel::chunk_size(0) == 1024);
+        ASSERT(nnm::parallel::chunk_size(10) == 1024);
+        ASSERT(nnm::parallel::chunk_size(1024 * 1024) == 4096);
+    }
+
+    test_case("ThreadPool");
+    {
+        test_section("thread_count");
+        {
+            const nnm::parallel::ThreadPool pool1(3);
+            ASSERT(pool1.thread_count() == 3);
+            const nnm::parallel::ThreadPool pool2(0);
+            ASSERT(pool2.thread_count() == 1);
+        }
+
+        test_section("parallel_for");
+        {
+            for (const size_t thread_count : { 1, 2, 5 }) {
+                nnm::parallel::ThreadPool pool(thread_count);
+                std::vector<int> visits(10007, 0);
+                std::atomic<size_t> chunks = 0;
+                pool.parallel_for(3, visits.size(), 100, [&](const size_t begin, const size_t end) {
+                    ASSERT(end - begin <= 100);
+                    for (size_t i = begin; i < end; ++i) {
+                        ++visits[i];
+                    }
+                    ++chunks;
+                });
+                ASSERT(chunks == 101);
+                bool correct = visits[0] == 0 && visits[1] == 0 && visits[2] == 0;
+                for (size_t i = 3; i < visits.size(); ++i) {
+                    correct = correct && visits[i] == 1;
+                }
+                ASSERT(correct);
+                bool called = false;
+                pool.parallel_for(5, 5, 1, [&](size_t, size_t) { called = true; });
+                ASSERT_FALSE(called);
+            }
+        }
+
+        test_section("parallel_for nested");
+        {
+            nnm::parallel::ThreadPool pool(4);
+            std::atomic<size_t> count = 0;
+            pool.parallel_for(0, 8, 1, [&](size_t, size_t) {
+                pool.parallel_for(0, 100, 10, [&](const size_t begin, const size_t end) { count += end - begin; });
+            });
+            ASSERT(count == 800);
+        }
+
+        test_section("parallel_reduce");
+        {
+            std::vector<float> values(100000);
+            for (size_t i = 0; i < values.size(); ++i) {
+                values[i] = 1.0f / static_cast<float>(i + 1);
+            }
+            const auto sum = [&](nnm::parallel::ThreadPool& pool) {
+                return pool.parallel_reduce(
+                    0,
+                    values.size(),
+                    nnm::parallel::chunk_size(values.size()),
+                    0.0f,
+                    [&](const size_t begin, const size_t end) {
+                        float result = 0.0f;
+                        for (size_t i = begin; i < end; ++i) {
+                            result += values[i];
+                        }
+                        return result;
+                    },
+                    [](const float a, const float b) { return a + b; });
+            };
+            nnm::parallel::ThreadPool pool1(1);
+            nnm::parallel::ThreadPool pool2(3);
+            nnm::parallel::ThreadPool pool3(8);
+            const float result = sum(pool1);
+            ASSERT(nnm::approx_equal(result, 12.0901f));
+            ASSERT(sum(pool2) == result);
+            ASSERT(sum(pool3) == result);
+            const float empty = pool2.parallel_reduce(
+                0, 0, 1, 5.0f, [](size_t, size_t) { return 0.0f; }, [](float a, float b) { return a + b; });
+            ASSERT(empty == 5.0f);
+        }
+    }
+
+    test_case("parallel batch");
+    {
+        nnm::parallel::ThreadPool pool(4);
+        std::vector<nnm::Vector3f> points(5000);
+        for (size_t i = 0; i < points.size(); ++i) {
+            const auto value = static_cast<float>(i);
+            points[i] = { value, 1.0f - value, value * 0.5f + 1.0f };
+        }
+
+        test_section("transform_point_batch");
+        {
+            const auto transform = nnm::Transform3f::from_scale({ 2.0f, 3.0f, 4.0f }).translate({ 1.0f, 0.0f, -1.0f });
+            std::vector<nnm::Vector3f> results(points.size());
+            nnm::parallel::transform_point_batch(pool, transform, points.data(), points.size(), results.data());
+            bool correct = true;
+            for (size_t i = 0; i < points.size(); ++i) {
+                correct = correct && results[i].approx_equal(points[i].transform(transform));
+            }
+            ASSERT(correct);
+        }
+
+        test_section("transform_point_batch (Vector3A)");
+        {
+            const auto transform = nnm::Transform3f::from_scale({ 2.0f, 3.0f, 4.0f }).translate({ 1.0f, 0.0f, -1.0f });
+            std::vector<nnm::Vector3Af> aligned_points(points.size());
+            for (size_t i = 0; i < points.size(); ++i) {
+                aligned_points[i] = nnm::Vector3Af(points[i]);
+            }
+            std::vector<nnm::Vector3Af> results(points.size());
+            nnm::parallel::transform_point_batch(
+                pool, transform, aligned_points.data(), aligned_points.size(), results.data());
+            bool correct = true;
+            for (size_t i = 0; i < points.size(); ++i) {
+                correct = correct && nnm::Vector3f(results[i]).approx_equal(points[i].transform(transform));
+            }
+            ASSERT(correct);
+        }
+
+        test_section("transform_point_batch (StridedSpan)");
+        {
+            const auto transform = nnm::Transform3f::from_scale({ 2.0f, 3.0f, 4.0f }).translate({ 1.0f, 0.0f, -1.0f });
+            // Points interleaved with a fourth float that must be left untouched.
+            std::vector<float> interleaved(points.size() * 4, -1.0f);
+            const nnm::StridedSpan<nnm::Vector3f> span(interleaved.data(), points.size(), sizeof(float) * 4);
+            nnm::parallel::transform_point_batch(
+                pool, transform, nnm::StridedSpan<const nnm::Vector3f>(points.data(), points.size()), span);
+            bool correct = true;
+            for (size_t i = 0; i < points.size(); ++i) {
+                correct = correct && span[i] == points[i].transform(transform) && interleaved[i * 4 + 3] == -1.0f;
+            }
+            ASSERT(correct);
+            nnm::parallel::normalize_batch(pool, span, span);
+            ASSERT(span[10] == points[10].transform(transform).normalize());
+            std::vector<float> distances(points.size());
+            const nnm::Plane3f plane = nnm::Plane3f({ 1.0f, 2.0f, 3.0f }, 4.0f).normalize();
+            nnm::parallel::signed_distance_batch(
+                pool, plane, span, nnm::StridedSpan<float>(distances.data(), distances.size()));
+            ASSERT(distances[10] == plane.signed_distance(span[10]));
+        }
+
+        test_section("transform_batch");
+        {
+            std::vector<nnm::Transform3f> locals(3000);
+            std::vector<nnm::Transform3f> parents(3000);
+            for (size_t i = 0; i < locals.size(); ++i) {
+                locals[i] = nnm::Transform3f::from_translation(points[i]);
+                parents[i] = nnm::Transform3f::from_scale(nnm::Vector3f::all(static_cast<float>(i)));
+            }
+            std::vector<nnm::Transform3f> results(locals.size());
+            nnm::parallel::transform_batch(pool, locals.data(), parents.data(), locals.size(), results.data());
+            bool correct = true;
+            for (size_t i = 0; i < locals.size(); ++i) {
+                correct = correct && results[i] == locals[i].transform(parents[i]);
+            }
+            ASSERT(correct);
+        }
+
+        test_section("normalize_batch");
+        {
+            std::vector<nnm::Vector3f> results(points.size());
+            nnm::parallel::normalize_batch(pool, points.data(), points.size(), results.data());
+            bool correct = true;
+            for (size_t i = 0; i < points.size(); ++i) {
+                correct = correct && results[i] == points[i].normalize();
+            }
+            ASSERT(correct);
+        }
+
+        test_section("signed_distance_batch");
+        {
+            const nnm::Plane3f plane = nnm::Plane3f({ 1.0f, 2.0f, 3.0f }, 4.0f).normalize();
+            std::vector<float> results(points.size());
+            nnm::parallel::signed_distance_batch(pool, plane, points.data(), points.size(), results.data());
+            bool correct = true;
+            for (size_t i = 0; i < points.size(); ++i) {
+                correct = correct && results[i] == plane.signed_distance(points[i]);
+            }
+            ASSERT(correct);
+        }
+
+        test_section("orthonormalize_batch");
+        {
+            std::vector<nnm::Basis3f> bases(2000);
+            for (size_t i = 0; i < bases.size(); ++i) {
+                bases[i] = nnm::Basis3f::from_rotation_axis_angle(
+                               nnm::Vector3f::axis_y(), static_cast<float>(i) * 0.01f)
+                               .scale({ 1.0f, 1.01f, 0.99f });
+            }
+            std::vector<nnm::Basis3f> expected = bases;
+            nnm::orthonormalize_batch(expected.data(), expected.size());
+            nnm::parallel::orthonormalize_batch(pool, bases.data(), bases.size());
+            bool correct = true;
+            for (size_t i = 0; i < bases.size(); ++i) {
+                correct = correct && bases[i] == expected[i];
+            }
+            ASSERT(correct);
+        }
+
+        test_section("aabb_from_points");
+        {
+            const auto expected = nnm::AABB3f::from_points(points.data(), points.size());
+            ASSERT(nnm::parallel::aabb_from_points(pool, points.data(), points.size()) == expected);
+            ASSERT(nnm::parallel::aabb_from_points(pool, points.data(), 0) == nnm::AABB3f());
+        }
+
+        test_section("centroid");
+        {
+            const auto expected = nnm::centroid(points.data(), points.size());
+            const auto result = nnm::parallel::centroid(pool, points.data(), points.size());
+            ASSERT(result.approx_equal(expected));
+            nnm::parallel::ThreadPool pool1(1);
+            ASSERT(nnm::parallel::centroid(pool1, points.data(), points.size()) == result);
+            ASSERT(nnm::parallel::centroid(pool, points.data(), 0) == nnm::Vector3f::zero());
+        }
+
+        test_section("covariance");
+        {
+            const auto expected = nnm::covariance(points.data(), points.size());
+            const auto result = nnm::parallel::covariance(pool, points.data(), points.size());
+            ASSERT(result.approx_equal(expected));
+            nnm::parallel::ThreadPool pool1(1);
+            ASSERT(nnm::parallel::covariance(pool1, points.data(), points.size()) == result);
+            ASSERT(nnm::parallel::covariance(pool, points.data(), 0) == nnm::Matrix3f::zero());
+        }
+
+        test_section("parallel_for");
+        {
+            std::vector<int> values(3000, 0);
+            nnm::parallel::parallel_for(0, values.size(), [&](const size_t begin, const size_t end) {
+                for (size_t i = begin; i < end; ++i) {
+                    values[i] = static_cast<int>(i);
+                }
+            });
+            bool correct = true;
+            for (size_t i = 0; i < values.size(); ++i) {
+                correct = correct && values[i] == static_cast<int>(i);
+            }
+            ASSERT(correct);
+        }
+    }
+}
\ No newline at end of file
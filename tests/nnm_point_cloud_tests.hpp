@@ -0,0 +1,135 @@
+#pragma once
+
+#include "test.hpp"
+
+#include <cstdio>
+#include <vector>
+
+// ReSharper disable CppDFATimeOver
+
+template <typename Real>
+bool write_points_file(const char* path, const std::vector<nnm::Vector3<Real>>& points)
+{
+    std::FILE* file = std::fopen(path, "wb");
+    if (file == nullptr) {
+        return false;
+    }
+    // fwrite must not be passed the null data of an empty vector.
+    const size_t written
+        = points.empty() ? 0 : std::fwrite(points.data(), sizeof(nnm::Vector3<Real>), points.size(), file);
+    return std::fclose(file) == 0 && written == points.size();
+}
+
+inline void nnm_point_cloud_tests()
+{
+    const char* input_path = "nnm_point_cloud_input.bin";
+    const char* output_path = "nnm_point_cloud_output.bin";
+    nnm::parallel::ThreadPool pool(4);
+    const auto transform = nnm::Transform3f::from_rotation_axis_angle({ 0.0f, 0.0f, 1.0f }, 0.7f)
+                               .scale({ 2.0f, 1.0f, 0.5f })
+                               .translate({ 10.0f, -3.0f, 1.0f });
+
+    test_case("point_cloud::MappedFile");
+    {
+        test_section("open_read");
+        {
+            const std::vector<nnm::Vector3f> points { { 1.0f, 2.0f, 3.0f }, { 4.0f, 5.0f, 6.0f } };
+            ASSERT(write_points_file(input_path, points));
+            const auto file = nnm::point_cloud::MappedFile::open_read(input_path);
+            ASSERT(file.has_value() && file->size() == sizeof(nnm::Vector3f) * 2);
+            ASSERT(reinterpret_cast<const nnm::Vector3f*>(file->data())[1] == points[1]);
+            ASSERT_FALSE(nnm::point_cloud::MappedFile::open_read("nnm_point_cloud_missing.bin").has_value());
+        }
+
+        test_section("create");
+        {
+            {
+                auto file = nnm::point_cloud::MappedFile::create(output_path, sizeof(nnm::Vector3f));
+                ASSERT(file.has_value() && file->size() == sizeof(nnm::Vector3f));
+                *reinterpret_cast<nnm::Vector3f*>(file->data()) = nnm::Vector3f(7.0f, 8.0f, 9.0f);
+            }
+            const auto file = nnm::point_cloud::MappedFile::open_read(output_path);
+            ASSERT(file.has_value() && *reinterpret_cast<const nnm::Vector3f*>(file->data()) == nnm::Vector3f(7, 8, 9));
+        }
+
+        test_section("same_file");
+        {
+            const auto file = nnm::point_cloud::MappedFile::open_read(output_path);
+            ASSERT(file.has_value() && file->same_file(output_path));
+            ASSERT(file->same_file("./nnm_point_cloud_output.bin"));
+            ASSERT_FALSE(file->same_file(input_path));
+            ASSERT_FALSE(file->same_file("nnm_point_cloud_missing.bin"));
+        }
+    }
+
+    test_case("point_cloud::transform_file");
+    {
+        test_section("float");
+        {
+            std::vector<nnm::Vector3f> points;
+            for (int i = 0; i < 100000; ++i) {
+                const auto value = static_cast<float>(i);
+                points.emplace_back(nnm::sin(value) * 50.0f, nnm::cos(value * 0.3f) * 20.0f, value * 0.001f);
+            }
+            ASSERT(write_points_file(input_path, points));
+            const auto bounds = nnm::point_cloud::transform_file(pool, transform, input_path, output_path);
+            const auto file = nnm::point_cloud::MappedFile::open_read(output_path);
+            ASSERT(file.has_value() && file->size() == points.size() * sizeof(nnm::Vector3f));
+            const auto results = reinterpret_cast<const nnm::Vector3f*>(file->data());
+            std::vector<nnm::Vector3f> expected(points.size());
+            nnm::transform_point_batch(transform, points.data(), points.size(), expected.data());
+            bool correct = true;
+            for (size_t i = 0; i < points.size(); ++i) {
+                correct = correct && results[i] == expected[i];
+            }
+            ASSERT(correct);
+            const auto expected_bounds = nnm::AABB3f::from_points(expected.data(), expected.size());
+            ASSERT(bounds.has_value() && bounds->min == expected_bounds.min && bounds->max == expected_bounds.max);
+        }
+
+        test_section("double");
+        {
+            std::vector<nnm::Vector3d> points;
+            for (int i = 0; i < 20000; ++i) {
+                const auto value = static_cast<double>(i);
+                points.emplace_back(value * 1000.0, -value, value * value);
+            }
+            ASSERT(write_points_file(input_path, points));
+            const auto bounds
+                = nnm::point_cloud::transform_file(pool, nnm::Transform3d(transform), input_path, output_path);
+            const auto file = nnm::point_cloud::MappedFile::open_read(output_path);
+            ASSERT(file.has_value() && file->size() == points.size() * sizeof(nnm::Vector3d));
+            const auto results = reinterpret_cast<const nnm::Vector3d*>(file->data());
+            ASSERT(results[12345] == points[12345].transform(nnm::Transform3d(transform)));
+            ASSERT(bounds.has_value() && bounds->max.z == points.back().transform(nnm::Transform3d(transform)).z);
+        }
+
+        test_section("empty");
+        {
+            ASSERT(write_points_file(input_path, std::vector<nnm::Vector3f>()));
+            const auto bounds = nnm::point_cloud::transform_file(pool, transform, input_path, output_path);
+            ASSERT(bounds.has_value() && bounds->min == nnm::Vector3f::zero() && bounds->max == nnm::Vector3f::zero());
+        }
+
+        test_section("invalid");
+        {
+            ASSERT(write_points_file(input_path, std::vector<nnm::Vector3f> { { 1.0f, 2.0f, 3.0f } }));
+            ASSERT_FALSE(nnm::point_cloud::transform_file(pool, nnm::Transform3d(), input_path, output_path));
+            ASSERT_FALSE(nnm::point_cloud::transform_file(pool, transform, "nnm_point_cloud_missing.bin", output_path));
+        }
+
+        test_section("same file");
+        {
+            const std::vector<nnm::Vector3f> points { { 1.0f, 2.0f, 3.0f }, { 4.0f, 5.0f, 6.0f } };
+            ASSERT(write_points_file(input_path, points));
+            ASSERT_FALSE(nnm::point_cloud::transform_file(pool, transform, input_path, input_path));
+            ASSERT_FALSE(nnm::point_cloud::transform_file(pool, transform, input_path, "./nnm_point_cloud_input.bin"));
+            const auto file = nnm::point_cloud::MappedFile::open_read(input_path);
+            ASSERT(file.has_value() && file->size() == sizeof(nnm::Vector3f) * 2);
+            ASSERT(reinterpret_cast<const nnm::Vector3f*>(file->data())[1] == points[1]);
+        }
+    }
+
+    std::remove(input_path);
+    std::remove(output_path);
+}
\ No newline at end of file
@@ -0,0 +1,172 @@
+#pragma once
+
+#include "test.hpp"
+
+#include <algorithm>
+#include <iterator>
+#include <vector>
+
+// ReSharper disable CppDFATimeOver
+
+inline void nnm_snapshot_tests()
+{
+    using nnm::snapshot::State;
+
+    std::vector<nnm::Vector3f> translations;
+    std::vector<nnm::QuaternionF> rotations;
+    for (int i = 0; i < 100; ++i) {
+        const auto value = static_cast<float>(i);
+        translations.emplace_back(nnm::sin(value) * 500.0f, value * 0.37f, -nnm::cos(value * 1.7f) * 20.0f);
+        const nnm::Vector3f axis(nnm::sin(value * 1.3f), nnm::cos(value * 0.7f), nnm::sin(value * 2.9f) + 0.1f);
+        rotations.push_back(nnm::QuaternionF::from_axis_angle(axis.normalize(), value * 0.37f - 30.0f));
+    }
+    const nnm::snapshot::Codec codec(0.001f);
+
+    test_case("snapshot::State");
+    {
+        test_section("State()");
+        {
+            constexpr State state;
+            ASSERT(state.x == 0 && state.y == 0 && state.z == 0);
+            ASSERT(state.rotation == nnm::QuaternionPacked48().bits());
+        }
+
+        test_section("channels");
+        {
+            const State state = codec.quantize(translations[7], rotations[7]);
+            uint32_t channels[nnm::snapshot::channel_count];
+            state.channels(channels);
+            ASSERT(State::from_channels(channels) == state);
+            ASSERT(State::from_channels(channels) != State());
+        }
+    }
+
+    test_case("snapshot::Codec");
+    {
+        test_section("quantize");
+        {
+            bool within = true;
+            for (size_t i = 0; i < translations.size(); ++i) {
+                const State state = codec.quantize(translations[i], rotations[i]);
+                const nnm::Vector3f translation = codec.translation(state);
+                within = within && (translation - translations[i]).abs().max() <= 0.0005f + 0.0001f;
+                const float dot = nnm::Vector4f::from_quaternion(nnm::snapshot::Codec::rotation(state))
+                                      .dot(nnm::Vector4f::from_quaternion(rotations[i]));
+                within = within && nnm::abs(dot) >= 1.0f - 1.0e-6f;
+            }
+            ASSERT(within);
+            const State state = codec.quantize(nnm::Vector3f(0.0014f, -0.0016f, 2.0f), nnm::QuaternionF());
+            ASSERT(state.x == 1 && state.y == -2 && state.z == 2000);
+        }
+
+        test_section("quantize(const Transform3f&)");
+        {
+            const auto transform = nnm::Transform3f::from_basis_translation(
+                nnm::Basis3f::from_rotation_quaternion(rotations[3]), translations[3]);
+            const State state = codec.quantize(transform);
+            const State expected = codec.quantize(translations[3], rotations[3]);
+            ASSERT(state.x == expected.x && state.y == expected.y && state.z == expected.z);
+            const nnm::Transform3f decoded = codec.transform(state);
+            ASSERT((decoded.translation() - transform.translation()).abs().max() <= 0.0005f + 0.0001f);
+            const float dot = nnm::Vector4f::from_quaternion(nnm::QuaternionF::from_basis(decoded.basis()))
+                                  .dot(nnm::Vector4f::from_quaternion(rotations[3]));
+            ASSERT(nnm::abs(dot) >= 1.0f - 1.0e-6f);
+        }
+
+        test_section("batch");
+        {
+            std::vector<State> states(translations.size());
+            codec.quantize_batch(translations.data(), rotations.data(), translations.size(), states.data());
+            ASSERT(states[5] == codec.quantize(translations[5], rotations[5]));
+            std::vector<nnm::Vector3f> decoded_translations(states.size());
+            std::vector<nnm::QuaternionF> decoded_rotations(states.size());
+            codec.dequantize_batch(
+                states.data(), states.size(), decoded_translations.data(), decoded_rotations.data());
+            ASSERT(decoded_translations[5] == codec.translation(states[5]));
+            ASSERT(decoded_rotations[5] == nnm::snapshot::Codec::rotation(states[5]));
+            std::vector<nnm::Transform3f> transforms(states.size());
+            codec.dequantize_batch(states.data(), states.size(), transforms.data());
+            std::vector<State> requantized(states.size());
+            codec.quantize_batch(transforms.data(), transforms.size(), requantized.data());
+            ASSERT(requantized[9].x == states[9].x);
+        }
+    }
+
+    test_case("snapshot delta");
+    {
+        std::vector<State> baseline(translations.size());
+        codec.quantize_batch(translations.data(), rotations.data(), translations.size(), baseline.data());
+
+        test_section("zigzag");
+        {
+            ASSERT(nnm::snapshot::zigzag_encode(0) == 0);
+            ASSERT(nnm::snapshot::zigzag_encode(static_cast<uint32_t>(-1)) == 1);
+            ASSERT(nnm::snapshot::zigzag_encode(1) == 2);
+            constexpr auto negative = static_cast<uint32_t>(-123456);
+            ASSERT(nnm::snapshot::zigzag_decode(nnm::snapshot::zigzag_encode(negative)) == negative);
+            ASSERT(nnm::snapshot::bit_width(0) == 0);
+            ASSERT(nnm::snapshot::bit_width(5) == 3);
+            ASSERT(nnm::snapshot::bit_width(0xffffffffu) == 32);
+        }
+
+        test_section("pack");
+        {
+            constexpr auto indices = std::make_index_sequence<nnm::snapshot::block_size>();
+            uint32_t values[nnm::snapshot::block_size];
+            uint32_t unpacked[nnm::snapshot::block_size];
+            uint8_t words[nnm::snapshot::block_size * 4] {};
+            for (uint32_t& value : unpacked) {
+                value = 1;
+            }
+            nnm::snapshot::unpack<0>(words, unpacked, indices);
+            ASSERT(std::all_of(std::begin(unpacked), std::end(unpacked), [](const uint32_t v) { return v == 0; }));
+            for (size_t i = 0; i < nnm::snapshot::block_size; ++i) {
+                values[i] = static_cast<uint32_t>(i * 2654435761u) & 0x1fff;
+            }
+            nnm::snapshot::pack<13>(values, words, indices);
+            nnm::snapshot::unpack<13>(words, unpacked, indices);
+            ASSERT(std::equal(std::begin(values), std::end(values), std::begin(unpacked)));
+        }
+
+        test_section("unchanged");
+        {
+            std::vector<uint8_t> bytes;
+            nnm::snapshot::encode_delta(baseline.data(), baseline.size(), baseline.data(), baseline.size(), bytes);
+            ASSERT(bytes.size() == 4 + 4 * nnm::snapshot::channel_count);
+            const auto decoded
+                = nnm::snapshot::decode_delta(bytes.data(), bytes.size(), baseline.data(), baseline.size());
+            ASSERT(decoded.has_value() && *decoded == baseline);
+        }
+
+        test_section("round trip");
+        {
+            std::vector<State> states = baseline;
+            for (size_t i = 0; i < states.size(); i += 3) {
+                states[i] = codec.quantize(translations[i] + nnm::Vector3f(0.01f, -0.2f, 0.0f), rotations[i / 2]);
+            }
+            states.push_back(codec.quantize(nnm::Vector3f(1.0e6f, -1.0e6f, 0.0f), nnm::QuaternionF()));
+            std::vector<uint8_t> bytes;
+            nnm::snapshot::encode_delta(states.data(), states.size(), baseline.data(), baseline.size(), bytes);
+            ASSERT(bytes.size() < states.size() * sizeof(State));
+            const auto decoded
+                = nnm::snapshot::decode_delta(bytes.data(), bytes.size(), baseline.data(), baseline.size());
+            ASSERT(decoded.has_value() && *decoded == states);
+            const auto keyframe = nnm::snapshot::decode_delta(bytes.data(), bytes.size(), nullptr, 0);
+            ASSERT(keyframe.has_value() && *keyframe != states);
+        }
+
+        test_section("malformed");
+        {
+            std::vector<uint8_t> bytes;
+            nnm::snapshot::encode_delta(baseline.data(), 40, nullptr, 0, bytes);
+            ASSERT(nnm::snapshot::decode_delta(bytes.data(), bytes.size(), nullptr, 0).has_value());
+            ASSERT_FALSE(nnm::snapshot::decode_delta(bytes.data(), bytes.size() - 1, nullptr, 0).has_value());
+            ASSERT_FALSE(nnm::snapshot::decode_delta(bytes.data(), 3, nullptr, 0).has_value());
+            bytes.push_back(0);
+            ASSERT_FALSE(nnm::snapshot::decode_delta(bytes.data(), bytes.size(), nullptr, 0).has_value());
+            bytes.pop_back();
+            bytes[4] = 33;
+            ASSERT_FALSE(nnm::snapshot::decode_delta(bytes.data(), bytes.size(), nullptr, 0).has_value());
+        }
+    }
+}
\ No newline at end of file
@@ -2,6 +2,10 @@
 
 #include "test.hpp"
 
+#include <cstring>
+#include <limits>
+#include <vector>
+
 // ReSharper disable CppDFATimeOver
 
 inline void nnm_tests()
@@ -4040,6 +4044,22 @@ inline void nnm_tests()
             ASSERT(rotated_from.approx_equal(to));
         }
 
+        test_section("from_basis");
+        {
+            const nnm::QuaternionF quaternions[] {
+                nnm::QuaternionF::from_axis_angle({ 1.0f, 2.0f, -3.0f }, 0.8f),
+                nnm::QuaternionF::from_axis_angle({ 1.0f, 0.0f, 0.0f }, nnm::pi<float>()),
+                nnm::QuaternionF::from_axis_angle({ 0.0f, 1.0f, 0.1f }, nnm::pi<float>() * 0.9f),
+                nnm::QuaternionF::from_axis_angle({ 0.2f, -0.1f, 1.0f }, -nnm::pi<float>() * 0.95f),
+            };
+            for (const nnm::QuaternionF& q : quaternions) {
+                const auto result = nnm::QuaternionF::from_basis(nnm::Basis3f::from_rotation_quaternion(q));
+                const float dot
+                    = nnm::Vector4f::from_quaternion(result).dot(nnm::Vector4f::from_quaternion(q));
+                ASSERT(nnm::approx_equal(nnm::abs(dot), 1.0f));
+            }
+        }
+
         test_section("normalize");
         {
             constexpr nnm::Quaternion q(1.0f, -2.0f, 3.0f, -4.0f);
@@ -4914,6 +4934,133 @@ inline void nnm_tests()
             ASSERT_FALSE(nnm::Matrix3f::zero().inverse().has_value());
         }
 
+        test_section("symmetric_eigen");
+        {
+            const auto reconstructs = [](const nnm::Matrix3f& matrix, const nnm::Matrix3f::SymmetricEigen& eigen) {
+                const nnm::Matrix3f& v = eigen.vectors.matrix;
+                const nnm::Matrix3f d { { eigen.values.x, 0.0f, 0.0f },
+                                        { 0.0f, eigen.values.y, 0.0f },
+                                        { 0.0f, 0.0f, eigen.values.z } };
+                const nnm::Matrix3f diff = v * d * v.transpose() - matrix;
+                return diff.approx_zero() && (v.transpose() * v).approx_equal(nnm::Matrix3f::identity())
+                    && nnm::approx_equal(v.determinant(), 1.0f) && eigen.values.x >= eigen.values.y
+                    && eigen.values.y >= eigen.values.z;
+            };
+
+            const nnm::Matrix3f m { { 4.0f, 1.0f, -2.0f }, { 1.0f, 2.0f, 0.0f }, { -2.0f, 0.0f, 3.0f } };
+            const auto e1 = m.symmetric_eigen();
+            ASSERT(reconstructs(m, e1));
+            ASSERT(nnm::approx_equal(e1.values.x + e1.values.y + e1.values.z, m.trace()));
+            ASSERT(nnm::approx_equal(e1.values.x * e1.values.y * e1.values.z, m.determinant()));
+
+            const auto e2 = nnm::Matrix3f::zero().symmetric_eigen();
+            ASSERT(e2.values == nnm::Vector3f::zero());
+            ASSERT(reconstructs(nnm::Matrix3f::zero(), e2));
+
+            const auto e3 = nnm::Matrix3f::identity().symmetric_eigen();
+            ASSERT(e3.values == nnm::Vector3f::one());
+            ASSERT(e3.vectors == nnm::Basis3f());
+
+            const nnm::Matrix3f diagonal { { 1.0f, 0.0f, 0.0f }, { 0.0f, -3.0f, 0.0f }, { 0.0f, 0.0f, 5.0f } };
+            const auto e4 = diagonal.symmetric_eigen();
+            ASSERT(e4.values == nnm::Vector3f(5.0f, 1.0f, -3.0f));
+            ASSERT(reconstructs(diagonal, e4));
+
+            const nnm::Vector3f axis = nnm::Vector3f(1.0f, -2.0f, 0.5f).normalize();
+            const nnm::Matrix3f rank_one = axis.outer(axis) * 3.0f;
+            const auto e5 = rank_one.symmetric_eigen();
+            ASSERT(e5.values.approx_equal({ 3.0f, 0.0f, 0.0f }));
+            ASSERT(nnm::approx_equal(nnm::abs(e5.vectors.at(0).dot(axis)), 1.0f));
+            ASSERT(reconstructs(rank_one, e5));
+
+            const nnm::Matrix3f repeated = nnm::Matrix3f::identity() * 2.0f + rank_one;
+            const auto e6 = repeated.symmetric_eigen();
+            ASSERT(e6.values.approx_equal({ 5.0f, 2.0f, 2.0f }));
+            ASSERT(reconstructs(repeated, e6));
+
+            const auto rotation = nnm::Basis3f::from_rotation_axis_angle({ 0.3f, 1.0f, -0.7f }, 1.1f).matrix;
+            const nnm::Matrix3f close
+                = rotation * nnm::Matrix3f({ 1.0f, 0.0f, 0.0f }, { 0.0f, 1.0001f, 0.0f }, { 0.0f, 0.0f, 7.0f })
+                * rotation.transpose();
+            ASSERT(reconstructs(close, close.symmetric_eigen()));
+
+            nnm::Matrix3f lower = m;
+            lower.at(1, 0) = 100.0f;
+            lower.at(2, 0) = 100.0f;
+            lower.at(2, 1) = 100.0f;
+            ASSERT(lower.symmetric_eigen().values == e1.values);
+        }
+
+        test_section("symmetric_eigen_batch");
+        {
+            const nnm::Matrix3d matrices[3] {
+                { { 4.0, 1.0, -2.0 }, { 1.0, 2.0, 0.0 }, { -2.0, 0.0, 3.0 } },
+                nnm::Matrix3d::zero(),
+                { { 2.0, 1.0, 0.0 }, { 1.0, 2.0, 1.0 }, { 0.0, 1.0, 2.0 } },
+            };
+            nnm::Matrix3d::SymmetricEigen results[3];
+            nnm::symmetric_eigen_batch(matrices, 3, results);
+            for (int i = 0; i < 3; ++i) {
+                ASSERT(results[i].values == matrices[i].symmetric_eigen().values);
+                ASSERT(results[i].vectors == matrices[i].symmetric_eigen().vectors);
+            }
+            const double sqrt2 = nnm::sqrt(2.0);
+            ASSERT(results[2].values.approx_equal({ 2.0 + sqrt2, 2.0, 2.0 - sqrt2 }));
+        }
+
+        test_section("singular_value_decomposition");
+        {
+            const auto reconstructs = [](const nnm::Matrix3f& matrix) {
+                const auto svd = matrix.singular_value_decomposition();
+                const nnm::Matrix3f& u = svd.u.matrix;
+                const nnm::Matrix3f& v = svd.v.matrix;
+                const nnm::Matrix3f s { { svd.singular_values.x, 0.0f, 0.0f },
+                                        { 0.0f, svd.singular_values.y, 0.0f },
+                                        { 0.0f, 0.0f, svd.singular_values.z } };
+                return (u * s * v.transpose() - matrix).approx_zero()
+                    && (u.transpose() * u).approx_equal(nnm::Matrix3f::identity())
+                    && (v.transpose() * v).approx_equal(nnm::Matrix3f::identity())
+                    && nnm::approx_equal(u.determinant(), 1.0f) && nnm::approx_equal(v.determinant(), 1.0f)
+                    && svd.singular_values.x >= svd.singular_values.y
+                    && svd.singular_values.y >= nnm::abs(svd.singular_values.z);
+            };
+            ASSERT(reconstructs(m1));
+            ASSERT(reconstructs(m1 * -1.0f));
+            ASSERT(reconstructs(nnm::Matrix3f::identity()));
+            ASSERT(reconstructs(nnm::Matrix3f::zero()));
+            ASSERT(reconstructs(nnm::Vector3f(1.0f, 2.0f, -1.0f).outer({ 0.5f, -3.0f, 2.0f })));
+            ASSERT(reconstructs(nnm::Basis3f::from_rotation_axis_angle({ 1.0f, 1.0f, 0.0f }, 0.7f).matrix));
+            ASSERT(reconstructs({ { 1.0f, 2.0f, 3.0f }, { 4.0f, 5.0f, 6.0f }, { 7.0f, 8.0f, 9.0f } }));
+            const auto svd = nnm::Matrix3f({ 3.0f, 0.0f, 0.0f }, { 0.0f, -5.0f, 0.0f }, { 0.0f, 0.0f, 2.0f })
+                                 .singular_value_decomposition();
+            ASSERT(svd.singular_values.approx_equal({ 5.0f, 3.0f, -2.0f }));
+        }
+
+        test_section("polar_decomposition");
+        {
+            const auto rotation = nnm::Basis3f::from_rotation_axis_angle({ 0.2f, -1.0f, 0.5f }, 2.0f);
+            const nnm::Matrix3f stretch { { 2.0f, 0.5f, 0.0f }, { 0.5f, 1.0f, 0.25f }, { 0.0f, 0.25f, 3.0f } };
+            const auto polar = (rotation.matrix * stretch).polar_decomposition();
+            ASSERT(polar.rotation.approx_equal(rotation));
+            ASSERT(polar.stretch.approx_equal(stretch));
+            const auto polar_m1 = m1.polar_decomposition();
+            ASSERT((polar_m1.rotation.matrix * polar_m1.stretch).approx_equal(m1));
+            ASSERT(polar_m1.stretch.approx_equal(polar_m1.stretch.transpose()));
+        }
+
+        test_section("singular_value_decomposition_batch");
+        {
+            const nnm::Matrix3d matrices[2] { nnm::Matrix3d(m1), nnm::Matrix3d::identity() * 2.0 };
+            nnm::Matrix3d::SingularValueDecomposition results[2];
+            nnm::singular_value_decomposition_batch(matrices, 2, results);
+            for (int i = 0; i < 2; ++i) {
+                const auto expected = matrices[i].singular_value_decomposition();
+                ASSERT(results[i].u == expected.u);
+                ASSERT(results[i].singular_values == expected.singular_values);
+                ASSERT(results[i].v == expected.v);
+            }
+        }
+
         test_section("approx_equal");
         {
             constexpr nnm::Matrix3f almost_ident(
@@ -5538,6 +5685,46 @@ inline void nnm_tests()
             ASSERT(b4.valid());
         }
 
+        test_section("orthonormalize");
+        {
+            const auto rotation = nnm::Basis3f::from_rotation_axis_angle({ 1.0f, 2.0f, 3.0f }, 0.4f);
+            ASSERT(rotation.orthonormalize().approx_equal(rotation));
+            nnm::Basis3f drifted = rotation;
+            drifted.at(0, 1) += 0.01f;
+            drifted.at(2, 2) *= 1.02f;
+            const auto result = drifted.orthonormalize();
+            ASSERT((result.matrix.transpose() * result.matrix).approx_equal(nnm::Matrix3f::identity()));
+            ASSERT(nnm::approx_equal(result.determinant(), 1.0f));
+            ASSERT(nnm::Basis3f::from_scale({ 2.0f, 3.0f, 0.5f }).orthonormalize().approx_equal(nnm::Basis3f()));
+        }
+
+        test_section("closest_rotation");
+        {
+            const auto rotation = nnm::Basis3f::from_rotation_axis_angle({ -1.0f, 0.5f, 2.0f }, 1.3f);
+            const nnm::Vector3f from[5] { { 1.0f, 0.0f, 0.0f },
+                                          { 0.0f, 2.0f, 0.0f },
+                                          { 0.0f, 0.0f, 3.0f },
+                                          { 1.0f, -1.0f, 1.0f },
+                                          { 4.0f, 1.0f, -2.0f } };
+            nnm::Vector3f to[5];
+            for (int i = 0; i < 5; ++i) {
+                to[i] = from[i].transform(rotation) + nnm::Vector3f(10.0f, -3.0f, 2.0f);
+            }
+            ASSERT(nnm::Basis3f::closest_rotation(from, to, 5).approx_equal(rotation));
+            ASSERT(nnm::Basis3f::closest_rotation(from, from, 5).approx_equal(nnm::Basis3f()));
+            ASSERT(nnm::Basis3f::closest_rotation(from, to, 0) == nnm::Basis3f());
+        }
+
+        test_section("orthonormalize_batch");
+        {
+            nnm::Basis3f bases[2] { nnm::Basis3f::from_scale({ 2.0f, 2.0f, 2.0f }),
+                                    nnm::Basis3f::from_rotation_axis_angle({ 0.0f, 1.0f, 0.0f }, 1.0f) };
+            const nnm::Basis3f expected[2] { bases[0].orthonormalize(), bases[1].orthonormalize() };
+            nnm::orthonormalize_batch(bases, 2);
+            ASSERT(bases[0] == expected[0]);
+            ASSERT(bases[1] == expected[1]);
+        }
+
         test_section("rotate_axis_angle");
         {
             auto b1 = nnm::Basis3f::from_rotation_axis_angle({ 1.0f, 0.0f, 0.0f }, nnm::pi<float>() / 2.0f);
@@ -6668,4 +6855,1986 @@ inline void nnm_tests()
             ASSERT_FALSE(t2 < t1);
         }
     }
+
+    test_case("TransformTRS3");
+    {
+        static_assert(sizeof(nnm::TransformTRS3f) == 40);
+
+        const auto q1 = nnm::QuaternionF::from_axis_angle({ 1.0f, 2.0f, -0.5f }, nnm::pi<float>() / 5.0f);
+        const auto q2 = nnm::QuaternionF::from_axis_angle({ -0.3f, 0.0f, 1.0f }, -nnm::pi<float>() / 3.0f);
+        const nnm::TransformTRS3f t1({ 1.0f, -2.0f, 3.0f }, q1, nnm::Vector3f::all(2.0f));
+        const nnm::TransformTRS3f t2({ -0.5f, 4.0f, 0.25f }, q2, nnm::Vector3f::all(0.5f));
+        constexpr nnm::Vector3f p { 0.5f, -1.5f, 2.0f };
+
+        test_section("TransformTRS3()");
+        {
+            constexpr nnm::TransformTRS3f t;
+            ASSERT(t.translation == nnm::Vector3f::zero());
+            ASSERT(t.rotation == nnm::QuaternionF::identity());
+            ASSERT(t.scale == nnm::Vector3f::one());
+        }
+
+        test_section("TransformTRS3(const TransformTRS3<Other>&)");
+        {
+            constexpr nnm::TransformTRS3d t1d({ 1.0, 2.0, 3.0 }, { 0.0, 0.0, 0.0, 1.0 }, { 4.0, 5.0, 6.0 });
+            constexpr nnm::TransformTRS3f t(t1d);
+            ASSERT(t.translation == nnm::Vector3f(1.0f, 2.0f, 3.0f));
+            ASSERT(t.rotation == nnm::QuaternionF::identity());
+            ASSERT(t.scale == nnm::Vector3f(4.0f, 5.0f, 6.0f));
+        }
+
+        test_section("from_translation");
+        {
+            constexpr auto t = nnm::TransformTRS3f::from_translation({ 1.0f, -2.0f, 3.0f });
+            ASSERT(t.transform_point(p) == nnm::Vector3f(1.5f, -3.5f, 5.0f));
+            ASSERT(t.transform_direction(p) == p);
+        }
+
+        test_section("from_rotation_axis_angle");
+        {
+            const auto t
+                = nnm::TransformTRS3f::from_rotation_axis_angle({ 1.0f, 2.0f, -0.5f }, nnm::pi<float>() / 5.0f);
+            ASSERT(t.rotation.approx_equal(q1));
+        }
+
+        test_section("from_rotation_quaternion");
+        {
+            const auto t = nnm::TransformTRS3f::from_rotation_quaternion(q1);
+            ASSERT(t.transform_point(p).approx_equal(p.rotate_quaternion(q1)));
+        }
+
+        test_section("from_scale");
+        {
+            constexpr auto t = nnm::TransformTRS3f::from_scale({ 2.0f, -1.0f, 0.5f });
+            ASSERT(t.transform_point(p) == nnm::Vector3f(1.0f, 1.5f, 1.0f));
+        }
+
+        test_section("uniform_scale");
+        {
+            ASSERT(t1.uniform_scale());
+            ASSERT_FALSE(nnm::TransformTRS3f::from_scale({ 1.0f, 2.0f, 1.0f }).uniform_scale());
+        }
+
+        test_section("valid");
+        {
+            ASSERT(t1.valid());
+            ASSERT_FALSE(nnm::TransformTRS3f::from_scale({ 1.0f, 0.0f, 1.0f }).valid());
+        }
+
+        test_section("unchecked_inverse");
+        {
+            const auto inv = t1.unchecked_inverse();
+            ASSERT(inv.transform_point(t1.transform_point(p)).approx_equal(p));
+            ASSERT(t1.transform(inv).approx_equal(nnm::TransformTRS3f()));
+        }
+
+        test_section("inverse");
+        {
+            ASSERT(t1.inverse().has_value());
+            ASSERT(t1.inverse()->approx_equal(t1.unchecked_inverse()));
+            ASSERT_FALSE(nnm::TransformTRS3f::from_scale({ 0.0f, 1.0f, 1.0f }).inverse().has_value());
+        }
+
+        test_section("translate");
+        {
+            const auto t = t1.translate({ 1.0f, 1.0f, 1.0f });
+            ASSERT(t.transform_point(p).approx_equal(t1.transform_point(p) + nnm::Vector3f::one()));
+        }
+
+        test_section("translate_local");
+        {
+            const auto t = t1.translate_local({ 1.0f, 1.0f, 1.0f });
+            ASSERT(t.transform_point(p).approx_equal(t1.transform_point(p + nnm::Vector3f::one())));
+        }
+
+        test_section("rotate_axis_angle");
+        {
+            const auto t = t1.rotate_axis_angle({ -0.3f, 0.0f, 1.0f }, -nnm::pi<float>() / 3.0f);
+            ASSERT(t.transform_point(p).approx_equal(t1.transform_point(p).rotate_quaternion(q2)));
+        }
+
+        test_section("rotate_axis_angle_local");
+        {
+            const auto t = t1.rotate_axis_angle_local({ -0.3f, 0.0f, 1.0f }, -nnm::pi<float>() / 3.0f);
+            ASSERT(t.transform_point(p).approx_equal(t1.transform_point(p.rotate_quaternion(q2))));
+        }
+
+        test_section("rotate_quaternion");
+        {
+            const auto t = t1.rotate_quaternion(q2);
+            ASSERT(t.transform_point(p).approx_equal(t1.transform_point(p).rotate_quaternion(q2)));
+        }
+
+        test_section("rotate_quaternion_local");
+        {
+            const auto t = t1.rotate_quaternion_local(q2);
+            ASSERT(t.transform_point(p).approx_equal(t1.transform_point(p.rotate_quaternion(q2))));
+        }
+
+        test_section("scale_local");
+        {
+            const auto t = t1.scale_local({ 1.0f, 2.0f, -1.0f });
+            ASSERT(t.transform_point(p).approx_equal(t1.transform_point(p * nnm::Vector3f(1.0f, 2.0f, -1.0f))));
+        }
+
+        test_section("transform");
+        {
+            const auto t = t1.transform(t2);
+            ASSERT(t.transform_point(p).approx_equal(t2.transform_point(t1.transform_point(p))));
+            ASSERT(t.transform3().approx_equal(t1.transform3().transform(t2.transform3())));
+        }
+
+        test_section("transform_local");
+        {
+            const auto t = t1.transform_local(t2);
+            ASSERT(t.transform_point(p).approx_equal(t1.transform_point(t2.transform_point(p))));
+            ASSERT(t.transform3().approx_equal(t1.transform3().transform_local(t2.transform3())));
+        }
+
+        test_section("transform_point");
+        {
+            ASSERT(t1.transform_point(p).approx_equal(p.transform(t1.transform3())));
+        }
+
+        test_section("transform_direction");
+        {
+            ASSERT(t1.transform_direction(p).approx_equal(p.transform(t1.transform3(), 0.0f)));
+        }
+
+        test_section("interpolate");
+        {
+            ASSERT(t1.interpolate(t2, 0.0f).approx_equal(t1));
+            ASSERT(t1.interpolate(t2, 1.0f).approx_equal(t2));
+            const auto t = t1.interpolate(t2, 0.5f);
+            ASSERT(t.translation.approx_equal({ 0.25f, 1.0f, 1.625f }));
+            ASSERT(t.rotation.approx_equal(q1.slerp(q2, 0.5f)));
+            ASSERT(t.scale.approx_equal(nnm::Vector3f::all(1.25f)));
+        }
+
+        test_section("basis");
+        {
+            const auto b = nnm::TransformTRS3f({ 1.0f, 2.0f, 3.0f }, q1, { 2.0f, 3.0f, 4.0f }).basis();
+            ASSERT(b.approx_equal(nnm::Basis3f::from_scale({ 2.0f, 3.0f, 4.0f }).rotate_quaternion(q1)));
+        }
+
+        test_section("transform3");
+        {
+            const auto t = nnm::TransformTRS3f({ 1.0f, 2.0f, 3.0f }, q1, { 2.0f, 3.0f, 4.0f }).transform3();
+            const auto expected = nnm::Transform3f::from_scale({ 2.0f, 3.0f, 4.0f })
+                                      .rotate_quaternion(q1)
+                                      .translate({ 1.0f, 2.0f, 3.0f });
+            ASSERT(t.approx_equal(expected));
+        }
+
+        test_section("approx_equal");
+        {
+            const nnm::TransformTRS3f t(t1.translation + nnm::Vector3f::all(0.000001f), t1.rotation, t1.scale);
+            ASSERT(t.approx_equal(t1));
+            ASSERT_FALSE(t1.approx_equal(t2));
+        }
+
+        test_section("operator==");
+        {
+            ASSERT(t1 == t1);
+            ASSERT_FALSE(t1 == t2);
+        }
+
+        test_section("operator!=");
+        {
+            ASSERT(t1 != t2);
+            ASSERT_FALSE(t1 != t1);
+        }
+    }
+
+    test_case("OBB3");
+    {
+        const auto rotation = nnm::Basis3f::from_rotation_axis_angle(nnm::Vector3f::axis_z(), nnm::pi<float>() / 4.0f);
+        const nnm::OBB3f b1({ 1.0f, 2.0f, 3.0f }, rotation, { 2.0f, 1.0f, 0.5f });
+
+        test_section("OBB3()");
+        {
+            constexpr nnm::OBB3f b;
+            ASSERT(b.center == nnm::Vector3f::zero());
+            ASSERT(b.rotation == nnm::Basis3f());
+            ASSERT(b.half_extents == nnm::Vector3f::zero());
+        }
+
+        test_section("OBB3(const OBB3<Other>&)");
+        {
+            constexpr nnm::OBB3d bd({ 1.0, 2.0, 3.0 }, nnm::Basis3d(), { 4.0, 5.0, 6.0 });
+            constexpr nnm::OBB3f b(bd);
+            ASSERT(b.center == nnm::Vector3f(1.0f, 2.0f, 3.0f));
+            ASSERT(b.rotation == nnm::Basis3f());
+            ASSERT(b.half_extents == nnm::Vector3f(4.0f, 5.0f, 6.0f));
+        }
+
+        test_section("from_transform_aabb");
+        {
+            const auto transform = nnm::Transform3f::from_scale({ 2.0f, 1.0f, 3.0f })
+                                       .rotate_axis_angle(nnm::Vector3f::axis_z(), nnm::pi<float>() / 4.0f)
+                                       .translate({ 1.0f, 2.0f, 3.0f });
+            const auto b = nnm::OBB3f::from_transform_aabb(transform, { -1.0f, -1.0f, -1.0f }, { 1.0f, 1.0f, 1.0f });
+            ASSERT(b.center.approx_equal({ 1.0f, 2.0f, 3.0f }));
+            ASSERT(b.rotation.approx_equal(rotation));
+            ASSERT(b.half_extents.approx_equal({ 2.0f, 1.0f, 3.0f }));
+            const auto b2
+                = nnm::OBB3f::from_transform_aabb(nnm::Transform3f(), { 0.0f, 0.0f, 0.0f }, { 2.0f, 4.0f, 6.0f });
+            ASSERT(b2.center.approx_equal({ 1.0f, 2.0f, 3.0f }));
+            ASSERT(b2.half_extents.approx_equal({ 1.0f, 2.0f, 3.0f }));
+        }
+
+        test_section("fit_points");
+        {
+            nnm::Vector3f points[8];
+            for (int i = 0; i < 8; ++i) {
+                const nnm::Vector3f corner { i & 1 ? 2.0f : -2.0f, i & 2 ? 1.0f : -1.0f, i & 4 ? 0.5f : -0.5f };
+                points[i] = corner.transform(rotation) + nnm::Vector3f(1.0f, 2.0f, 3.0f);
+            }
+            const auto b = nnm::OBB3f::fit_points(points, 8);
+            ASSERT(b.center.approx_equal({ 1.0f, 2.0f, 3.0f }));
+            ASSERT(b.half_extents.approx_equal({ 2.0f, 1.0f, 0.5f }));
+            for (const auto& point : points) {
+                ASSERT(b.local_point(point).abs().approx_equal(b.half_extents));
+            }
+            ASSERT(nnm::OBB3f::fit_points(points, 0) == nnm::OBB3f());
+            const auto single = nnm::OBB3f::fit_points(points, 1);
+            ASSERT(single.center.approx_equal(points[0]));
+            ASSERT(single.half_extents.approx_zero());
+        }
+
+        test_section("local_point");
+        {
+            ASSERT(b1.local_point({ 1.0f, 2.0f, 3.0f }).approx_zero());
+            const auto local = b1.local_point(nnm::Vector3f(1.0f, 1.0f, 3.5f) + nnm::Vector3f(1.0f, 2.0f, 0.0f));
+            ASSERT(local.approx_equal({ nnm::sqrt(2.0f), 0.0f, 0.5f }));
+        }
+
+        test_section("contains");
+        {
+            ASSERT(b1.contains({ 1.0f, 2.0f, 3.0f }));
+            ASSERT(b1.contains({ 2.0f, 3.0f, 3.4f }));
+            ASSERT_FALSE(b1.contains({ 2.0f, 3.0f, 3.6f }));
+            ASSERT_FALSE(b1.contains({ 2.0f, 1.0f, 3.0f }));
+        }
+
+        test_section("intersects");
+        {
+            ASSERT(b1.intersects(b1));
+            const nnm::OBB3f b2({ 3.0f, 3.0f, 3.0f }, nnm::Basis3f(), { 0.5f, 0.5f, 0.5f });
+            ASSERT(b1.intersects(b2));
+            ASSERT(b2.intersects(b1));
+            const nnm::OBB3f b3({ 2.5f, 0.0f, 3.0f }, nnm::Basis3f(), { 0.5f, 0.5f, 0.5f });
+            ASSERT_FALSE(b1.intersects(b3));
+            ASSERT_FALSE(b3.intersects(b1));
+            const nnm::OBB3f b4({ 1.0f, 2.0f, 4.1f }, nnm::Basis3f(), { 10.0f, 10.0f, 0.5f });
+            ASSERT_FALSE(b1.intersects(b4));
+            const nnm::OBB3f b5({ 1.0f, 2.0f, 3.9f }, nnm::Basis3f(), { 10.0f, 10.0f, 0.5f });
+            ASSERT(b1.intersects(b5));
+            const nnm::OBB3f edge_a(
+                { 0.0f, 0.0f, 0.0f },
+                nnm::Basis3f::from_rotation_axis_angle(nnm::Vector3f::axis_x(), nnm::pi<float>() / 4.0f),
+                { 1.0f, 1.0f, 1.0f });
+            const nnm::OBB3f edge_b(
+                { 0.0f, 2.9f, 0.0f },
+                nnm::Basis3f::from_rotation_axis_angle(nnm::Vector3f::axis_z(), nnm::pi<float>() / 4.0f),
+                { 1.0f, 1.0f, 1.0f });
+            ASSERT_FALSE(edge_a.intersects(edge_b));
+            const nnm::OBB3f edge_c({ 0.0f, 2.7f, 0.0f }, edge_b.rotation, edge_b.half_extents);
+            ASSERT(edge_a.intersects(edge_c));
+        }
+
+        test_section("intersect_ray");
+        {
+            const auto hit = b1.intersect_ray({ 1.0f, 2.0f, 10.0f }, { 0.0f, 0.0f, -2.0f });
+            ASSERT(hit.has_value() && nnm::approx_equal(*hit, 3.25f));
+            const auto inside = b1.intersect_ray({ 1.0f, 2.0f, 3.0f }, { 1.0f, 0.0f, 0.0f });
+            ASSERT(inside.has_value() && *inside == 0.0f);
+            ASSERT_FALSE(b1.intersect_ray({ 1.0f, 2.0f, 10.0f }, { 0.0f, 0.0f, 1.0f }).has_value());
+            ASSERT_FALSE(b1.intersect_ray({ 5.0f, 2.0f, 10.0f }, { 0.0f, 0.0f, -1.0f }).has_value());
+            const auto diagonal = b1.intersect_ray({ 1.0f - 10.0f, 2.0f - 10.0f, 3.0f }, { 1.0f, 1.0f, 0.0f });
+            ASSERT(diagonal.has_value() && nnm::approx_equal(*diagonal, 10.0f - nnm::sqrt(2.0f)));
+        }
+
+        test_section("intersects_frustum");
+        {
+            const auto projection = nnm::Transform3f::from_perspective_right_hand_neg1to1(
+                nnm::radians(90.0f), 1.0f, 0.1f, 100.0f);
+            const nnm::OBB3f ahead({ 0.0f, 0.0f, 10.0f }, rotation, { 1.0f, 1.0f, 1.0f });
+            ASSERT(ahead.intersects_frustum(projection));
+            const nnm::OBB3f behind({ 0.0f, 0.0f, -10.0f }, rotation, { 1.0f, 1.0f, 1.0f });
+            ASSERT_FALSE(behind.intersects_frustum(projection));
+            const nnm::OBB3f left({ -15.0f, 0.0f, 10.0f }, rotation, { 1.0f, 1.0f, 1.0f });
+            ASSERT_FALSE(left.intersects_frustum(projection));
+            const nnm::OBB3f far({ 0.0f, 0.0f, 200.0f }, rotation, { 1.0f, 1.0f, 1.0f });
+            ASSERT_FALSE(far.intersects_frustum(projection));
+            const nnm::OBB3f straddling({ -10.5f, 0.0f, 10.0f }, rotation, { 1.0f, 1.0f, 1.0f });
+            ASSERT(straddling.intersects_frustum(projection));
+        }
+
+        test_section("approx_equal");
+        {
+            const nnm::OBB3f b(b1.center + nnm::Vector3f::all(0.000001f), b1.rotation, b1.half_extents);
+            ASSERT(b.approx_equal(b1));
+            ASSERT_FALSE(b1.approx_equal(nnm::OBB3f()));
+        }
+
+        test_section("operator==");
+        {
+            ASSERT(b1 == b1);
+            ASSERT_FALSE(b1 == nnm::OBB3f());
+        }
+
+        test_section("operator!=");
+        {
+            ASSERT(b1 != nnm::OBB3f());
+            ASSERT_FALSE(b1 != b1);
+        }
+
+        test_section("intersects_batch");
+        {
+            const nnm::OBB3f boxes[3] { b1,
+                                        { { 3.0f, 3.0f, 3.0f }, nnm::Basis3f(), { 0.5f, 0.5f, 0.5f } },
+                                        { { 2.5f, 0.0f, 3.0f }, nnm::Basis3f(), { 0.5f, 0.5f, 0.5f } } };
+            const nnm::Vector2u32 pairs[3] { { 0, 1 }, { 0, 2 }, { 1, 2 } };
+            bool results[3];
+            nnm::intersects_batch(boxes, pairs, 3, results);
+            ASSERT(results[0]);
+            ASSERT_FALSE(results[1]);
+            ASSERT_FALSE(results[2]);
+        }
+    }
+
+    test_case("Ray3");
+    {
+        test_section("Ray3()");
+        {
+            const nnm::Ray3f r;
+            ASSERT(r.origin == nnm::Vector3f::zero());
+            ASSERT(r.direction == nnm::Vector3f::axis_z());
+        }
+
+        test_section("Ray3(const Vector3&, const Vector3&)");
+        {
+            const nnm::Ray3f r({ 1.0f, 2.0f, 3.0f }, { 2.0f, -4.0f, 0.5f });
+            ASSERT(r.origin == nnm::Vector3f(1.0f, 2.0f, 3.0f));
+            ASSERT(r.direction == nnm::Vector3f(2.0f, -4.0f, 0.5f));
+            ASSERT(r.inverse_direction.approx_equal({ 0.5f, -0.25f, 2.0f }));
+        }
+
+        test_section("Ray3(const Ray3<Other>&)");
+        {
+            const nnm::Ray3d r1({ 1.0, 2.0, 3.0 }, { 2.0, -4.0, 0.5 });
+            const nnm::Ray3f r2(r1);
+            ASSERT(r2.approx_equal({ { 1.0f, 2.0f, 3.0f }, { 2.0f, -4.0f, 0.5f } }));
+            ASSERT(r2.inverse_direction.approx_equal({ 0.5f, -0.25f, 2.0f }));
+        }
+
+        test_section("from_points");
+        {
+            const auto r = nnm::Ray3f::from_points({ 1.0f, 2.0f, 3.0f }, { 4.0f, 2.0f, 1.0f });
+            ASSERT(r.origin == nnm::Vector3f(1.0f, 2.0f, 3.0f));
+            ASSERT(r.point_at(1.0f).approx_equal({ 4.0f, 2.0f, 1.0f }));
+        }
+
+        test_section("point_at");
+        {
+            const nnm::Ray3f r({ 1.0f, 2.0f, 3.0f }, { 2.0f, -4.0f, 0.5f });
+            ASSERT(r.point_at(0.0f) == r.origin);
+            ASSERT(r.point_at(2.0f).approx_equal({ 5.0f, -6.0f, 4.0f }));
+        }
+
+        const nnm::Vector3f v0 { -1.0f, -1.0f, 5.0f };
+        const nnm::Vector3f v1 { 3.0f, -1.0f, 5.0f };
+        const nnm::Vector3f v2 { -1.0f, 3.0f, 5.0f };
+
+        test_section("intersect_triangle");
+        {
+            const nnm::Ray3f r1({ 0.0f, 0.0f, 1.0f }, { 0.0f, 0.0f, 2.0f });
+            const auto hit = r1.intersect_triangle(v0, v1, v2);
+            ASSERT(hit.has_value() && nnm::approx_equal(*hit, 2.0f));
+            const auto back = r1.intersect_triangle(v0, v2, v1);
+            ASSERT(back.has_value() && nnm::approx_equal(*back, 2.0f));
+            ASSERT_FALSE(nnm::Ray3f({ 0.0f, 0.0f, 6.0f }, { 0.0f, 0.0f, 1.0f }).intersect_triangle(v0, v1, v2));
+            ASSERT_FALSE(nnm::Ray3f({ 2.0f, 2.0f, 0.0f }, { 0.0f, 0.0f, 1.0f }).intersect_triangle(v0, v1, v2));
+            ASSERT_FALSE(nnm::Ray3f({ -2.0f, 0.0f, 0.0f }, { 0.0f, 0.0f, 1.0f }).intersect_triangle(v0, v1, v2));
+            ASSERT_FALSE(nnm::Ray3f({ 0.0f, 0.0f, 0.0f }, { 1.0f, 0.0f, 0.0f }).intersect_triangle(v0, v1, v2));
+        }
+
+        test_section("intersect_triangle_watertight");
+        {
+            const nnm::Ray3f r1({ 0.0f, 0.0f, 1.0f }, { 0.0f, 0.0f, 2.0f });
+            const auto hit = r1.intersect_triangle_watertight(v0, v1, v2);
+            ASSERT(hit.has_value() && nnm::approx_equal(*hit, 2.0f));
+            const auto back = r1.intersect_triangle_watertight(v0, v2, v1);
+            ASSERT(back.has_value() && nnm::approx_equal(*back, 2.0f));
+            const nnm::Ray3f r2({ 0.5f, 0.5f, 9.0f }, { 0.1f, -0.2f, -2.0f });
+            const auto slanted = r2.intersect_triangle_watertight(v0, v1, v2);
+            const auto expected = r2.intersect_triangle(v0, v1, v2);
+            ASSERT(slanted.has_value() && expected.has_value() && nnm::approx_equal(*slanted, *expected));
+            ASSERT_FALSE(
+                nnm::Ray3f({ 0.0f, 0.0f, 6.0f }, { 0.0f, 0.0f, 1.0f }).intersect_triangle_watertight(v0, v1, v2));
+            ASSERT_FALSE(
+                nnm::Ray3f({ 2.0f, 2.0f, 0.0f }, { 0.0f, 0.0f, 1.0f }).intersect_triangle_watertight(v0, v1, v2));
+            // Shared edge from (-1, 3) to (3, -1) must be hit by exactly one or both of the adjacent triangles
+            const nnm::Vector3f v3 { 3.0f, 3.0f, 5.0f };
+            const nnm::Ray3f edge({ 1.0f, 1.0f, 0.0f }, { 0.0f, 0.0f, 1.0f });
+            ASSERT(edge.intersect_triangle_watertight(v0, v1, v2) || edge.intersect_triangle_watertight(v1, v3, v2));
+        }
+
+        test_section("intersect_aabb");
+        {
+            const nnm::Vector3f min { -1.0f, -2.0f, -3.0f };
+            const nnm::Vector3f max { 1.0f, 2.0f, 3.0f };
+            const auto hit = nnm::Ray3f({ 0.0f, 0.0f, -10.0f }, { 0.0f, 0.0f, 2.0f }).intersect_aabb(min, max);
+            ASSERT(hit.has_value() && nnm::approx_equal(*hit, 3.5f));
+            const auto inside = nnm::Ray3f({ 0.5f, 0.0f, 0.0f }, { 1.0f, 0.0f, 0.0f }).intersect_aabb(min, max);
+            ASSERT(inside.has_value() && *inside == 0.0f);
+            const auto diagonal = nnm::Ray3f({ -3.0f, -3.0f, 0.0f }, { 1.0f, 1.0f, 0.0f }).intersect_aabb(min, max);
+            ASSERT(diagonal.has_value() && nnm::approx_equal(*diagonal, 2.0f));
+            ASSERT_FALSE(nnm::Ray3f({ 0.0f, 0.0f, 10.0f }, { 0.0f, 0.0f, 1.0f }).intersect_aabb(min, max));
+            ASSERT_FALSE(nnm::Ray3f({ 2.0f, 0.0f, -10.0f }, { 0.0f, 0.0f, 1.0f }).intersect_aabb(min, max));
+        }
+
+        test_section("intersect_obb");
+        {
+            const auto rotation
+                = nnm::Basis3f::from_rotation_axis_angle(nnm::Vector3f::axis_z(), nnm::pi<float>() / 4.0f);
+            const nnm::OBB3f box({ 1.0f, 0.0f, 0.0f }, rotation, { 1.0f, 1.0f, 1.0f });
+            const nnm::Ray3f r({ 1.0f, -5.0f, 0.0f }, { 0.0f, 1.0f, 0.0f });
+            const auto hit = r.intersect_obb(box);
+            ASSERT(hit.has_value() && nnm::approx_equal(*hit, 5.0f - nnm::sqrt(2.0f)));
+            ASSERT_FALSE(nnm::Ray3f({ 1.0f, -5.0f, 0.0f }, { 0.0f, -1.0f, 0.0f }).intersect_obb(box));
+        }
+
+        test_section("intersect_sphere");
+        {
+            const nnm::Vector3f center { 1.0f, 2.0f, 3.0f };
+            const auto hit = nnm::Ray3f({ 1.0f, 2.0f, -7.0f }, { 0.0f, 0.0f, 2.0f }).intersect_sphere(center, 2.0f);
+            ASSERT(hit.has_value() && nnm::approx_equal(*hit, 4.0f));
+            const auto inside = nnm::Ray3f({ 1.0f, 2.0f, 2.0f }, { 0.0f, 0.0f, 1.0f }).intersect_sphere(center, 2.0f);
+            ASSERT(inside.has_value() && *inside == 0.0f);
+            ASSERT_FALSE(nnm::Ray3f({ 1.0f, 2.0f, -7.0f }, { 0.0f, 0.0f, -1.0f }).intersect_sphere(center, 2.0f));
+            ASSERT_FALSE(nnm::Ray3f({ 4.0f, 2.0f, -7.0f }, { 0.0f, 0.0f, 1.0f }).intersect_sphere(center, 2.0f));
+            const nnm::Ray3f r({ 1.0f, 2.0f, -7.0f }, { 0.0f, 0.0f, 2.0f });
+            const auto sphere = r.intersect_sphere(nnm::Sphere3f(center, 2.0f));
+            ASSERT(sphere.has_value() && nnm::approx_equal(*sphere, 4.0f));
+        }
+
+        test_section("intersect_plane");
+        {
+            const nnm::Vector3f normal = nnm::Vector3f(0.0f, 1.0f, 1.0f).normalize();
+            const float distance = nnm::sqrt(2.0f);
+            const auto hit = nnm::Ray3f({ 0.0f, 0.0f, 0.0f }, { 0.0f, 1.0f, 0.0f }).intersect_plane(normal, distance);
+            ASSERT(hit.has_value() && nnm::approx_equal(*hit, 2.0f));
+            ASSERT_FALSE(nnm::Ray3f({ 0.0f, 0.0f, 0.0f }, { 0.0f, -1.0f, 0.0f }).intersect_plane(normal, distance));
+            ASSERT_FALSE(nnm::Ray3f({ 0.0f, 0.0f, 0.0f }, { 1.0f, 0.0f, 0.0f }).intersect_plane(normal, distance));
+            const nnm::Ray3f r({ 0.0f, 0.0f, 0.0f }, { 0.0f, 1.0f, 0.0f });
+            const auto plane = r.intersect_plane(nnm::Plane3f(normal, distance));
+            ASSERT(plane.has_value() && nnm::approx_equal(*plane, 2.0f));
+        }
+
+        test_section("approx_equal");
+        {
+            const nnm::Ray3f r1({ 1.0f, 2.0f, 3.0f }, { 2.0f, -4.0f, 0.5f });
+            const nnm::Ray3f r2({ 1.000001f, 2.0f, 3.0f }, { 2.0f, -4.0f, 0.5f });
+            ASSERT(r1.approx_equal(r2));
+            ASSERT_FALSE(r1.approx_equal({ { 1.0f, 2.0f, 3.0f }, { 2.0f, 4.0f, 0.5f } }));
+        }
+
+        test_section("operator==");
+        {
+            const nnm::Ray3f r1({ 1.0f, 2.0f, 3.0f }, { 2.0f, -4.0f, 0.5f });
+            const nnm::Ray3f r2({ 1.0f, 2.0f, 3.0f }, { 2.0f, -4.0f, 0.5f });
+            ASSERT(r1 == r2);
+            ASSERT_FALSE(r1 == nnm::Ray3f());
+        }
+
+        test_section("operator!=");
+        {
+            const nnm::Ray3f r1({ 1.0f, 2.0f, 3.0f }, { 2.0f, -4.0f, 0.5f });
+            const nnm::Ray3f r2({ 1.0f, 2.0f, 3.0f }, { 2.0f, -4.0f, 0.5f });
+            ASSERT_FALSE(r1 != r2);
+            ASSERT(r1 != nnm::Ray3f());
+        }
+    }
+
+    test_case("Ray3Packet");
+    {
+        const nnm::Ray3f rays[4] {
+            { { 0.0f, 0.0f, 1.0f }, { 0.0f, 0.0f, 2.0f } },
+            { { 0.0f, 0.0f, 6.0f }, { 0.0f, 0.0f, 1.0f } },
+            { { 2.0f, 2.0f, 0.0f }, { 0.0f, 0.0f, 1.0f } },
+            { { 0.5f, 0.5f, 9.0f }, { 0.1f, -0.2f, -2.0f } },
+        };
+
+        test_section("Ray3Packet(const Ray3*)");
+        {
+            const nnm::Ray3Packet4f p(rays);
+            for (uint8_t i = 0; i < 4; ++i) {
+                ASSERT(p.ray(i) == rays[i]);
+            }
+        }
+
+        test_section("set");
+        {
+            nnm::Ray3Packet4f p;
+            ASSERT(p.ray(2) == nnm::Ray3f());
+            p.set(2, rays[3]);
+            ASSERT(p.ray(2) == rays[3]);
+            ASSERT(p.inverse_direction_y[2] == rays[3].inverse_direction.y);
+        }
+
+        test_section("intersect_triangle");
+        {
+            const nnm::Vector3f v0 { -1.0f, -1.0f, 5.0f };
+            const nnm::Vector3f v1 { 3.0f, -1.0f, 5.0f };
+            const nnm::Vector3f v2 { -1.0f, 3.0f, 5.0f };
+            const auto hits = nnm::Ray3Packet4f(rays).intersect_triangle(v0, v1, v2);
+            for (uint8_t i = 0; i < 4; ++i) {
+                const auto expected = rays[i].intersect_triangle(v0, v1, v2);
+                ASSERT(hits.hit[i] == expected.has_value());
+                ASSERT(nnm::approx_equal(hits.distance[i], expected.value_or(0.0f)));
+            }
+        }
+
+        test_section("intersect_aabb");
+        {
+            const nnm::Vector3f min { -1.0f, -1.0f, 3.0f };
+            const nnm::Vector3f max { 1.0f, 1.0f, 5.0f };
+            nnm::Ray3Packet8f p;
+            for (uint8_t i = 0; i < 8; ++i) {
+                p.set(i, rays[i % 4]);
+            }
+            const auto hits = p.intersect_aabb(min, max);
+            for (uint8_t i = 0; i < 8; ++i) {
+                const auto expected = rays[i % 4].intersect_aabb(min, max);
+                ASSERT(hits.hit[i] == expected.has_value());
+                ASSERT(nnm::approx_equal(hits.distance[i], expected.value_or(0.0f)));
+            }
+            ASSERT(hits.hit[0]);
+            ASSERT_FALSE(hits.hit[1]);
+            ASSERT_FALSE(hits.hit[2]);
+            ASSERT(hits.hit[3]);
+        }
+    }
+
+    test_case("Plane3");
+    {
+        test_section("Plane3()");
+        {
+            constexpr nnm::Plane3f p;
+            ASSERT(p.normal == nnm::Vector3f::axis_y());
+            ASSERT(p.distance == 0.0f);
+        }
+
+        test_section("Plane3(const Plane3<Other>&)");
+        {
+            constexpr nnm::Plane3d p1({ 0.0, 0.0, 1.0 }, -2.0);
+            constexpr nnm::Plane3f p2(p1);
+            ASSERT(p2 == nnm::Plane3f({ 0.0f, 0.0f, 1.0f }, -2.0f));
+        }
+
+        test_section("from_point_normal");
+        {
+            constexpr auto p = nnm::Plane3f::from_point_normal({ 1.0f, 2.0f, 3.0f }, { 0.0f, 1.0f, 0.0f });
+            ASSERT(p == nnm::Plane3f({ 0.0f, 1.0f, 0.0f }, 2.0f));
+        }
+
+        test_section("from_points");
+        {
+            const auto p = nnm::Plane3f::from_points({ 0.0f, 0.0f, 2.0f }, { 1.0f, 0.0f, 2.0f }, { 0.0f, 1.0f, 2.0f });
+            ASSERT(p.approx_equal({ { 0.0f, 0.0f, 1.0f }, 2.0f }));
+        }
+
+        test_section("normalize");
+        {
+            const nnm::Plane3f p({ 0.0f, 3.0f, 4.0f }, 10.0f);
+            ASSERT(p.normalize().approx_equal({ { 0.0f, 0.6f, 0.8f }, 2.0f }));
+        }
+
+        const nnm::Plane3f p1 { { 0.0f, 1.0f, 0.0f }, 2.0f };
+
+        test_section("signed_distance");
+        {
+            ASSERT(nnm::approx_equal(p1.signed_distance({ 5.0f, 5.0f, -1.0f }), 3.0f));
+            ASSERT(nnm::approx_equal(p1.signed_distance({ 5.0f, -1.0f, -1.0f }), -3.0f));
+            ASSERT(nnm::approx_equal(p1.signed_distance({ 5.0f, 2.0f, -1.0f }), 0.0f));
+        }
+
+        test_section("project_point");
+        {
+            ASSERT(p1.project_point({ 5.0f, 5.0f, -1.0f }).approx_equal({ 5.0f, 2.0f, -1.0f }));
+        }
+
+        test_section("reflect_point");
+        {
+            ASSERT(p1.reflect_point({ 5.0f, 5.0f, -1.0f }).approx_equal({ 5.0f, -1.0f, -1.0f }));
+        }
+
+        test_section("reflect_direction");
+        {
+            ASSERT(p1.reflect_direction({ 1.0f, -1.0f, 0.0f }).approx_equal({ 1.0f, 1.0f, 0.0f }));
+        }
+
+        test_section("intersect_line");
+        {
+            const auto point = p1.intersect_line({ 1.0f, 5.0f, 0.0f }, { 1.0f, 1.0f, 0.0f });
+            ASSERT(point.has_value() && point->approx_equal({ -2.0f, 2.0f, 0.0f }));
+            ASSERT_FALSE(p1.intersect_line({ 1.0f, 5.0f, 0.0f }, { 1.0f, 0.0f, 0.0f }).has_value());
+        }
+
+        test_section("intersect_segment");
+        {
+            const auto point = p1.intersect_segment({ 1.0f, 5.0f, 0.0f }, { 1.0f, 0.0f, 0.0f });
+            ASSERT(point.has_value() && point->approx_equal({ 1.0f, 2.0f, 0.0f }));
+            ASSERT_FALSE(p1.intersect_segment({ 1.0f, 5.0f, 0.0f }, { 1.0f, 3.0f, 0.0f }).has_value());
+            ASSERT_FALSE(p1.intersect_segment({ 1.0f, 5.0f, 0.0f }, { 4.0f, 5.0f, 0.0f }).has_value());
+        }
+
+        test_section("intersect_plane");
+        {
+            const nnm::Plane3f p2 { { 1.0f, 0.0f, 0.0f }, -3.0f };
+            const auto line = p1.intersect_plane(p2);
+            ASSERT(line.has_value());
+            ASSERT(nnm::approx_equal(p1.signed_distance(line->origin), 0.0f));
+            ASSERT(nnm::approx_equal(p2.signed_distance(line->origin), 0.0f));
+            ASSERT(line->direction.normalize().abs().approx_equal(nnm::Vector3f::axis_z()));
+            ASSERT_FALSE(p1.intersect_plane({ { 0.0f, -1.0f, 0.0f }, 1.0f }).has_value());
+        }
+
+        test_section("intersect_planes");
+        {
+            const nnm::Plane3f p2 { { 1.0f, 0.0f, 0.0f }, -3.0f };
+            const nnm::Plane3f p3 = nnm::Plane3f({ 0.0f, 1.0f, 1.0f }, 4.0f).normalize();
+            const auto point = p1.intersect_planes(p2, p3);
+            ASSERT(point.has_value() && point->approx_equal({ -3.0f, 2.0f, 2.0f }));
+            ASSERT_FALSE(p1.intersect_planes(p2, { { 0.0f, 1.0f, 0.0f }, 5.0f }).has_value());
+        }
+
+        test_section("transform");
+        {
+            const auto scaled = p1.transform(nnm::Transform3f::from_scale({ 1.0f, 2.0f, 1.0f }));
+            ASSERT(scaled.approx_equal({ { 0.0f, 1.0f, 0.0f }, 4.0f }));
+            const auto p2
+                = nnm::Plane3f::from_point_normal({ 1.0f, 0.0f, 0.0f }, nnm::Vector3f(1.0f, 1.0f, 0.0f).normalize());
+            const auto stretched = p2.transform(nnm::Transform3f::from_scale({ 2.0f, 1.0f, 1.0f }));
+            ASSERT(stretched.normal.approx_equal(nnm::Vector3f(0.5f, 1.0f, 0.0f).normalize()));
+            ASSERT(nnm::approx_equal(stretched.signed_distance({ 2.0f, 0.0f, 0.0f }), 0.0f));
+            ASSERT(nnm::approx_equal(stretched.signed_distance({ 0.0f, 1.0f, 5.0f }), 0.0f));
+            const auto moved = p1.transform(nnm::Transform3f::from_translation({ 0.0f, 3.0f, 0.0f }));
+            ASSERT(moved.approx_equal({ { 0.0f, 1.0f, 0.0f }, 5.0f }));
+        }
+
+        test_section("approx_equal");
+        {
+            ASSERT(p1.approx_equal({ { 0.0f, 1.0f, 0.0f }, 2.000001f }));
+            ASSERT_FALSE(p1.approx_equal({ { 0.0f, 1.0f, 0.0f }, 2.1f }));
+        }
+
+        test_section("operator==");
+        {
+            ASSERT(p1 == nnm::Plane3f({ 0.0f, 1.0f, 0.0f }, 2.0f));
+            ASSERT_FALSE(p1 == nnm::Plane3f({ 0.0f, 1.0f, 0.0f }, 3.0f));
+        }
+
+        test_section("operator!=");
+        {
+            ASSERT_FALSE(p1 != nnm::Plane3f({ 0.0f, 1.0f, 0.0f }, 2.0f));
+            ASSERT(p1 != nnm::Plane3f({ 1.0f, 0.0f, 0.0f }, 2.0f));
+        }
+
+        test_section("signed_distance_batch");
+        {
+            const nnm::Vector3f points[3] { { 0.0f, 5.0f, 0.0f }, { 1.0f, -1.0f, 2.0f }, { 3.0f, 2.0f, 4.0f } };
+            float results[3];
+            nnm::signed_distance_batch(p1, points, 3, results);
+            for (int i = 0; i < 3; ++i) {
+                ASSERT(results[i] == p1.signed_distance(points[i]));
+            }
+        }
+    }
+
+    test_case("Sphere3");
+    {
+        test_section("Sphere3()");
+        {
+            constexpr nnm::Sphere3f s;
+            ASSERT(s.center == nnm::Vector3f::zero());
+            ASSERT(s.radius == 0.0f);
+        }
+
+        test_section("Sphere3(const Sphere3<Other>&)");
+        {
+            constexpr nnm::Sphere3d s1({ 1.0, 2.0, 3.0 }, 4.0);
+            constexpr nnm::Sphere3f s2(s1);
+            ASSERT(s2 == nnm::Sphere3f({ 1.0f, 2.0f, 3.0f }, 4.0f));
+        }
+
+        const nnm::Vector3f cloud[8] { { 1.0f, 2.0f, 3.0f },  { 0.5f, -1.0f, 2.0f },   { -3.0f, 0.0f, 1.0f },
+                                       { 2.0f, 2.0f, -2.0f }, { 0.0f, 4.0f, 0.0f },    { -1.0f, -1.0f, -1.0f },
+                                       { 2.5f, -0.5f, 0.5f }, { 0.0f, 0.0f, 3.5f } };
+        const auto covers = [&](const nnm::Sphere3f& sphere) {
+            bool result = true;
+            for (const nnm::Vector3f& point : cloud) {
+                result = result && sphere.center.distance(point) <= sphere.radius * 1.00001f;
+            }
+            return result;
+        };
+
+        test_section("from_points_ritter");
+        {
+            const nnm::Vector3f points[6] { { 3.0f, 2.0f, 3.0f }, { -1.0f, 2.0f, 3.0f }, { 1.0f, 4.0f, 3.0f },
+                                            { 1.0f, 0.0f, 3.0f }, { 1.0f, 2.0f, 5.0f },  { 1.0f, 2.0f, 1.0f } };
+            ASSERT(nnm::Sphere3f::from_points_ritter(points, 6).approx_equal({ { 1.0f, 2.0f, 3.0f }, 2.0f }));
+            ASSERT(nnm::Sphere3f::from_points_ritter(points, 0) == nnm::Sphere3f());
+            ASSERT(nnm::Sphere3f::from_points_ritter(points, 1) == nnm::Sphere3f(points[0], 0.0f));
+            ASSERT(covers(nnm::Sphere3f::from_points_ritter(cloud, 8)));
+        }
+
+        test_section("from_points");
+        {
+            const nnm::Vector3f points[6] { { 3.0f, 2.0f, 3.0f }, { -1.0f, 2.0f, 3.0f }, { 1.0f, 4.0f, 3.0f },
+                                            { 1.0f, 0.0f, 3.0f }, { 1.0f, 2.0f, 5.0f },  { 1.0f, 2.0f, 1.0f } };
+            ASSERT(nnm::Sphere3f::from_points(points, 6).approx_equal({ { 1.0f, 2.0f, 3.0f }, 2.0f }));
+            ASSERT(nnm::Sphere3f::from_points(points, 0) == nnm::Sphere3f());
+            const auto sphere = nnm::Sphere3f::from_points(cloud, 8);
+            ASSERT(covers(sphere));
+            ASSERT(sphere.radius <= nnm::Sphere3f::from_points_ritter(cloud, 8).radius);
+            float diameter = 0.0f;
+            for (const nnm::Vector3f& a : cloud) {
+                for (const nnm::Vector3f& b : cloud) {
+                    diameter = nnm::max(diameter, a.distance(b));
+                }
+            }
+            ASSERT(sphere.radius >= diameter / 2.0f);
+            ASSERT(sphere.radius < diameter / 2.0f * 1.2f);
+        }
+
+        const nnm::Sphere3f s1 { { 1.0f, 2.0f, 3.0f }, 2.0f };
+
+        test_section("signed_distance");
+        {
+            ASSERT(nnm::approx_equal(s1.signed_distance({ 1.0f, 2.0f, 8.0f }), 3.0f));
+            ASSERT(nnm::approx_equal(s1.signed_distance({ 1.0f, 2.0f, 3.0f }), -2.0f));
+        }
+
+        test_section("contains");
+        {
+            ASSERT(s1.contains(nnm::Vector3f { 1.0f, 3.5f, 3.0f }));
+            ASSERT_FALSE(s1.contains(nnm::Vector3f { 1.0f, 4.5f, 3.0f }));
+            ASSERT(s1.contains(nnm::Sphere3f({ 1.0f, 3.0f, 3.0f }, 1.0f)));
+            ASSERT_FALSE(s1.contains(nnm::Sphere3f({ 1.0f, 3.5f, 3.0f }, 1.0f)));
+        }
+
+        test_section("intersects");
+        {
+            ASSERT(s1.intersects(nnm::Sphere3f({ 1.0f, 2.0f, 5.5f }, 1.0f)));
+            ASSERT_FALSE(s1.intersects(nnm::Sphere3f({ 1.0f, 2.0f, 6.5f }, 1.0f)));
+            ASSERT(s1.intersects(nnm::Plane3f({ 0.0f, 1.0f, 0.0f }, 3.5f)));
+            ASSERT_FALSE(s1.intersects(nnm::Plane3f({ 0.0f, 1.0f, 0.0f }, 4.5f)));
+            ASSERT(s1.intersects(nnm::Plane3f({ 0.0f, -1.0f, 0.0f }, -0.5f)));
+        }
+
+        test_section("merge");
+        {
+            const auto merged = s1.merge({ { 1.0f, 2.0f, 9.0f }, 1.0f });
+            ASSERT(merged.approx_equal({ { 1.0f, 2.0f, 5.5f }, 4.5f }));
+            ASSERT(s1.merge({ { 1.0f, 2.0f, 3.5f }, 1.0f }) == s1);
+            ASSERT(s1.merge({ { 1.0f, 2.0f, 3.5f }, 5.0f }) == nnm::Sphere3f({ 1.0f, 2.0f, 3.5f }, 5.0f));
+        }
+
+        test_section("approx_equal");
+        {
+            ASSERT(s1.approx_equal({ { 1.0f, 2.0f, 3.000001f }, 2.0f }));
+            ASSERT_FALSE(s1.approx_equal({ { 1.0f, 2.0f, 3.0f }, 2.1f }));
+        }
+
+        test_section("operator==");
+        {
+            ASSERT(s1 == nnm::Sphere3f({ 1.0f, 2.0f, 3.0f }, 2.0f));
+            ASSERT_FALSE(s1 == nnm::Sphere3f({ 1.0f, 2.0f, 3.0f }, 3.0f));
+        }
+
+        test_section("operator!=");
+        {
+            ASSERT_FALSE(s1 != nnm::Sphere3f({ 1.0f, 2.0f, 3.0f }, 2.0f));
+            ASSERT(s1 != nnm::Sphere3f({ 0.0f, 2.0f, 3.0f }, 2.0f));
+        }
+    }
+
+    test_case("AABB3");
+    {
+        test_section("AABB3()");
+        {
+            constexpr nnm::AABB3f b;
+            ASSERT(b.min == nnm::Vector3f::zero());
+            ASSERT(b.max == nnm::Vector3f::zero());
+        }
+
+        test_section("AABB3(const AABB3<Other>&)");
+        {
+            constexpr nnm::AABB3d b1({ -1.0, -2.0, -3.0 }, { 1.0, 2.0, 3.0 });
+            constexpr nnm::AABB3f b2(b1);
+            ASSERT(b2 == nnm::AABB3f({ -1.0f, -2.0f, -3.0f }, { 1.0f, 2.0f, 3.0f }));
+        }
+
+        test_section("from_points");
+        {
+            constexpr nnm::Vector3f points[4] {
+                { 1.0f, -2.0f, 3.0f }, { -4.0f, 5.0f, 0.0f }, { 2.0f, 1.0f, -6.0f }, { 0.0f, 0.0f, 0.0f }
+            };
+            constexpr auto b = nnm::AABB3f::from_points(points, 4);
+            ASSERT(b == nnm::AABB3f({ -4.0f, -2.0f, -6.0f }, { 2.0f, 5.0f, 3.0f }));
+            ASSERT(nnm::AABB3f::from_points(points, 0) == nnm::AABB3f());
+            ASSERT(nnm::AABB3f::from_points(points, 1) == nnm::AABB3f(points[0], points[0]));
+        }
+
+        const nnm::AABB3f b1 { { -1.0f, -2.0f, -3.0f }, { 3.0f, 2.0f, 1.0f } };
+
+        test_section("center");
+        {
+            ASSERT(b1.center() == nnm::Vector3f(1.0f, 0.0f, -1.0f));
+        }
+
+        test_section("size");
+        {
+            ASSERT(b1.size() == nnm::Vector3f(4.0f, 4.0f, 4.0f));
+        }
+
+        test_section("contains");
+        {
+            ASSERT(b1.contains({ 0.0f, 0.0f, 0.0f }));
+            ASSERT(b1.contains({ 3.0f, -2.0f, 1.0f }));
+            ASSERT_FALSE(b1.contains({ 3.1f, 0.0f, 0.0f }));
+            ASSERT_FALSE(b1.contains({ 0.0f, 0.0f, -3.1f }));
+        }
+
+        test_section("intersects");
+        {
+            ASSERT(b1.intersects({ { 2.0f, 1.0f, 0.0f }, { 5.0f, 5.0f, 5.0f } }));
+            ASSERT(b1.intersects({ { 3.0f, 2.0f, 1.0f }, { 5.0f, 5.0f, 5.0f } }));
+            ASSERT_FALSE(b1.intersects({ { 2.0f, 2.5f, 0.0f }, { 5.0f, 5.0f, 5.0f } }));
+        }
+
+        test_section("merge");
+        {
+            const auto merged = b1.merge({ { 0.0f, -5.0f, 0.0f }, { 1.0f, 1.0f, 4.0f } });
+            ASSERT(merged == nnm::AABB3f({ -1.0f, -5.0f, -3.0f }, { 3.0f, 2.0f, 4.0f }));
+        }
+
+        test_section("approx_equal");
+        {
+            ASSERT(b1.approx_equal({ { -1.0f, -2.0f, -3.000001f }, { 3.0f, 2.0f, 1.0f } }));
+            ASSERT_FALSE(b1.approx_equal({ { -1.0f, -2.0f, -3.1f }, { 3.0f, 2.0f, 1.0f } }));
+        }
+
+        test_section("operator==");
+        {
+            ASSERT(b1 == nnm::AABB3f({ -1.0f, -2.0f, -3.0f }, { 3.0f, 2.0f, 1.0f }));
+            ASSERT_FALSE(b1 == nnm::AABB3f());
+        }
+
+        test_section("operator!=");
+        {
+            ASSERT_FALSE(b1 != nnm::AABB3f({ -1.0f, -2.0f, -3.0f }, { 3.0f, 2.0f, 1.0f }));
+            ASSERT(b1 != nnm::AABB3f());
+        }
+    }
+
+    test_case("centroid");
+    {
+        constexpr nnm::Vector3f points[4] {
+            { 1.0f, -2.0f, 3.0f }, { -4.0f, 5.0f, 0.0f }, { 2.0f, 1.0f, -6.0f }, { 5.0f, 0.0f, 7.0f }
+        };
+        constexpr auto result = nnm::centroid(points, 4);
+        ASSERT(result.approx_equal({ 1.0f, 1.0f, 1.0f }));
+        ASSERT(nnm::centroid(points, 0) == nnm::Vector3f::zero());
+        // Naive float summation of this many values drifts far from the true mean
+        const std::vector<nnm::Vector3f> many(1000000, { 0.1f, 1000.1f, -0.3f });
+        ASSERT(nnm::centroid(many.data(), many.size()).approx_equal({ 0.1f, 1000.1f, -0.3f }));
+    }
+
+    test_case("covariance");
+    {
+        constexpr nnm::Vector3f points[4] {
+            { 1.0f, 0.0f, 0.0f }, { -1.0f, 0.0f, 0.0f }, { 0.0f, 2.0f, 0.0f }, { 0.0f, -2.0f, 0.0f }
+        };
+        constexpr auto result = nnm::covariance(points, 4);
+        ASSERT(result.approx_equal({ { 0.5f, 0.0f, 0.0f }, { 0.0f, 2.0f, 0.0f }, { 0.0f, 0.0f, 0.0f } }));
+        ASSERT(nnm::covariance(points, 0) == nnm::Matrix3f::zero());
+        const nnm::Vector3f diagonal[3] { { 0.0f, 0.0f, 0.0f }, { 1.0f, 1.0f, 0.0f }, { 2.0f, 2.0f, 0.0f } };
+        const auto diagonal_result = nnm::covariance(diagonal, 3);
+        const float v = 2.0f / 3.0f;
+        ASSERT(diagonal_result.approx_equal({ { v, v, 0.0f }, { v, v, 0.0f }, { 0.0f, 0.0f, 0.0f } }));
+        const auto about_origin = nnm::covariance(diagonal, 3, nnm::Vector3f::zero());
+        const float w = 5.0f / 3.0f;
+        ASSERT(about_origin.approx_equal({ { w, w, 0.0f }, { w, w, 0.0f }, { 0.0f, 0.0f, 0.0f } }));
+        ASSERT(nnm::covariance(points, 0, nnm::Vector3f::zero()) == nnm::Matrix3f::zero());
+    }
+
+    test_case("Maskx");
+    {
+        test_section("Maskx()");
+        {
+            constexpr nnm::Maskx4 m;
+            ASSERT(m.none());
+            ASSERT_FALSE(m.any());
+        }
+
+        test_section("Maskx(bool)");
+        {
+            constexpr nnm::Maskx4 m(true);
+            ASSERT(m.all());
+            ASSERT_FALSE(m.none());
+        }
+
+        test_section("operators");
+        {
+            nnm::Maskx4 m1;
+            m1.at(0) = true;
+            m1.at(1) = true;
+            nnm::Maskx4 m2;
+            m2.at(1) = true;
+            m2.at(2) = true;
+            const nnm::Maskx4 m_and = m1 & m2;
+            ASSERT(!m_and.at(0) && m_and.at(1) && !m_and.at(2) && !m_and.at(3));
+            const nnm::Maskx4 m_or = m1 | m2;
+            ASSERT(m_or.at(0) && m_or.at(1) && m_or.at(2) && !m_or.at(3));
+            ASSERT((!m_or).at(3));
+            ASSERT_FALSE((!m_or).at(0));
+            ASSERT(m_or.any());
+            ASSERT_FALSE(m_or.all());
+        }
+    }
+
+    test_case("Scalarx");
+    {
+        constexpr float values1[4] { 1.0f, -2.0f, 4.0f, 0.0f };
+        constexpr float values2[4] { 2.0f, 2.0f, -1.0f, 3.0f };
+        constexpr auto s1 = nnm::Scalarx4f::load(values1);
+        constexpr auto s2 = nnm::Scalarx4f::load(values2);
+
+        test_section("Scalarx()");
+        {
+            constexpr nnm::Scalarx4f s;
+            ASSERT((s == nnm::Scalarx4f(0.0f)).all());
+        }
+
+        test_section("load/store");
+        {
+            float result[4] {};
+            s1.store(result);
+            for (uint8_t i = 0; i < 4; ++i) {
+                ASSERT(result[i] == values1[i]);
+            }
+        }
+
+        test_section("arithmetic");
+        {
+            constexpr auto sum = s1 + s2;
+            constexpr auto difference = s1 - s2;
+            constexpr auto product = s1 * s2;
+            constexpr auto quotient = s1 / s2;
+            constexpr auto negation = -s1;
+            for (uint8_t i = 0; i < 4; ++i) {
+                ASSERT(sum.at(i) == values1[i] + values2[i]);
+                ASSERT(difference.at(i) == values1[i] - values2[i]);
+                ASSERT(product.at(i) == values1[i] * values2[i]);
+                ASSERT(quotient.at(i) == values1[i] / values2[i]);
+                ASSERT(negation.at(i) == -values1[i]);
+            }
+        }
+
+        test_section("abs/sqrt/min/max/lerp");
+        {
+            const auto abs = s1.abs();
+            const auto sqrt = s2.abs().sqrt();
+            const auto min = s1.min(s2);
+            const auto max = s1.max(s2);
+            const auto lerp = s1.lerp(s2, 0.5f);
+            for (uint8_t i = 0; i < 4; ++i) {
+                ASSERT(abs.at(i) == nnm::abs(values1[i]));
+                ASSERT(sqrt.at(i) == nnm::sqrt(nnm::abs(values2[i])));
+                ASSERT(min.at(i) == nnm::min(values1[i], values2[i]));
+                ASSERT(max.at(i) == nnm::max(values1[i], values2[i]));
+                ASSERT(nnm::approx_equal(lerp.at(i), nnm::lerp(values1[i], values2[i], 0.5f)));
+            }
+        }
+
+        test_section("comparison/select");
+        {
+            constexpr auto less = s1 < s2;
+            ASSERT(less.at(0) && less.at(1) && !less.at(2) && less.at(3));
+            constexpr auto greater_equal = s1 >= s2;
+            ASSERT((greater_equal & less).none());
+            ASSERT((greater_equal | less).all());
+            ASSERT((s1 != s2).all());
+            constexpr auto selected = nnm::Scalarx4f::select(less, s1, s2);
+            ASSERT((selected == s1.min(s2)).all());
+        }
+    }
+
+    test_case("Vector3x");
+    {
+        const nnm::Vector3f vectors1[4] {
+            { 1.0f, -2.0f, 3.0f }, { 0.0f, 0.0f, 0.0f }, { -4.0f, 5.0f, 0.5f }, { 2.0f, 2.0f, -2.0f }
+        };
+        const nnm::Vector3f vectors2[4] {
+            { 0.5f, 1.0f, -1.0f }, { 3.0f, -1.0f, 2.0f }, { 1.0f, 1.0f, 1.0f }, { -2.0f, 0.0f, 4.0f }
+        };
+        const auto v1 = nnm::Vector3x4f::load(vectors1);
+        const auto v2 = nnm::Vector3x4f::load(vectors2);
+
+        test_section("Vector3x(const Vector3&)");
+        {
+            const nnm::Vector3x4f v(nnm::Vector3f(1.0f, 2.0f, 3.0f));
+            for (uint8_t i = 0; i < 4; ++i) {
+                ASSERT(v.at(i) == nnm::Vector3f(1.0f, 2.0f, 3.0f));
+            }
+        }
+
+        test_section("load/store/set");
+        {
+            nnm::Vector3f result[4];
+            v1.store(result);
+            for (uint8_t i = 0; i < 4; ++i) {
+                ASSERT(result[i] == vectors1[i]);
+            }
+            auto v = v1;
+            v.set(2, { 9.0f, 8.0f, 7.0f });
+            ASSERT(v.at(2) == nnm::Vector3f(9.0f, 8.0f, 7.0f));
+            ASSERT(v.at(3) == vectors1[3]);
+        }
+
+        test_section("matches Vector3");
+        {
+            const auto dot = v1.dot(v2);
+            const auto cross = v1.cross(v2);
+            const auto length = v1.length();
+            const auto normalized = v1.normalize();
+            const auto lerp = v1.lerp(v2, 0.25f);
+            const auto sum = v1 + v2;
+            const auto difference = v1 - v2;
+            const auto product = v1 * v2;
+            const auto scaled = v1 * 3.0f;
+            for (uint8_t i = 0; i < 4; ++i) {
+                ASSERT(nnm::approx_equal(dot.at(i), vectors1[i].dot(vectors2[i])));
+                ASSERT(cross.at(i).approx_equal(vectors1[i].cross(vectors2[i])));
+                ASSERT(nnm::approx_equal(length.at(i), vectors1[i].length()));
+                ASSERT(normalized.at(i).approx_equal(vectors1[i].normalize()));
+                ASSERT(lerp.at(i).approx_equal(vectors1[i].lerp(vectors2[i], 0.25f)));
+                ASSERT(sum.at(i) == vectors1[i] + vectors2[i]);
+                ASSERT(difference.at(i) == vectors1[i] - vectors2[i]);
+                ASSERT(product.at(i) == vectors1[i] * vectors2[i]);
+                ASSERT(scaled.at(i) == vectors1[i] * 3.0f);
+            }
+            ASSERT(normalized.at(1) == nnm::Vector3f::zero());
+        }
+
+        test_section("transform");
+        {
+            const auto transform = nnm::Transform3f::from_rotation_axis_angle({ 0.0f, 1.0f, 0.0f }, 0.7f)
+                                       .translate({ 1.0f, -2.0f, 3.0f });
+            const auto points = v1.transform(transform);
+            const auto directions = v1.transform(transform, 0.0f);
+            const nnm::Matrix4x4f matrices(transform.matrix);
+            const auto matrix_points = v1.transform(matrices);
+            for (uint8_t i = 0; i < 4; ++i) {
+                ASSERT(points.at(i).approx_equal(vectors1[i].transform(transform)));
+                ASSERT(directions.at(i).approx_equal(vectors1[i].transform(transform, 0.0f)));
+                ASSERT(matrix_points.at(i).approx_equal(vectors1[i].transform(transform)));
+            }
+        }
+
+        test_section("rotate_quaternion");
+        {
+            const auto quaternion
+                = nnm::QuaternionF::from_axis_angle(nnm::Vector3f(1.0f, 2.0f, -1.0f).normalize(), 1.1f);
+            const auto rotated = v1.rotate_quaternion(nnm::Quaternionx4f(quaternion));
+            for (uint8_t i = 0; i < 4; ++i) {
+                ASSERT(rotated.at(i).approx_equal(vectors1[i].rotate_quaternion(quaternion)));
+            }
+        }
+
+        test_section("select");
+        {
+            const auto selected = nnm::Vector3x4f::select(v1.x < v2.x, v1, v2);
+            for (uint8_t i = 0; i < 4; ++i) {
+                ASSERT(selected.at(i) == (vectors1[i].x < vectors2[i].x ? vectors1[i] : vectors2[i]));
+            }
+        }
+    }
+
+    test_case("Vector4x");
+    {
+        const nnm::Vector4f vectors1[4] { { 1.0f, -2.0f, 3.0f, 1.0f },
+                                          { 0.0f, 0.0f, 0.0f, 0.0f },
+                                          { -4.0f, 5.0f, 0.5f, 2.0f },
+                                          { 2.0f, 2.0f, -2.0f, -1.0f } };
+        const nnm::Vector4f vectors2[4] { { 0.5f, 1.0f, -1.0f, 0.0f },
+                                          { 3.0f, -1.0f, 2.0f, 1.0f },
+                                          { 1.0f, 1.0f, 1.0f, 1.0f },
+                                          { -2.0f, 0.0f, 4.0f, 3.0f } };
+        const auto v1 = nnm::Vector4x4f::load(vectors1);
+        const auto v2 = nnm::Vector4x4f::load(vectors2);
+
+        test_section("load/store");
+        {
+            nnm::Vector4f result[4];
+            v1.store(result);
+            for (uint8_t i = 0; i < 4; ++i) {
+                ASSERT(result[i] == vectors1[i]);
+            }
+        }
+
+        test_section("matches Vector4");
+        {
+            const auto dot = v1.dot(v2);
+            const auto normalized = v1.normalize();
+            const auto lerp = v1.lerp(v2, 0.75f);
+            const auto xyz = v1.xyz();
+            for (uint8_t i = 0; i < 4; ++i) {
+                ASSERT(nnm::approx_equal(dot.at(i), vectors1[i].dot(vectors2[i])));
+                ASSERT(normalized.at(i).approx_equal(vectors1[i].normalize()));
+                ASSERT(lerp.at(i).approx_equal(vectors1[i].lerp(vectors2[i], 0.75f)));
+                ASSERT(xyz.at(i) == vectors1[i].xyz());
+                ASSERT((v1 + v2).at(i) == vectors1[i] + vectors2[i]);
+                ASSERT((v1 - v2).at(i) == vectors1[i] - vectors2[i]);
+            }
+        }
+
+        test_section("transform");
+        {
+            const auto transform = nnm::Transform3f::from_scale({ 2.0f, 1.0f, 0.5f }).translate({ 1.0f, 0.0f, -1.0f });
+            const auto result = v1.transform(transform);
+            for (uint8_t i = 0; i < 4; ++i) {
+                ASSERT(result.at(i).approx_equal(transform.matrix * vectors1[i]));
+            }
+        }
+    }
+
+    test_case("Quaternionx");
+    {
+        const nnm::QuaternionF quaternions1[4] {
+            nnm::QuaternionF::from_axis_angle({ 1.0f, 0.0f, 0.0f }, 0.5f),
+            nnm::QuaternionF::from_axis_angle({ 0.0f, 1.0f, 0.0f }, -1.2f),
+            nnm::QuaternionF::from_axis_angle(nnm::Vector3f(1.0f, 1.0f, 1.0f).normalize(), 2.0f),
+            nnm::QuaternionF(),
+        };
+        const nnm::QuaternionF quaternions2[4] {
+            nnm::QuaternionF::from_axis_angle({ 0.0f, 0.0f, 1.0f }, 1.0f),
+            nnm::QuaternionF::from_axis_angle({ 1.0f, 0.0f, 0.0f }, 0.3f),
+            nnm::QuaternionF::from_axis_angle({ 0.0f, 1.0f, 0.0f }, -0.4f),
+            nnm::QuaternionF::from_axis_angle(nnm::Vector3f(-1.0f, 2.0f, 0.0f).normalize(), 0.9f),
+        };
+        const auto q1 = nnm::Quaternionx4f::load(quaternions1);
+        const auto q2 = nnm::Quaternionx4f::load(quaternions2);
+
+        test_section("Quaternionx()");
+        {
+            const nnm::Quaternionx4f q;
+            for (uint8_t i = 0; i < 4; ++i) {
+                ASSERT(q.at(i) == nnm::QuaternionF());
+            }
+        }
+
+        test_section("matches Quaternion");
+        {
+            const auto product = q1 * q2;
+            const auto inverse = q1.inverse();
+            const auto normalized = nnm::Quaternionx4f(q1.x * 2.0f, q1.y * 2.0f, q1.z * 2.0f, q1.w * 2.0f).normalize();
+            const auto rotated = q1.rotate_quaternion(q2);
+            const auto slerp = q1.slerp(q2, 0.3f);
+            nnm::QuaternionF stored[4];
+            q1.store(stored);
+            for (uint8_t i = 0; i < 4; ++i) {
+                ASSERT(stored[i] == quaternions1[i]);
+                ASSERT(product.at(i).approx_equal(quaternions1[i] * quaternions2[i]));
+                ASSERT(inverse.at(i).approx_equal(quaternions1[i].inverse()));
+                ASSERT(normalized.at(i).approx_equal(quaternions1[i].normalize()));
+                ASSERT(rotated.at(i).approx_equal(quaternions1[i].rotate_quaternion(quaternions2[i])));
+                ASSERT(slerp.at(i).approx_equal(quaternions1[i].slerp(quaternions2[i], 0.3f)));
+            }
+        }
+    }
+
+    test_case("Matrix4x");
+    {
+        const nnm::Matrix4f matrices[4] {
+            nnm::Transform3f::from_rotation_axis_angle({ 1.0f, 0.0f, 0.0f }, 0.5f).matrix,
+            nnm::Transform3f::from_scale({ 2.0f, 3.0f, 4.0f }).matrix,
+            nnm::Transform3f::from_translation({ 1.0f, -2.0f, 3.0f }).matrix,
+            nnm::Matrix4f::identity(),
+        };
+        const auto m = nnm::Matrix4x4f::load(matrices);
+
+        test_section("Matrix4x()");
+        {
+            const nnm::Matrix4x4f identity;
+            for (uint8_t i = 0; i < 4; ++i) {
+                ASSERT(identity.at(i) == nnm::Matrix4f::identity());
+            }
+        }
+
+        test_section("load/store");
+        {
+            nnm::Matrix4f result[4];
+            m.store(result);
+            for (uint8_t i = 0; i < 4; ++i) {
+                ASSERT(result[i] == matrices[i]);
+            }
+        }
+
+        test_section("operator*");
+        {
+            const nnm::Vector4x4f vector(nnm::Vector4f(1.0f, -2.0f, 0.5f, 1.0f));
+            const auto product = m * vector;
+            const auto squared = m * m;
+            for (uint8_t i = 0; i < 4; ++i) {
+                ASSERT(product.at(i).approx_equal(matrices[i] * nnm::Vector4f(1.0f, -2.0f, 0.5f, 1.0f)));
+                ASSERT(squared.at(i).approx_equal(matrices[i] * matrices[i]));
+            }
+        }
+    }
+
+    test_case("Vector3A");
+    {
+        static_assert(sizeof(nnm::Vector3Af) == 16 && alignof(nnm::Vector3Af) == 16);
+        static_assert(sizeof(nnm::Vector3Ad) == 32 && alignof(nnm::Vector3Ad) == 32);
+
+        test_section("Vector3A()");
+        {
+            constexpr nnm::Vector3Af v;
+            ASSERT(v.x == 0.0f && v.y == 0.0f && v.z == 0.0f && v.padding == 0.0f);
+        }
+
+        test_section("Vector3A(const Vector3&)");
+        {
+            constexpr nnm::Vector3Af v(nnm::Vector3f(1.0f, -2.0f, 3.0f));
+            ASSERT(v == nnm::Vector3Af(1.0f, -2.0f, 3.0f));
+            ASSERT(v.padding == 0.0f);
+            constexpr nnm::Vector3f back(v);
+            ASSERT(back == nnm::Vector3f(1.0f, -2.0f, 3.0f));
+        }
+
+        test_section("equality");
+        {
+            nnm::Vector3Af v1(1.0f, 2.0f, 3.0f);
+            nnm::Vector3Af v2(1.0f, 2.0f, 3.0f);
+            v2.padding = 5.0f;
+            ASSERT(v1 == v2);
+            ASSERT(v1.approx_equal(v2));
+            ASSERT(v1 != nnm::Vector3Af(1.0f, 2.0f, 3.5f));
+            ASSERT_FALSE(v1.approx_equal(nnm::Vector3Af(1.0f, 2.0f, 3.5f)));
+        }
+
+        test_section("transform_point_batch");
+        {
+            const nnm::Vector3f points[3] { { 1.0f, -2.0f, 3.0f }, { 0.0f, 0.0f, 0.0f }, { -4.0f, 5.0f, 0.5f } };
+            const nnm::Vector3Af aligned_points[3] { nnm::Vector3Af(points[0]),
+                                                     nnm::Vector3Af(points[1]),
+                                                     nnm::Vector3Af(points[2]) };
+            const auto transform = nnm::Transform3f::from_rotation_axis_angle({ 0.0f, 0.0f, 1.0f }, 0.3f)
+                                       .translate({ 1.0f, 2.0f, 3.0f });
+            nnm::Vector3Af results[3];
+            nnm::transform_point_batch(transform, aligned_points, 3, results);
+            for (size_t i = 0; i < 3; ++i) {
+                ASSERT(nnm::Vector3f(results[i]).approx_equal(points[i].transform(transform)));
+                ASSERT(results[i].padding == 0.0f);
+            }
+        }
+
+        test_section("normalize_batch");
+        {
+            const nnm::Vector3Af vectors[2] { { 3.0f, 0.0f, 4.0f }, { 0.0f, 0.0f, 0.0f } };
+            nnm::Vector3Af results[2];
+            nnm::normalize_batch(vectors, 2, results);
+            ASSERT(results[0].approx_equal({ 0.6f, 0.0f, 0.8f }));
+            ASSERT(results[1] == nnm::Vector3Af());
+        }
+    }
+
+    test_case("Vector4A/Matrix4A/Transform3A");
+    {
+        static_assert(sizeof(nnm::Vector4Af) == sizeof(nnm::Vector4f) && alignof(nnm::Vector4Af) == 16);
+        static_assert(sizeof(nnm::Matrix4Af) == sizeof(nnm::Matrix4f) && alignof(nnm::Matrix4Af) == 16);
+        static_assert(sizeof(nnm::Transform3Ad) == sizeof(nnm::Transform3d) && alignof(nnm::Transform3Ad) == 32);
+
+        test_section("conversion");
+        {
+            constexpr nnm::Vector4Af v1(1.0f, 2.0f, 3.0f, 4.0f);
+            constexpr nnm::Vector4f v2 = v1;
+            ASSERT(v2 == nnm::Vector4f(1.0f, 2.0f, 3.0f, 4.0f));
+            const nnm::Vector4Af normalized = v1.normalize();
+            ASSERT(normalized.approx_equal(v2.normalize()));
+
+            const nnm::Transform3Af transform = nnm::Transform3f::from_translation({ 1.0f, 2.0f, 3.0f });
+            const nnm::Matrix4Af matrix = transform.matrix;
+            ASSERT(matrix == nnm::Transform3f::from_translation({ 1.0f, 2.0f, 3.0f }).matrix);
+            ASSERT(nnm::Vector3f(1.0f, 1.0f, 1.0f).transform(transform) == nnm::Vector3f(2.0f, 3.0f, 4.0f));
+        }
+    }
+
+    test_case("float_to_half/half_to_float");
+    {
+        test_section("exact values");
+        {
+            ASSERT(nnm::float_to_half(0.0f) == 0x0000);
+            ASSERT(nnm::float_to_half(-0.0f) == 0x8000);
+            ASSERT(nnm::float_to_half(1.0f) == 0x3c00);
+            ASSERT(nnm::float_to_half(-2.0f) == 0xc000);
+            ASSERT(nnm::float_to_half(65504.0f) == 0x7bff);
+            ASSERT(nnm::float_to_half(6.103515625e-05f) == 0x0400);
+            ASSERT(nnm::float_to_half(5.9604644775390625e-08f) == 0x0001);
+            ASSERT(nnm::half_to_float(0x3c00) == 1.0f);
+            ASSERT(nnm::half_to_float(0x7bff) == 65504.0f);
+            ASSERT(nnm::half_to_float(0x0001) == 5.9604644775390625e-08f);
+            ASSERT(nnm::half_to_float(0x8000) == 0.0f);
+        }
+
+        test_section("rounding");
+        {
+            ASSERT(nnm::float_to_half(1.0f + 1.0f / 2048.0f) == 0x3c00);
+            ASSERT(nnm::float_to_half(1.0f + 3.0f / 2048.0f) == 0x3c02);
+            ASSERT(nnm::float_to_half(65520.0f) == 0x7c00);
+            ASSERT(nnm::float_to_half(1.0e-10f) == 0x0000);
+        }
+
+        test_section("special values");
+        {
+            const float infinity = std::numeric_limits<float>::infinity();
+            ASSERT(nnm::float_to_half(infinity) == 0x7c00);
+            ASSERT(nnm::float_to_half(-infinity) == 0xfc00);
+            ASSERT(nnm::half_to_float(0x7c00) == infinity);
+            const float nan = nnm::half_to_float(nnm::float_to_half(std::numeric_limits<float>::quiet_NaN()));
+            ASSERT(nan != nan);
+        }
+
+        test_section("round trip");
+        {
+            bool exact = true;
+            for (uint32_t bits = 0; bits < 0x7c00; ++bits) {
+                const auto half = static_cast<uint16_t>(bits);
+                exact = exact && nnm::float_to_half(nnm::half_to_float(half)) == half;
+            }
+            ASSERT(exact);
+        }
+    }
+
+    test_case("Vector3h");
+    {
+        test_section("error bound");
+        {
+            bool within = true;
+            for (int i = -1000; i <= 1000; ++i) {
+                const auto value = static_cast<float>(i) * 0.0137f;
+                const nnm::Vector3f vector { value, value * 31.0f, -value * 0.001f };
+                const nnm::Vector3f decoded = nnm::Vector3h(vector).decode();
+                for (uint8_t c = 0; c < 3; ++c) {
+                    const float error = nnm::abs(decoded[c] - vector[c]);
+                    within = within && (error <= nnm::abs(vector[c]) / 2048.0f || error <= 3.0e-8f);
+                }
+            }
+            ASSERT(within);
+        }
+
+        test_section("batch");
+        {
+            const nnm::Vector3f vectors[2] { { 1.0f, -0.5f, 0.25f }, { 1024.0f, 2.0f, -3.0f } };
+            nnm::Vector3h encoded[2];
+            nnm::encode_batch(vectors, 2, encoded);
+            ASSERT(encoded[0] == nnm::Vector3h(vectors[0]));
+            ASSERT(encoded[1] != encoded[0]);
+            nnm::Vector3f decoded[2];
+            nnm::decode_batch(encoded, 2, decoded);
+            ASSERT(decoded[0] == vectors[0]);
+            ASSERT(decoded[1] == vectors[1]);
+        }
+    }
+
+    test_case("Vector3snorm16");
+    {
+        test_section("Vector3snorm16(const Vector3f&)");
+        {
+            constexpr nnm::Vector3snorm16 v(nnm::Vector3f(1.0f, -1.0f, 0.0f));
+            ASSERT(v.x == 32767 && v.y == -32767 && v.z == 0);
+            constexpr nnm::Vector3snorm16 clamped(nnm::Vector3f(2.0f, -5.0f, 0.5f));
+            ASSERT(clamped.x == 32767 && clamped.y == -32767 && clamped.z == 16384);
+            ASSERT(nnm::Vector3snorm16::decode(-32768) == -1.0f);
+        }
+
+        test_section("error bound");
+        {
+            bool within = true;
+            for (int i = -1000; i <= 1000; ++i) {
+                const float value = static_cast<float>(i) / 1000.0f;
+                const nnm::Vector3f vector { value, -value * 0.7f, value * value };
+                const nnm::Vector3f decoded = nnm::Vector3snorm16(vector).decode();
+                within = within && (decoded - vector).abs().max() <= 0.5f / 32767.0f + 1.0e-7f;
+            }
+            ASSERT(within);
+        }
+
+        test_section("batch");
+        {
+            const nnm::Vector3f vectors[2] { { 0.6f, 0.0f, -0.8f }, { 0.0f, 1.0f, 0.0f } };
+            nnm::Vector3snorm16 encoded[2];
+            nnm::encode_batch(vectors, 2, encoded);
+            ASSERT(encoded[1] == nnm::Vector3snorm16(vectors[1]));
+            nnm::Vector3f decoded[2];
+            nnm::decode_batch(encoded, 2, decoded);
+            ASSERT((decoded[0] - vectors[0]).abs().max() <= 0.5f / 32767.0f + 1.0e-7f);
+            ASSERT(decoded[1] == vectors[1]);
+        }
+    }
+
+    test_case("Vector4unorm8");
+    {
+        test_section("Vector4unorm8(const Vector4f&)");
+        {
+            constexpr nnm::Vector4unorm8 v(nnm::Vector4f(0.0f, 1.0f, 0.5f, 2.0f));
+            ASSERT(v.x == 0 && v.y == 255 && v.z == 128 && v.w == 255);
+            ASSERT(v.decode() == nnm::Vector4f(0.0f, 1.0f, 128.0f / 255.0f, 1.0f));
+        }
+
+        test_section("error bound");
+        {
+            bool within = true;
+            for (int i = 0; i <= 1000; ++i) {
+                const float value = static_cast<float>(i) / 1000.0f;
+                const nnm::Vector4f vector { value, 1.0f - value, value * value, 0.5f };
+                const nnm::Vector4f decoded = nnm::Vector4unorm8(vector).decode();
+                within = within && (decoded - vector).abs().max() <= 0.5f / 255.0f + 1.0e-7f;
+            }
+            ASSERT(within);
+        }
+
+        test_section("batch");
+        {
+            const nnm::Vector4f vectors[2] { { 1.0f, 0.0f, 0.0f, 1.0f }, { 0.2f, 0.4f, 0.6f, 0.8f } };
+            nnm::Vector4unorm8 encoded[2];
+            nnm::encode_batch(vectors, 2, encoded);
+            ASSERT(encoded[1] == nnm::Vector4unorm8(vectors[1]));
+            nnm::Vector4f decoded[2];
+            nnm::decode_batch(encoded, 2, decoded);
+            ASSERT(decoded[0] == vectors[0]);
+        }
+    }
+
+    test_case("QuaternionPacked");
+    {
+        static_assert(sizeof(nnm::QuaternionPacked32) == 4);
+        static_assert(sizeof(nnm::QuaternionPacked48) == 6);
+
+        std::vector<nnm::QuaternionF> quaternions;
+        for (int i = 0; i < 200; ++i) {
+            const auto value = static_cast<float>(i);
+            const nnm::Vector3f axis
+                = nnm::Vector3f(nnm::sin(value * 1.3f), nnm::cos(value * 0.7f), nnm::sin(value * 2.9f) + 0.1f)
+                      .normalize();
+            quaternions.push_back(nnm::QuaternionF::from_axis_angle(axis, value * 0.37f - 30.0f));
+        }
+        quaternions.emplace_back(0.0f, 0.0f, 0.0f, -1.0f);
+        quaternions.emplace_back(0.5f, -0.5f, 0.5f, -0.5f);
+
+        test_section("QuaternionPacked()");
+        {
+            ASSERT(nnm::QuaternionPacked32().decode() == nnm::QuaternionF());
+            ASSERT(nnm::QuaternionPacked48().decode() == nnm::QuaternionF());
+        }
+
+        test_section("error bound");
+        {
+            // Either sign of a quaternion is the same rotation so error is measured by the absolute dot product.
+            const auto worst = [&](auto packed) {
+                float worst_dot = 1.0f;
+                for (const nnm::QuaternionF& quaternion : quaternions) {
+                    const nnm::QuaternionF decoded = decltype(packed)(quaternion).decode();
+                    const float dot = nnm::abs(nnm::Vector4f::from_quaternion(decoded).dot(
+                        nnm::Vector4f::from_quaternion(quaternion)));
+                    worst_dot = nnm::min(worst_dot, dot);
+                    ASSERT(nnm::approx_equal(decoded.length(), 1.0f));
+                }
+                return 1.0f - worst_dot;
+            };
+            ASSERT(worst(nnm::QuaternionPacked32()) < 4.0e-6f);
+            ASSERT(worst(nnm::QuaternionPacked48()) < 5.0e-7f);
+        }
+
+        test_section("batch");
+        {
+            std::vector<nnm::QuaternionPacked48> packed(quaternions.size());
+            nnm::encode_batch(quaternions.data(), quaternions.size(), packed.data());
+            ASSERT(packed[3] == nnm::QuaternionPacked48(quaternions[3]));
+            ASSERT(packed[3] != packed[4]);
+            std::vector<nnm::QuaternionF> decoded(quaternions.size());
+            nnm::decode_batch(packed.data(), packed.size(), decoded.data());
+            ASSERT(decoded[3] == packed[3].decode());
+        }
+    }
+
+    test_case("octahedral");
+    {
+        std::vector<nnm::Vector3f> normals;
+        for (int i = 0; i < 2000; ++i) {
+            const auto value = static_cast<float>(i);
+            normals.push_back(
+                nnm::Vector3f(nnm::sin(value * 1.3f), nnm::cos(value * 0.7f), nnm::sin(value * 2.9f)).normalize());
+        }
+        normals.emplace_back(0.0f, 0.0f, 1.0f);
+        normals.emplace_back(0.0f, 0.0f, -1.0f);
+        normals.emplace_back(-1.0f, 0.0f, 0.0f);
+        normals.emplace_back(0.0f, 0.6f, -0.8f);
+        // Measured in double precision since the dot product of such close vectors rounds to one in float.
+        const auto angle = [](const nnm::Vector3f& from, const nnm::Vector3f& to) {
+            const nnm::Vector3d from_double(from.x, from.y, from.z);
+            const nnm::Vector3d to_double(to.x, to.y, to.z);
+            return nnm::atan2(from_double.cross(to_double).length(), from_double.dot(to_double));
+        };
+
+        test_section("encode_octahedral");
+        {
+            constexpr auto result = nnm::encode_octahedral(nnm::Vector3f(0.0f, 0.0f, 1.0f));
+            ASSERT(result == nnm::Vector2f(0.0f, 0.0f));
+            ASSERT(nnm::encode_octahedral(nnm::Vector3f(0.0f, 0.0f, -1.0f)) == nnm::Vector2f(1.0f, 1.0f));
+            ASSERT(nnm::encode_octahedral(nnm::Vector3f(0.0f, -1.0f, 0.0f)) == nnm::Vector2f(0.0f, -1.0f));
+        }
+
+        test_section("decode_octahedral");
+        {
+            ASSERT(nnm::decode_octahedral(nnm::Vector2f(0.0f, 0.0f)) == nnm::Vector3f(0.0f, 0.0f, 1.0f));
+            ASSERT(nnm::decode_octahedral(nnm::Vector2f(-1.0f, -1.0f)) == nnm::Vector3f(0.0f, 0.0f, -1.0f));
+            double worst = 0.0;
+            for (const nnm::Vector3f& normal : normals) {
+                worst = nnm::max(worst, angle(nnm::decode_octahedral(nnm::encode_octahedral(normal)), normal));
+            }
+            ASSERT(worst < 1.0e-6);
+        }
+
+        test_section("Vector3oct16");
+        {
+            static_assert(sizeof(nnm::Vector3oct16) == 4);
+            ASSERT(nnm::Vector3oct16().decode() == nnm::Vector3f(0.0f, 0.0f, 1.0f));
+            constexpr nnm::Vector3oct16 v(nnm::Vector3f(1.0f, 0.0f, 0.0f));
+            ASSERT(v.x == 32767 && v.y == 0);
+            ASSERT(v.decode() == nnm::Vector3f(1.0f, 0.0f, 0.0f));
+            const nnm::Vector3oct16 down = nnm::Vector3oct16::precise(nnm::Vector3f(0.0f, 0.0f, -1.0f));
+            ASSERT(down.decode() == nnm::Vector3f(0.0f, 0.0f, -1.0f));
+        }
+
+        test_section("angular error");
+        {
+            double worst_fast = 0.0;
+            double worst_precise = 0.0;
+            bool precise_closer = true;
+            for (const nnm::Vector3f& normal : normals) {
+                const double fast = angle(nnm::Vector3oct16(normal).decode(), normal);
+                const double precise = angle(nnm::Vector3oct16::precise(normal).decode(), normal);
+                worst_fast = nnm::max(worst_fast, fast);
+                worst_precise = nnm::max(worst_precise, precise);
+                precise_closer = precise_closer && precise <= fast + 1.0e-7;
+            }
+            ASSERT(worst_fast < 7.0e-5);
+            ASSERT(worst_precise < 5.0e-5);
+            ASSERT(precise_closer);
+        }
+
+        test_section("batch");
+        {
+            nnm::Vector3oct16 encoded[4];
+            nnm::encode_batch(normals.data(), 4, encoded);
+            ASSERT(encoded[2] == nnm::Vector3oct16(normals[2]));
+            nnm::Vector3oct16 precise[4];
+            nnm::encode_precise_batch(normals.data(), 4, precise);
+            ASSERT(precise[3] == nnm::Vector3oct16::precise(normals[3]));
+            nnm::Vector3f decoded[4];
+            nnm::decode_batch(precise, 4, decoded);
+            ASSERT(decoded[1] == precise[1].decode());
+        }
+    }
+
+    test_case("StridedSpan");
+    {
+        // Interleaved position, normal, and texture coordinate of four vertices.
+        float vertices[4 * 8] {};
+        for (int i = 0; i < 4; ++i) {
+            const auto value = static_cast<float>(i);
+            float* vertex = vertices + i * 8;
+            vertex[0] = value;
+            vertex[1] = value * 2.0f;
+            vertex[2] = -value;
+            vertex[3] = 0.0f;
+            vertex[4] = value + 1.0f;
+            vertex[5] = 0.0f;
+            vertex[6] = 0.5f;
+            vertex[7] = 0.25f;
+        }
+        const nnm::StridedSpan<nnm::Vector3f> positions(vertices, 4, sizeof(float) * 8);
+        const nnm::StridedSpan<nnm::Vector3f> normals(vertices, 4, sizeof(float) * 8, sizeof(float) * 3);
+
+        test_section("StridedSpan()");
+        {
+            constexpr nnm::StridedSpan<const nnm::Vector3f> span;
+            ASSERT(span.data == nullptr && span.count == 0 && span.stride == sizeof(nnm::Vector3f));
+        }
+
+        test_section("StridedSpan(Value*, size_t)");
+        {
+            const nnm::Vector3f points[2] { { 1.0f, 2.0f, 3.0f }, { 4.0f, 5.0f, 6.0f } };
+            const nnm::StridedSpan<const nnm::Vector3f> span(points, 2);
+            ASSERT(span.stride == sizeof(nnm::Vector3f));
+            ASSERT(span[1] == points[1]);
+        }
+
+        test_section("load");
+        {
+            ASSERT(positions.load(2) == nnm::Vector3f(2.0f, 4.0f, -2.0f));
+            ASSERT(normals[3] == nnm::Vector3f(0.0f, 4.0f, 0.0f));
+            const nnm::StridedSpan<const std::byte> bytes(vertices, 4, sizeof(float) * 8);
+            ASSERT(bytes.count == 4);
+        }
+
+        test_section("store");
+        {
+            float copy[4 * 8];
+            std::memcpy(copy, vertices, sizeof(vertices));
+            const nnm::StridedSpan<nnm::Vector3f> span(copy, 4, sizeof(float) * 8, sizeof(float) * 3);
+            span.store(1, { 7.0f, 8.0f, 9.0f });
+            ASSERT(copy[11] == 7.0f && copy[12] == 8.0f && copy[13] == 9.0f);
+            ASSERT(copy[10] == -1.0f && copy[14] == 0.5f);
+        }
+
+        test_section("subspan");
+        {
+            const nnm::StridedSpan<const nnm::Vector3f> span = positions.subspan(1, 2);
+            ASSERT(span.count == 2);
+            ASSERT(span[0] == positions[1]);
+            ASSERT(span[1] == positions[2]);
+        }
+
+        test_section("batch");
+        {
+            const auto transform = nnm::Transform3f::from_rotation_axis_angle({ 0.0f, 1.0f, 0.0f }, 0.5f)
+                                       .translate({ 1.0f, -2.0f, 3.0f });
+            nnm::Vector3f transformed[4];
+            nnm::transform_point_batch(transform, positions, nnm::StridedSpan<nnm::Vector3f>(transformed, 4));
+            bool same = true;
+            for (size_t i = 0; i < 4; ++i) {
+                same = same && transformed[i] == positions[i].transform(transform);
+            }
+            ASSERT(same);
+
+            float copy[4 * 8];
+            std::memcpy(copy, vertices, sizeof(vertices));
+            const nnm::StridedSpan<nnm::Vector3f> copy_normals(copy, 4, sizeof(float) * 8, sizeof(float) * 3);
+            nnm::normalize_batch(copy_normals, copy_normals);
+            ASSERT(copy_normals[2] == nnm::Vector3f(0.0f, 1.0f, 0.0f));
+            ASSERT(copy[8] == 1.0f && copy[14] == 0.5f);
+
+            const auto plane = nnm::Plane3f::from_point_normal({ 0.0f, 1.0f, 0.0f }, { 0.0f, 1.0f, 0.0f });
+            float distances[4];
+            nnm::signed_distance_batch(plane, positions, nnm::StridedSpan<float>(distances, 4));
+            ASSERT(distances[3] == 5.0f);
+
+            nnm::Vector3oct16 encoded[4];
+            nnm::encode_batch(copy_normals, nnm::StridedSpan<nnm::Vector3oct16>(encoded, 4));
+            ASSERT(encoded[1] == nnm::Vector3oct16(copy_normals[1]));
+            nnm::Vector3h halves[4];
+            nnm::encode_batch(positions, nnm::StridedSpan<nnm::Vector3h>(halves, 4));
+            nnm::decode_batch(nnm::StridedSpan<const nnm::Vector3h>(halves, 4), copy_normals);
+            ASSERT(copy_normals[3] == positions[3]);
+        }
+
+        test_section("centroid");
+        {
+            nnm::Vector3f points[4];
+            for (size_t i = 0; i < 4; ++i) {
+                points[i] = positions[i];
+            }
+            ASSERT(nnm::centroid(positions) == nnm::centroid(points, 4));
+            ASSERT(nnm::covariance(positions) == nnm::covariance(points, 4));
+        }
+    }
+
+    test_case("Vector3Split");
+    {
+        const nnm::Vector3d position(12345678.123456, -9876543.21, 0.5);
+        const nnm::Vector3d camera(12345670.0, -9876540.0, 1.5);
+
+        test_section("Vector3Split()");
+        {
+            constexpr nnm::Vector3Split split;
+            ASSERT(split.high == nnm::Vector3f::zero() && split.low == nnm::Vector3f::zero());
+        }
+
+        test_section("Vector3Split(const Vector3d&)");
+        {
+            const nnm::Vector3Split split(position);
+            ASSERT(split.high == nnm::Vector3f(position));
+            ASSERT(nnm::abs(split.low.x) <= 0.5f && split.low.x != 0.0f);
+            ASSERT(split.low.z == 0.0f);
+        }
+
+        test_section("decode");
+        {
+            const nnm::Vector3d decoded = nnm::Vector3Split(position).decode();
+            ASSERT((decoded - position).abs().max() < 1.0e-7);
+        }
+
+        test_section("relative_to");
+        {
+            const nnm::Vector3f relative = nnm::Vector3Split(position).relative_to(nnm::Vector3Split(camera));
+            ASSERT(relative.approx_equal(nnm::Vector3f(position - camera)));
+            ASSERT_FALSE((nnm::Vector3f(position) - nnm::Vector3f(camera)).approx_equal(relative));
+        }
+
+        test_section("equality");
+        {
+            ASSERT(nnm::Vector3Split(position) == nnm::Vector3Split(position));
+            ASSERT(nnm::Vector3Split(position) != nnm::Vector3Split(camera));
+        }
+
+        test_section("batch");
+        {
+            const nnm::Vector3d positions[] { position, camera, { -1.0e9, 2.0e-3, 3.0 } };
+            nnm::Vector3Split splits[3];
+            nnm::encode_batch(positions, 3, splits);
+            ASSERT(splits[2] == nnm::Vector3Split(positions[2]));
+            nnm::Vector3d decoded[3];
+            nnm::decode_batch(splits, 3, decoded);
+            ASSERT(decoded[1] == splits[1].decode());
+        }
+    }
+
+    test_case("rebase_batch");
+    {
+        const nnm::Vector3d camera(1.0e8, -2.0e7, 4.0e6);
+
+        test_section("Vector3");
+        {
+            const nnm::Vector3d positions[] { camera + nnm::Vector3d(0.125, -3.5, 1.0e-3), { 0.0, 0.0, 0.0 } };
+            nnm::Vector3f results[2];
+            nnm::rebase_batch(positions, 2, camera, results);
+            ASSERT(results[0].approx_equal(nnm::Vector3f(0.125f, -3.5f, 1.0e-3f)));
+            ASSERT(results[1] == nnm::Vector3f(-camera));
+        }
+
+        test_section("Transform3");
+        {
+            const auto transform = nnm::Transform3d::from_rotation_axis_angle({ 0.0, 1.0, 0.0 }, 0.5)
+                                       .translate(camera + nnm::Vector3d(2.0, 0.25, -1.0));
+            nnm::Transform3f result;
+            nnm::rebase_batch(&transform, 1, camera, &result);
+            ASSERT(result.matrix.columns[3] == nnm::Vector4f(2.0f, 0.25f, -1.0f, 1.0f));
+            ASSERT(result.matrix.columns[0] == nnm::Vector4f(transform.matrix.columns[0]));
+            ASSERT(nnm::Vector3f(1.0f, 2.0f, 3.0f)
+                       .transform(result)
+                       .approx_equal(nnm::Vector3f(nnm::Vector3d(1.0, 2.0, 3.0).transform(transform) - camera)));
+        }
+    }
+
+    test_case("Fixed");
+    {
+        using nnm::Fixed16;
+        using Fixed24 = nnm::Fixed<24, 8>;
+
+        test_section("Fixed()");
+        {
+            constexpr Fixed16 value;
+            ASSERT(value.raw == 0);
+        }
+
+        test_section("Fixed(Number)");
+        {
+            ASSERT(Fixed16(3).raw == 3 << 16);
+            ASSERT(Fixed16(-1.5f).raw == -(3 << 15));
+            ASSERT(Fixed16(1.0 / 65536.0 * 0.6).raw == 1);
+            ASSERT(Fixed24(Fixed16(1.25)).raw == 320);
+            ASSERT(Fixed16(Fixed24::from_raw(-320)) == Fixed16(-1.25));
+        }
+
+        test_section("conversion");
+        {
+            ASSERT(static_cast<float>(Fixed16(-2.75)) == -2.75f);
+            ASSERT(static_cast<int>(Fixed16(-2.75)) == -2);
+            ASSERT(static_cast<double>(Fixed16::max_value()) == 32768.0 - 1.0 / 65536.0);
+        }
+
+        test_section("arithmetic");
+        {
+            ASSERT(Fixed16(1.5) + Fixed16(2.25) == Fixed16(3.75));
+            ASSERT(Fixed16(1.5) - Fixed16(2.25) == Fixed16(-0.75));
+            ASSERT(Fixed16(1.5) * Fixed16(-2.25) == Fixed16(-3.375));
+            ASSERT(Fixed16(1) / Fixed16(3) == Fixed16::from_raw(21845));
+            ASSERT(Fixed16(-1) / Fixed16(0) == Fixed16::min_value());
+            ASSERT(Fixed16::max_value() + Fixed16::from_raw(1) == Fixed16::min_value());
+            ASSERT(-Fixed16(2) == Fixed16(-2));
+            Fixed16 value(1);
+            value += Fixed16(2);
+            value *= Fixed16(0.5);
+            value -= Fixed16(0.25);
+            value /= Fixed16(5);
+            ASSERT(value == Fixed16(0.25));
+        }
+
+        test_section("comparison");
+        {
+            ASSERT(Fixed16(-1) < Fixed16(1) && Fixed16(1) <= Fixed16(1) && Fixed16(2) > Fixed16(1));
+            ASSERT(Fixed16(1) >= Fixed16(1) && Fixed16(1) != Fixed16(2));
+            ASSERT_FALSE(Fixed16(1) < Fixed16(-1));
+        }
+
+        test_section("epsilon");
+        {
+            ASSERT(nnm::epsilon<Fixed16>() == Fixed16::from_raw(16));
+            ASSERT(nnm::approx_equal(Fixed16(1), Fixed16(1) + Fixed16::from_raw(10)));
+            ASSERT_FALSE(nnm::approx_equal(Fixed16(1), Fixed16(1.01)));
+        }
+
+        // The raw results are checked exactly since they must be the same on every compiler and platform.
+        test_section("sqrt");
+        {
+            ASSERT(nnm::sqrt(Fixed16(2)).raw == 92682);
+            ASSERT(nnm::sqrt(Fixed16(16)) == Fixed16(4));
+            ASSERT(nnm::sqrt(Fixed16(-1)) == Fixed16(0));
+        }
+
+        test_section("sin, cos, tan");
+        {
+            ASSERT(nnm::sin(Fixed16(1)).raw == 55147);
+            ASSERT(nnm::cos(Fixed16(1)).raw == 35409);
+            ASSERT(nnm::sin(Fixed16(0)) == Fixed16(0) && nnm::cos(Fixed16(0)) == Fixed16(1));
+            bool accurate = true;
+            for (int i = -2000; i <= 2000; ++i) {
+                const auto value = Fixed16::from_raw(i * 701);
+                const auto angle = static_cast<double>(value);
+                accurate = accurate && nnm::abs(static_cast<double>(nnm::sin(value)) - std::sin(angle)) <= 2.0 / 65536;
+                accurate = accurate && nnm::abs(static_cast<double>(nnm::cos(value)) - std::cos(angle)) <= 2.0 / 65536;
+            }
+            ASSERT(accurate);
+            ASSERT(nnm::abs(static_cast<double>(nnm::tan(Fixed16(0.5))) - std::tan(0.5)) <= 4.0 / 65536);
+        }
+
+        test_section("atan2, atan, asin, acos");
+        {
+            ASSERT(nnm::atan2(Fixed16(-1), Fixed16(-1)).raw == -154416);
+            ASSERT(nnm::atan2(Fixed16(0), Fixed16(0)) == Fixed16(0));
+            bool accurate = true;
+            for (int i = -100; i <= 100; ++i) {
+                const auto y = Fixed16::from_raw(i * 3001);
+                const auto x = Fixed16::from_raw((i * 7919) % 200000 - 100000);
+                const double expected = std::atan2(static_cast<double>(y), static_cast<double>(x));
+                accurate = accurate && nnm::abs(static_cast<double>(nnm::atan2(y, x)) - expected) <= 2.0 / 65536;
+            }
+            ASSERT(accurate);
+            ASSERT(nnm::abs(static_cast<double>(nnm::atan(Fixed16(2))) - std::atan(2.0)) <= 2.0 / 65536);
+            ASSERT(nnm::abs(static_cast<double>(nnm::asin(Fixed16(0.5))) - std::asin(0.5)) <= 2.0 / 65536);
+            ASSERT(nnm::abs(static_cast<double>(nnm::acos(Fixed16(-0.5))) - std::acos(-0.5)) <= 2.0 / 65536);
+        }
+
+        test_section("floor, ceil, round");
+        {
+            ASSERT(nnm::floor(Fixed16(-1.5)) == Fixed16(-2) && nnm::floor(Fixed16(1.5)) == Fixed16(1));
+            ASSERT(nnm::ceil(Fixed16(-1.5)) == Fixed16(-1) && nnm::ceil(Fixed16(1.25)) == Fixed16(2));
+            ASSERT(nnm::round(Fixed16(-1.5)) == Fixed16(-2) && nnm::round(Fixed16(1.25)) == Fixed16(1));
+        }
+
+        test_section("modf, remf");
+        {
+            ASSERT(nnm::remf(Fixed16(-5.5), Fixed16(2)) == Fixed16(-1.5));
+            ASSERT(nnm::modf(Fixed16(-5.5), Fixed16(2)) == Fixed16(0.5));
+        }
+
+        test_section("Real");
+        {
+            using Vector3 = nnm::Vector3<Fixed16>;
+            const Vector3 axis(Fixed16(0), Fixed16(1), Fixed16(0));
+            const Vector3 point(Fixed16(1.5), Fixed16(-2), Fixed16(0.25));
+            const auto transform = nnm::Transform3<Fixed16>::from_rotation_axis_angle(axis, Fixed16(0.5))
+                                       .translate(Vector3(Fixed16(1), Fixed16(2), Fixed16(3)));
+            const Vector3 result = point.transform(transform);
+            ASSERT(result.x.raw == 159661 && result.y.raw == 0 && result.z.raw == 163856);
+            const auto float_transform = nnm::Transform3f::from_rotation_axis_angle({ 0.0f, 1.0f, 0.0f }, 0.5f)
+                                             .translate({ 1.0f, 2.0f, 3.0f });
+            const nnm::Vector3f expected = nnm::Vector3f(1.5f, -2.0f, 0.25f).transform(float_transform);
+            ASSERT((nnm::Vector3f(result) - expected).abs().max() < 1.0e-4f);
+            ASSERT(nnm::approx_equal(point.normalize().length(), Fixed16(1)));
+            const auto rotation = nnm::Quaternion<Fixed16>::from_axis_angle(axis, Fixed16(0.5));
+            const auto basis = nnm::Basis3<Fixed16>::from_rotation_axis_angle(axis, Fixed16(0.5));
+            ASSERT(point.rotate_quaternion(rotation).approx_equal(point.transform(basis)));
+            const nnm::Vector2<Fixed16> vector(Fixed16(3), Fixed16(4));
+            ASSERT(vector.length() == Fixed16(5));
+        }
+    }
+
+#if defined(__FLT16_MAX__)
+    test_case("_Float16");
+    {
+        using nnm::Vector3f16;
+        using Half = _Float16;
+
+        test_section("RealTraits");
+        {
+            ASSERT(nnm::epsilon<Half>() == static_cast<Half>(0.004));
+            ASSERT(nnm::approx_equal(nnm::pi<Half>(), static_cast<Half>(3.140625)));
+            ASSERT(nnm::approx_equal(static_cast<Half>(1), static_cast<Half>(1.001)));
+            ASSERT_FALSE(nnm::approx_equal(static_cast<Half>(1), static_cast<Half>(1.01)));
+        }
+
+        test_section("functions");
+        {
+            ASSERT(nnm::approx_equal(nnm::sqrt(static_cast<Half>(2)), static_cast<Half>(1.41421356f)));
+            ASSERT(nnm::approx_equal(nnm::sin(static_cast<Half>(1)), static_cast<Half>(0.84147098f)));
+            const Half angle = nnm::atan2(static_cast<Half>(-1), static_cast<Half>(-1));
+            ASSERT(nnm::approx_equal(angle, static_cast<Half>(-2.35619449f)));
+            ASSERT(nnm::floor(static_cast<Half>(-1.5)) == static_cast<Half>(-2));
+        }
+
+        test_section("Real");
+        {
+            const Vector3f16 point(static_cast<Half>(1.5), static_cast<Half>(-2), static_cast<Half>(0.25));
+            ASSERT(nnm::approx_equal(point.normalize().length(), static_cast<Half>(1)));
+            const auto float_transform = nnm::Transform3f::from_rotation_axis_angle({ 0.0f, 0.6f, 0.8f }, 0.5f)
+                                             .translate({ 1.0f, 2.0f, 3.0f });
+            const nnm::Vector3f expected = nnm::Vector3f(point).transform(float_transform);
+            const Vector3f16 result = point.transform(nnm::Transform3f16(float_transform));
+            ASSERT((nnm::Vector3f(result) - expected).abs().max() < 0.02f);
+            const auto float_rotation = nnm::QuaternionF::from_axis_angle({ 0.0f, 0.6f, 0.8f }, 0.5f);
+            const Vector3f16 rotated = point.rotate_quaternion(nnm::QuaternionF16(float_rotation));
+            const nnm::Vector3f rotated_expected = nnm::Vector3f(point).rotate_quaternion(float_rotation);
+            ASSERT((nnm::Vector3f(rotated) - rotated_expected).abs().max() < 0.02f);
+            const nnm::Matrix3f float_matrix({ 2.0f, 1.0f, 0.0f }, { 0.0f, 4.0f, 0.0f }, { 0.0f, 0.0f, 0.5f });
+            const nnm::Matrix3f16 matrix(float_matrix);
+            ASSERT((matrix * matrix.unchecked_inverse()).approx_equal(nnm::Matrix3f16::identity()));
+        }
+    }
+#endif
+
+#if defined(NNM_BOUNDS_CHECK_THROW)
+    test_case("bounds_check");
+    {
+        test_section("out_of_range");
+        {
+            const nnm::Matrix4f matrix;
+            const nnm::Vector3f vector;
+            ASSERT(matrix.at(3, 3) == 1.0f);
+            bool thrown = false;
+            try {
+                static_cast<void>(matrix.at(4, 0));
+            }
+            catch (const std::out_of_range&) {
+                thrown = true;
+            }
+            ASSERT(thrown);
+            thrown = false;
+            try {
+                static_cast<void>(vector[3]);
+            }
+            catch (const std::out_of_range&) {
+                thrown = true;
+            }
+            ASSERT(thrown);
+        }
+    }
+#endif
 }
\ No newline at end of file